@@ -11,11 +11,12 @@ amuse::AudioGroupData CAudioGroupSet::LoadData() {
     return SBig(value);
   };
 
-  CMemoryInStream r(m_buffer.get(), INT32_MAX, CMemoryInStream::EOwnerShip::NotOwned);
+  CMemoryInStream r(m_bytes, INT32_MAX, CMemoryInStream::EOwnerShip::NotOwned);
   x10_baseName = r.Get<std::string>();
   x20_name = r.Get<std::string>();
 
-  u8* buf = m_buffer.get() + r.GetReadPosition();
+  // amuse only reads the group data, so the bytes may be a read-only mapping
+  auto* buf = const_cast<u8*>(m_bytes) + r.GetReadPosition();
   const uint32_t poolLen = readU32(buf);
   unsigned char* pool = buf + 4;
   buf += poolLen + 4;
@@ -31,11 +32,20 @@ amuse::AudioGroupData CAudioGroupSet::LoadData() {
   return {proj, projLen, pool, poolLen, sdir, sdirLen, samp, sampLen, amuse::GCNDataTag{}};
 }
 
-CAudioGroupSet::CAudioGroupSet(std::unique_ptr<u8[]>&& in) : m_buffer(std::move(in)), m_data(LoadData()) {}
+CAudioGroupSet::CAudioGroupSet(std::unique_ptr<u8[]>&& in)
+: m_buffer(std::move(in)), m_bytes(m_buffer.get()), m_data(LoadData()) {}
+
+CAudioGroupSet::CAudioGroupSet(const SMappedView& view) : m_view(view), m_bytes(view.x8_data), m_data(LoadData()) {}
 
 CFactoryFnReturn FAudioGroupSetDataFactory(const metaforce::SObjectTag& tag, std::unique_ptr<u8[]>&& in, u32 len,
                                            const metaforce::CVParamTransfer& vparms, CObjectReference* selfRef) {
   return TToken<CAudioGroupSet>::GetIObjObjectFor(std::make_unique<CAudioGroupSet>(std::move(in)));
 }
 
+CFactoryFnReturn FAudioGroupSetDataViewFactory(const metaforce::SObjectTag& tag, const metaforce::SMappedView& view,
+                                               const metaforce::CVParamTransfer& vparms, CObjectReference* selfRef) {
+  // Sample data makes these some of the largest resources; the set keeps the mapping instead of a copy
+  return TToken<CAudioGroupSet>::GetIObjObjectFor(std::make_unique<CAudioGroupSet>(view));
+}
+
 } // namespace metaforce
@@ -4,6 +4,7 @@
 #include <string>
 
 #include "Runtime/CFactoryMgr.hpp"
+#include "Runtime/CMappedFile.hpp"
 #include "Runtime/CToken.hpp"
 #include "Runtime/Streams/IOStreams.hpp"
 #include "Runtime/IObj.hpp"
@@ -15,6 +16,9 @@ namespace metaforce {
 
 class CAudioGroupSet {
   std::unique_ptr<u8[]> m_buffer;
+  /* Metaforce addition: set instead of m_buffer when built in place from a mapped PAK; m_bytes points into one */
+  SMappedView m_view;
+  const u8* m_bytes = nullptr;
   std::string x10_baseName;
   std::string x20_name;
   amuse::AudioGroupData m_data;
@@ -22,11 +26,14 @@ class CAudioGroupSet {
 
 public:
   explicit CAudioGroupSet(std::unique_ptr<u8[]>&& in);
+  explicit CAudioGroupSet(const SMappedView& view);
   const amuse::AudioGroupData& GetAudioGroupData() const { return m_data; }
   std::string_view GetName() const { return x20_name; }
 };
 
 CFactoryFnReturn FAudioGroupSetDataFactory(const metaforce::SObjectTag& tag, std::unique_ptr<u8[]>&& in, u32 len,
                                            const metaforce::CVParamTransfer& vparms, CObjectReference* selfRef);
+CFactoryFnReturn FAudioGroupSetDataViewFactory(const metaforce::SObjectTag& tag, const metaforce::SMappedView& view,
+                                               const metaforce::CVParamTransfer& vparms, CObjectReference* selfRef);
 
 } // namespace metaforce
@@ -19,6 +19,7 @@ CStaticAudioPlayer::CStaticAudioPlayer(boo::IAudioVoiceEngine& engine, std::stri
   // x30_dmaRight.reset(new u8[640]);
 
   CDvdFile file(path);
+  file.SetPriority(EDvdPriority::AudioStream);
   x10_rsfRem = file.Length();
   x14_rsfLength = x10_rsfRem;
 
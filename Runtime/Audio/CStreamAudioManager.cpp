@@ -404,6 +404,7 @@ struct SDSPStream : boo::IAudioVoiceCallback {
   void AllocateStream(const SDSPStreamInfo& info, float vol, float left, float right) {
     x10_info = info;
     m_file.emplace(x10_info.x0_fileName);
+    m_file->SetPriority(EDvdPriority::AudioStream);
     if (!xd4_ringBuffer) {
       DoAllocateStream();
     }
@@ -0,0 +1,101 @@
+#include "Runtime/CAssetIndex.hpp"
+
+#include <algorithm>
+#include <bit>
+
+namespace metaforce {
+namespace {
+constexpr u32 MinCapacity = 1024;
+} // namespace
+
+u32 CAssetIndex::SlotFor(u64 id) const {
+  // Fibonacci hashing; asset ids are not uniformly distributed in their low bits
+  return u32((id * 0x9E3779B97F4A7C15ull) >> m_shift);
+}
+
+void CAssetIndex::Grow() {
+  const u32 newCapacity = std::max(MinCapacity, u32(m_slots.size()) * 2);
+  std::vector<SSlot> oldSlots(newCapacity);
+  std::swap(oldSlots, m_slots);
+  m_shift = 64 - std::countr_zero(newCapacity);
+
+  const u32 mask = newCapacity - 1;
+  for (const SSlot& oldSlot : oldSlots) {
+    if (oldSlot.x0_id == EmptySlot) {
+      continue;
+    }
+    u32 slot = SlotFor(oldSlot.x0_id);
+    while (m_slots[slot].x0_id != EmptySlot) {
+      slot = (slot + 1) & mask;
+    }
+    m_slots[slot] = oldSlot;
+  }
+}
+
+void CAssetIndex::AddPak(CPakFile& pak) {
+  const std::vector<CPakFile::SResInfo>& resList = pak.x74_resList;
+  // Keep the load factor at or below one half so probe sequences stay short and always end on an empty slot
+  while ((m_assetCount + resList.size()) * 2 > m_slots.size()) {
+    Grow();
+  }
+
+  const bool override = pak.IsOverridePak();
+  const u32 mask = u32(m_slots.size()) - 1;
+  for (auto it = resList.cbegin(); it != resList.cend();) {
+    // The table is sorted by id, so copies within one PAK are adjacent
+    const CAssetId id = it->GetId();
+    const auto runEnd = std::find_if(it + 1, resList.cend(), [id](const auto& info) { return info.GetId() != id; });
+    if (!id.IsValid()) {
+      it = runEnd;
+      continue;
+    }
+
+    const u32 entryIdx = u32(m_entries.size());
+    m_entries.push_back({&pak, &*it, InvalidEntry, runEnd - it > 1});
+    it = runEnd;
+
+    u32 slot = SlotFor(id.Value());
+    while (m_slots[slot].x0_id != EmptySlot && m_slots[slot].x0_id != id.Value()) {
+      slot = (slot + 1) & mask;
+    }
+    if (m_slots[slot].x0_id == EmptySlot) {
+      m_slots[slot] = {id.Value(), entryIdx};
+      ++m_assetCount;
+      continue;
+    }
+
+    // Override PAKs go after earlier overrides but ahead of every regular PAK
+    u32* link = &m_slots[slot].x8_entry;
+    while (*link != InvalidEntry && (!override || m_entries[*link].x0_pak->IsOverridePak())) {
+      link = &m_entries[*link].x10_next;
+    }
+    m_entries[entryIdx].x10_next = *link;
+    *link = entryIdx;
+  }
+}
+
+void CAssetIndex::Clear() {
+  m_slots.clear();
+  m_entries.clear();
+  m_assetCount = 0;
+  m_shift = 64;
+}
+
+const CAssetIndex::SEntry* CAssetIndex::Find(CAssetId id) const {
+  if (m_slots.empty() || !id.IsValid()) {
+    return nullptr;
+  }
+  const u64 value = id.Value();
+  const u32 mask = u32(m_slots.size()) - 1;
+  for (u32 slot = SlotFor(value);; slot = (slot + 1) & mask) {
+    const SSlot& test = m_slots[slot];
+    if (test.x0_id == value) {
+      return &m_entries[test.x8_entry];
+    }
+    if (test.x0_id == EmptySlot) {
+      return nullptr;
+    }
+  }
+}
+
+} // namespace metaforce
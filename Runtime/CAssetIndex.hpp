@@ -0,0 +1,54 @@
+#pragma once
+
+#include <vector>
+
+#include "Runtime/CPakFile.hpp"
+#include "Runtime/RetroTypes.hpp"
+
+namespace metaforce {
+
+/* Open-addressed CAssetId -> resource entry table covering every loaded PAK, so CResLoader can resolve an asset
+ * with one probe sequence instead of a binary search per PAK.
+ * An asset present in several PAKs gets a chain of entries: override PAKs first, then regular PAKs, each group in the
+ * order the PAKs finished loading. That is the same precedence the per-PAK walk used. */
+class CAssetIndex {
+public:
+  struct SEntry {
+    CPakFile* x0_pak;
+    const CPakFile::SResInfo* x8_info;
+    u32 x10_next;      /* Index of the next PAK holding this asset, or InvalidEntry */
+    bool x14_dupInPak; /* The PAK itself has more than one copy; let it choose by seek position */
+  };
+
+private:
+  static constexpr u32 InvalidEntry = UINT32_MAX;
+  static constexpr u64 EmptySlot = UINT64_MAX; /* Same bit pattern as an invalid CAssetId */
+
+  struct SSlot {
+    u64 x0_id = EmptySlot;
+    u32 x8_entry = InvalidEntry;
+  };
+
+  std::vector<SSlot> m_slots;
+  std::vector<SEntry> m_entries;
+  u32 m_assetCount = 0;
+  u32 m_shift = 64;
+
+  u32 SlotFor(u64 id) const;
+  void Grow();
+
+public:
+  void AddPak(CPakFile& pak);
+  void Clear();
+
+  const SEntry* Find(CAssetId id) const;
+  const SEntry* GetNext(const SEntry& entry) const {
+    return entry.x10_next == InvalidEntry ? nullptr : &m_entries[entry.x10_next];
+  }
+
+  u32 GetAssetCount() const { return m_assetCount; }
+  u32 GetEntryCount() const { return u32(m_entries.size()); }
+  u32 GetCapacity() const { return u32(m_slots.size()); }
+};
+
+} // namespace metaforce
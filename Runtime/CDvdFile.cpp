@@ -1,5 +1,7 @@
 #include "Runtime/CDvdFile.hpp"
 
+#include <cstring>
+
 #include <optick.h>
 
 #include "Runtime/CDvdRequest.hpp"
@@ -10,129 +12,168 @@ namespace metaforce {
 std::unique_ptr<nod::DiscBase> CDvdFile::m_DvdRoot;
 // std::unordered_map<std::string, std::string> CDvdFile::m_caseInsensitiveMap;
 
-class CFileDvdRequest : public IDvdRequest {
+class CFileDvdRequest : public IDvdRequest, public std::enable_shared_from_this<CFileDvdRequest> {
+  friend class CDvdFile;
+  enum class EState { Pending, InProgress, Complete, Cancelled };
+
   std::shared_ptr<nod::IPartReadStream> m_reader;
-  uint64_t m_begin;
-  uint64_t m_size;
+  uint64_t m_offset; // Absolute offset within the data partition
 
   void* m_buf;
   u32 m_len;
-  ESeekOrigin m_whence;
-  int m_offset;
+  EDvdPriority m_priority;
+  std::chrono::steady_clock::time_point m_queueTime;
+  std::chrono::steady_clock::time_point m_startTime;
+  std::chrono::steady_clock::time_point m_endTime;
 
 #ifdef HAS_DVD_THREAD
-  std::atomic_bool m_cancel = {false};
-  std::atomic_bool m_complete = {false};
+  std::atomic<EState> m_state = {EState::Pending};
 #else
-  bool m_cancel = false;
-  bool m_complete = false;
+  EState m_state = EState::Pending;
 #endif
   std::function<void(u32)> m_callback;
+  std::function<void()> m_completion; // Guarded by CDvdFile::m_CompletionMutex
+
+  EState GetState() const {
+#ifdef HAS_DVD_THREAD
+    return m_state.load();
+#else
+    return m_state;
+#endif
+  }
+
+  void SetState(EState state) {
+#ifdef HAS_DVD_THREAD
+    m_state.store(state);
+    m_state.notify_all();
+#else
+    m_state = state;
+#endif
+  }
+
+  bool TryBegin() {
+#ifdef HAS_DVD_THREAD
+    EState expected = EState::Pending;
+    return m_state.compare_exchange_strong(expected, EState::InProgress);
+#else
+    if (m_state != EState::Pending) {
+      return false;
+    }
+    m_state = EState::InProgress;
+    return true;
+#endif
+  }
+
+#ifdef HAS_DVD_THREAD
+  /* Blocks on the state word until it leaves `from` (futex-backed where the platform provides it) */
+  void WaitWhile(EState from) const {
+    while (m_state.load() == from) {
+      m_state.wait(from);
+    }
+  }
+#endif
 
 public:
   ~CFileDvdRequest() override { CFileDvdRequest::PostCancelRequest(); }
 
   void WaitUntilComplete() override {
+    // Waiting on a request this thread is still holding back would never finish
+    CDvdFile::FlushBatch();
 #ifdef HAS_DVD_THREAD
-    while (!m_complete.load() && !m_cancel.load()) {
-      std::unique_lock lk{CDvdFile::m_WaitMutex};
-    }
+    WaitWhile(EState::Pending);
+    WaitWhile(EState::InProgress);
 #else
-    if (!m_complete && !m_cancel) {
+    if (GetState() == EState::Pending) {
       CDvdFile::DoWork();
     }
 #endif
   }
   bool IsComplete() override {
-#ifdef HAS_DVD_THREAD
-    return m_complete.load();
-#else
-    if (!m_complete) {
+#ifndef HAS_DVD_THREAD
+    if (GetState() == EState::Pending) {
+      CDvdFile::FlushBatch();
       CDvdFile::DoWork();
     }
-    return m_complete;
 #endif
+    return GetState() == EState::Complete;
   }
   void PostCancelRequest() override {
 #ifdef HAS_DVD_THREAD
-    if (m_complete.load() || m_cancel.load()) {
+    EState expected = EState::Pending;
+    if (m_state.compare_exchange_strong(expected, EState::Cancelled)) {
+      m_state.notify_all();
       return;
     }
-    std::unique_lock waitlk{CDvdFile::m_WaitMutex};
-    m_cancel.store(true);
+    // A worker is filling our buffer; the caller may free it as soon as we return
+    WaitWhile(EState::InProgress);
 #else
-    m_cancel = true;
+    if (m_state == EState::Pending) {
+      m_state = EState::Cancelled;
+    }
 #endif
   }
+  void PostCompletion(std::function<void()>&& cb) override {
+    std::unique_lock lk{CDvdFile::m_CompletionMutex};
+    m_completion = std::move(cb);
+    if (GetState() == EState::Complete) {
+      CDvdFile::m_CompletionQueue.push_back(weak_from_this());
+    }
+  }
 
   [[nodiscard]] EMediaType GetMediaType() const override { return EMediaType::File; }
+  std::chrono::nanoseconds GetQueueWait() const override { return m_startTime - m_queueTime; }
+  std::chrono::nanoseconds GetReadTime() const override { return m_endTime - m_startTime; }
 
-  CFileDvdRequest(CDvdFile& file, void* buf, u32 len, ESeekOrigin whence, int off, std::function<void(u32)>&& cb)
+  CFileDvdRequest(CDvdFile& file, void* buf, u32 len, uint64_t offset, EDvdPriority priority,
+                  std::function<void(u32)>&& cb)
   : m_reader(file.m_reader)
-  , m_begin(file.m_begin)
-  , m_size(file.m_size)
+  , m_offset(file.m_begin + offset)
   , m_buf(buf)
   , m_len(len)
-  , m_whence(whence)
-  , m_offset(off)
+  , m_priority(priority)
+  , m_queueTime(std::chrono::steady_clock::now())
   , m_callback(std::move(cb)) {}
 
-  void DoRequest() {
-#ifdef HAS_DVD_THREAD
-    if (m_cancel.load()) {
-      return;
-    }
-#else
-    if (m_cancel) {
-      return;
-    }
-#endif
-    u32 readLen = 0;
-    if (m_whence == ESeekOrigin::Cur && m_offset == 0) {
-      readLen = m_reader->read(m_buf, m_len);
-    } else {
-      int seek = 0;
-      int64_t offset = m_offset;
-      switch (m_whence) {
-      case ESeekOrigin::Begin: {
-        seek = SEEK_SET;
-        offset += int64_t(m_begin);
-        break;
-      }
-      case ESeekOrigin::End: {
-        seek = SEEK_SET;
-        offset += int64_t(m_begin) + int64_t(m_size);
-        break;
-      }
-      case ESeekOrigin::Cur: {
-        seek = SEEK_CUR;
-        break;
-      }
-      };
-      m_reader->seek(offset, seek);
-      readLen = m_reader->read(m_buf, m_len);
+  /* Called with the request already in the InProgress state. Coalesced requests skip the seek when
+   * the previous read left the stream at our offset. */
+  void DoRequest(bool seek) {
+    m_startTime = std::chrono::steady_clock::now();
+    if (seek) {
+      m_reader->seek(int64_t(m_offset), SEEK_SET);
     }
+    const u32 readLen = m_reader->read(m_buf, m_len);
+    m_endTime = std::chrono::steady_clock::now();
     if (m_callback) {
       m_callback(readLen);
     }
-#ifdef HAS_DVD_THREAD
-    m_complete.store(true);
-#else
-    m_complete = true;
-#endif
+    std::unique_lock lk{CDvdFile::m_CompletionMutex};
+    SetState(EState::Complete);
+    if (m_completion) {
+      CDvdFile::m_CompletionQueue.push_back(weak_from_this());
+    }
   }
 };
 
 #ifdef HAS_DVD_THREAD
-std::thread CDvdFile::m_WorkerThread;
-std::mutex CDvdFile::m_WorkerMutex;
+std::vector<std::thread> CDvdFile::m_WorkerThreads;
 std::condition_variable CDvdFile::m_WorkerCV;
-std::mutex CDvdFile::m_WaitMutex;
+std::condition_variable CDvdFile::m_ReaderCV;
 std::atomic_bool CDvdFile::m_WorkerRun = {false};
 #endif
-std::vector<std::shared_ptr<IDvdRequest>> CDvdFile::m_RequestQueue;
+std::mutex CDvdFile::m_WorkerMutex;
+std::mutex CDvdFile::m_CompletionMutex;
+std::vector<std::weak_ptr<CFileDvdRequest>> CDvdFile::m_CompletionQueue;
+u32 CDvdFile::m_WorkerCount = 1;
+std::array<CDvdFile::RequestQueue, size_t(EDvdPriority::MAX)> CDvdFile::m_RequestQueues;
+std::array<u64, size_t(EDvdPriority::MAX)> CDvdFile::m_ElevatorHeads{};
+std::array<SDvdQueueStats, size_t(EDvdPriority::MAX)> CDvdFile::m_QueueStats;
+std::vector<const nod::IPartReadStream*> CDvdFile::m_BusyReaders;
+thread_local u32 CDvdFile::t_BatchDepth = 0;
+thread_local CDvdFile::RequestQueue CDvdFile::t_BatchRequests;
 std::string CDvdFile::m_rootDirectory;
 std::unique_ptr<u8[]> CDvdFile::m_dolBuf;
+bool CDvdFile::m_MemoryMapEnabled = true;
+std::shared_ptr<CMappedFile> CDvdFile::m_MappedImage;
 
 CDvdFile::CDvdFile(std::string_view path) : x18_path(path) {
   auto* node = ResolvePath(path);
@@ -140,16 +181,171 @@ CDvdFile::CDvdFile(std::string_view path) : x18_path(path) {
     m_reader = node->beginReadStream();
     m_begin = m_reader->position();
     m_size = node->size();
+    // MapDiscImage already checked that partition offsets are image offsets
+    if (m_MappedImage && m_begin + m_size <= m_MappedImage->GetSize()) {
+      m_mapping = m_MappedImage;
+    }
+  }
+}
+
+uint64_t CDvdFile::ResolveOffset(ESeekOrigin whence, int off) const {
+  switch (whence) {
+  case ESeekOrigin::Begin:
+    return uint64_t(off);
+  case ESeekOrigin::End:
+    return uint64_t(int64_t(m_size) + off);
+  case ESeekOrigin::Cur:
+  default:
+    return uint64_t(int64_t(m_filePos) + off);
+  }
+}
+
+bool CDvdFile::IsReaderBusy(const nod::IPartReadStream* reader) {
+  return std::find(m_BusyReaders.cbegin(), m_BusyReaders.cend(), reader) != m_BusyReaders.cend();
+}
+
+void CDvdFile::ReleaseReader(const nod::IPartReadStream* reader) {
+  const auto search = std::find(m_BusyReaders.begin(), m_BusyReaders.end(), reader);
+  if (search != m_BusyReaders.end()) {
+    *search = m_BusyReaders.back();
+    m_BusyReaders.pop_back();
+  }
+}
+
+// Must be called with m_WorkerMutex held
+void CDvdFile::EnqueueRequest(std::shared_ptr<CFileDvdRequest> req) {
+  const size_t cls = size_t(req->m_priority);
+  RequestQueue& queue = m_RequestQueues[cls];
+  const auto it = std::upper_bound(queue.begin(), queue.end(), req->m_offset,
+                                   [](u64 offset, const auto& other) { return offset < other->m_offset; });
+  queue.insert(it, std::move(req));
+  SDvdQueueStats& stats = m_QueueStats[cls];
+  stats.queueDepth = u32(queue.size());
+  stats.maxQueueDepth = std::max(stats.maxQueueDepth, stats.queueDepth);
+}
+
+void CDvdFile::RaisePriority(const std::shared_ptr<IDvdRequest>& req, EDvdPriority priority) {
+  if (!req || req->GetMediaType() != IDvdRequest::EMediaType::File) {
+    return;
+  }
+  auto fileReq = std::static_pointer_cast<CFileDvdRequest>(req);
+  if (std::find(t_BatchRequests.cbegin(), t_BatchRequests.cend(), fileReq) != t_BatchRequests.cend()) {
+    fileReq->m_priority = std::min(fileReq->m_priority, priority);
+    return;
+  }
+  std::unique_lock lk{m_WorkerMutex};
+  if (fileReq->GetState() != CFileDvdRequest::EState::Pending || fileReq->m_priority <= priority) {
+    return;
+  }
+  const size_t cls = size_t(fileReq->m_priority);
+  RequestQueue& queue = m_RequestQueues[cls];
+  const auto search = std::find(queue.begin(), queue.end(), fileReq);
+  if (search == queue.end()) {
+    return;
+  }
+  queue.erase(search);
+  m_QueueStats[cls].queueDepth = u32(queue.size());
+  fileReq->m_priority = priority;
+  EnqueueRequest(std::move(fileReq));
+}
+
+// Must be called with m_WorkerMutex held.
+// Picks the highest-priority class that has a request on an idle reader, then takes the next request in
+// elevator order plus any requests that continue it contiguously on the same reader.
+bool CDvdFile::TakeBatch(RequestQueue& batchOut) {
+  for (size_t cls = 0; cls < m_RequestQueues.size(); ++cls) {
+    RequestQueue& queue = m_RequestQueues[cls];
+    // Drop cancelled requests up front so they never occupy a reader
+    std::erase_if(queue, [](const auto& req) { return req->GetState() == CFileDvdRequest::EState::Cancelled; });
+    m_QueueStats[cls].queueDepth = u32(queue.size());
+    if (queue.empty()) {
+      continue;
+    }
+
+    const auto headIt = std::lower_bound(queue.begin(), queue.end(), m_ElevatorHeads[cls],
+                                         [](const auto& req, u64 offset) { return req->m_offset < offset; });
+    auto pick = queue.end();
+    for (auto it = headIt; it != queue.end(); ++it) {
+      if (!IsReaderBusy((*it)->m_reader.get())) {
+        pick = it;
+        break;
+      }
+    }
+    if (pick == queue.end()) {
+      // Wrap around to the lowest offset
+      for (auto it = queue.begin(); it != headIt; ++it) {
+        if (!IsReaderBusy((*it)->m_reader.get())) {
+          pick = it;
+          break;
+        }
+      }
+    }
+    if (pick == queue.end()) {
+      continue;
+    }
+
+    const nod::IPartReadStream* reader = (*pick)->m_reader.get();
+    auto last = pick + 1;
+    u64 nextOffset = (*pick)->m_offset + (*pick)->m_len;
+    while (last != queue.end() && (*last)->m_reader.get() == reader && (*last)->m_offset == nextOffset) {
+      nextOffset += (*last)->m_len;
+      ++last;
+    }
+
+    batchOut.assign(std::make_move_iterator(pick), std::make_move_iterator(last));
+    queue.erase(pick, last);
+    m_ElevatorHeads[cls] = nextOffset;
+    m_BusyReaders.push_back(reader);
+    m_QueueStats[cls].queueDepth = u32(queue.size());
+    m_QueueStats[cls].coalesced += u32(batchOut.size() - 1);
+    return true;
+  }
+  return false;
+}
+
+// Called without m_WorkerMutex held; returns with the batch's reader released
+void CDvdFile::ProcessBatch(RequestQueue& batch) {
+  bool seek = true;
+  for (std::shared_ptr<CFileDvdRequest>& req : batch) {
+    if (!req->TryBegin()) {
+      // Cancelled after being picked; the next read needs its own seek
+      seek = true;
+      continue;
+    }
+    req->DoRequest(seek);
+    seek = false;
+  }
+
+  const auto now = std::chrono::steady_clock::now();
+  std::unique_lock lk{m_WorkerMutex};
+  ReleaseReader(batch.front()->m_reader.get());
+  SDvdQueueStats& stats = m_QueueStats[size_t(batch.front()->m_priority)];
+  for (const std::shared_ptr<CFileDvdRequest>& req : batch) {
+    if (req->GetState() != CFileDvdRequest::EState::Complete) {
+      continue;
+    }
+    const auto latency = std::chrono::duration_cast<std::chrono::microseconds>(now - req->m_queueTime);
+    stats.maxLatency = std::max(stats.maxLatency, latency);
+    stats.avgLatency = stats.avgLatency.count() == 0 ? latency : (stats.avgLatency * 7 + latency) / 8;
+    ++stats.completed;
   }
+  lk.unlock();
+  batch.clear();
+#ifdef HAS_DVD_THREAD
+  m_ReaderCV.notify_all();
+  m_WorkerCV.notify_all();
+#endif
 }
 
 // single-threaded hack
 void CDvdFile::DoWork() {
-  for (std::shared_ptr<IDvdRequest>& req : m_RequestQueue) {
-    auto& concreteReq = static_cast<CFileDvdRequest&>(*req);
-    concreteReq.DoRequest();
+  RequestQueue batch;
+  std::unique_lock lk{m_WorkerMutex};
+  while (TakeBatch(batch)) {
+    lk.unlock();
+    ProcessBatch(batch);
+    lk.lock();
   }
-  m_RequestQueue.clear();
 }
 
 void CDvdFile::WorkerProc() {
@@ -157,23 +353,14 @@ void CDvdFile::WorkerProc() {
   logvisor::RegisterThreadName("CDvdFile");
   OPTICK_THREAD("CDvdFile");
 
+  RequestQueue batch;
+  std::unique_lock lk{m_WorkerMutex};
   while (m_WorkerRun.load()) {
-    std::unique_lock lk{m_WorkerMutex};
-    while (!m_RequestQueue.empty()) {
-      std::vector<std::shared_ptr<IDvdRequest>> swapQueue;
-      swapQueue.swap(m_RequestQueue);
+    if (TakeBatch(batch)) {
       lk.unlock();
-      std::unique_lock waitlk{m_WaitMutex};
-      for (std::shared_ptr<IDvdRequest>& req : swapQueue) {
-        auto& concreteReq = static_cast<CFileDvdRequest&>(*req);
-        concreteReq.DoRequest();
-      }
-      waitlk.unlock();
-      swapQueue.clear();
+      ProcessBatch(batch);
       lk.lock();
-    }
-    if (!m_WorkerRun.load()) {
-      break;
+      continue;
     }
     m_WorkerCV.wait(lk);
   }
@@ -181,39 +368,107 @@ void CDvdFile::WorkerProc() {
 }
 
 std::shared_ptr<IDvdRequest> CDvdFile::AsyncSeekRead(void* buf, u32 len, ESeekOrigin whence, int off,
-                                                     std::function<void(u32)>&& cb) {
-  std::shared_ptr<IDvdRequest> ret = std::make_shared<CFileDvdRequest>(*this, buf, len, whence, off, std::move(cb));
-#ifdef HAS_DVD_THREAD
-  std::unique_lock lk{m_WorkerMutex};
-#endif
-  m_RequestQueue.emplace_back(ret);
+                                                     std::function<void(u32)>&& cb, EDvdPriority priority) {
+  const uint64_t offset = ResolveOffset(whence, off);
+  m_filePos = offset + len;
+  auto ret = std::make_shared<CFileDvdRequest>(*this, buf, len, offset, priority, std::move(cb));
+  if (t_BatchDepth != 0) {
+    t_BatchRequests.push_back(ret);
+    return ret;
+  }
+  {
+    std::unique_lock lk{m_WorkerMutex};
+    EnqueueRequest(ret);
+  }
 #ifdef HAS_DVD_THREAD
-  lk.unlock();
   m_WorkerCV.notify_one();
 #endif
   return ret;
 }
 
+void CDvdFile::FlushBatch() {
+  if (t_BatchRequests.empty()) {
+    return;
+  }
+  {
+    std::unique_lock lk{m_WorkerMutex};
+    for (std::shared_ptr<CFileDvdRequest>& req : t_BatchRequests) {
+      EnqueueRequest(std::move(req));
+    }
+  }
+  t_BatchRequests.clear();
+#ifdef HAS_DVD_THREAD
+  m_WorkerCV.notify_all();
+#endif
+}
+
+void CDvdFile::EndBatch() {
+  if (t_BatchDepth != 0 && --t_BatchDepth == 0) {
+    FlushBatch();
+  }
+}
+
 u32 CDvdFile::SyncSeekRead(void* buf, u32 len, ESeekOrigin whence, int offset) {
-  int seek = 0;
-  switch (whence) {
-  case ESeekOrigin::Begin: {
-    seek = SEEK_SET;
-    offset += int64_t(m_begin);
-    break;
-  }
-  case ESeekOrigin::End: {
-    seek = SEEK_SET;
-    offset += int64_t(m_begin) + int64_t(m_size);
-    break;
-  }
-  case ESeekOrigin::Cur: {
-    seek = SEEK_CUR;
-    break;
-  }
-  };
-  m_reader->seek(offset, seek);
-  return m_reader->read(buf, len);
+  const uint64_t fileOffset = ResolveOffset(whence, offset);
+  m_filePos = fileOffset + len;
+  // Synchronous reads share the nod stream with the workers; take exclusive ownership of it first
+  std::unique_lock lk{m_WorkerMutex};
+#ifdef HAS_DVD_THREAD
+  m_ReaderCV.wait(lk, [this]() { return !IsReaderBusy(m_reader.get()); });
+#endif
+  m_BusyReaders.push_back(m_reader.get());
+  lk.unlock();
+
+  m_reader->seek(int64_t(m_begin + fileOffset), SEEK_SET);
+  const u32 readLen = m_reader->read(buf, len);
+
+  lk.lock();
+  ReleaseReader(m_reader.get());
+  lk.unlock();
+#ifdef HAS_DVD_THREAD
+  m_ReaderCV.notify_all();
+  m_WorkerCV.notify_all();
+#endif
+  return readLen;
+}
+
+void CDvdFile::DispatchCompletions() {
+  std::vector<std::weak_ptr<CFileDvdRequest>> completions;
+  {
+    std::unique_lock lk{m_CompletionMutex};
+    completions.swap(m_CompletionQueue);
+  }
+  for (const std::weak_ptr<CFileDvdRequest>& weak : completions) {
+    // Owners that dropped their request since it completed no longer want the callback
+    const std::shared_ptr<CFileDvdRequest> req = weak.lock();
+    if (!req) {
+      continue;
+    }
+    std::function<void()> cb;
+    {
+      std::unique_lock lk{m_CompletionMutex};
+      cb = std::move(req->m_completion);
+      req->m_completion = {};
+    }
+    if (cb) {
+      cb();
+    }
+  }
+}
+
+SDvdQueueStats CDvdFile::GetQueueStats(EDvdPriority priority) {
+  std::unique_lock lk{m_WorkerMutex};
+  return m_QueueStats[size_t(priority)];
+}
+
+void CDvdFile::ResetQueueStats() {
+  std::unique_lock lk{m_WorkerMutex};
+  for (SDvdQueueStats& stats : m_QueueStats) {
+    stats.maxQueueDepth = stats.queueDepth;
+    stats.completed = 0;
+    stats.coalesced = 0;
+    stats.maxLatency = {};
+  }
 }
 
 nod::Node* CDvdFile::ResolvePath(std::string_view path) {
@@ -256,6 +511,37 @@ nod::Node* CDvdFile::ResolvePath(std::string_view path) {
   return node;
 }
 
+void CDvdFile::MapDiscImage(std::string_view path) {
+  m_MappedImage.reset();
+  if (!m_MemoryMapEnabled) {
+    return;
+  }
+  auto mapping = CMappedFile::Open(path);
+  if (!mapping || mapping->GetSize() < 0x20) {
+    return;
+  }
+  // Only raw GameCube images store partition data verbatim; compressed and Wii formats must go through nod
+  constexpr std::array<u8, 4> GCNMagic{0xC2, 0x33, 0x9F, 0x3D};
+  if (std::memcmp(mapping->GetData() + 0x1C, GCNMagic.data(), GCNMagic.size()) != 0) {
+    return;
+  }
+  // Cross-check once against the DOL nod already read, so opening a file never has to read from disc to trust its
+  // offset into the mapping
+  constexpr u32 DolOffsetPos = 0x420;
+  constexpr u32 CheckLen = 32;
+  if (!m_dolBuf || mapping->GetSize() < DolOffsetPos + 4) {
+    return;
+  }
+  u32 dolOffset = 0;
+  std::memcpy(&dolOffset, mapping->GetData() + DolOffsetPos, sizeof(dolOffset));
+  dolOffset = SBig(dolOffset);
+  if (u64(dolOffset) + CheckLen > mapping->GetSize() ||
+      std::memcmp(mapping->GetData() + dolOffset, m_dolBuf.get(), CheckLen) != 0) {
+    return;
+  }
+  m_MappedImage = std::move(mapping);
+}
+
 bool CDvdFile::Initialize(const std::string_view& path) {
 #ifdef HAS_DVD_THREAD
   if (m_WorkerRun.load()) {
@@ -267,9 +553,13 @@ bool CDvdFile::Initialize(const std::string_view& path) {
     return false;
   }
   m_dolBuf = m_DvdRoot->getDataPartition()->getDOLBuf();
+  MapDiscImage(path);
 #ifdef HAS_DVD_THREAD
   m_WorkerRun.store(true);
-  m_WorkerThread = std::thread(WorkerProc);
+  m_WorkerThreads.reserve(m_WorkerCount);
+  for (u32 i = 0; i < m_WorkerCount; ++i) {
+    m_WorkerThreads.emplace_back(WorkerProc);
+  }
 #endif
   return true;
 }
@@ -279,13 +569,34 @@ void CDvdFile::Shutdown() {
   if (!m_WorkerRun.load()) {
     return;
   }
-  m_WorkerRun.store(false);
-  m_WorkerCV.notify_one();
-  if (m_WorkerThread.joinable()) {
-    m_WorkerThread.join();
+  {
+    std::unique_lock lk{m_WorkerMutex};
+    m_WorkerRun.store(false);
   }
+  m_WorkerCV.notify_all();
+  for (std::thread& thread : m_WorkerThreads) {
+    if (thread.joinable()) {
+      thread.join();
+    }
+  }
+  m_WorkerThreads.clear();
 #endif
-  m_RequestQueue.clear();
+  std::unique_lock lk{m_WorkerMutex};
+  for (RequestQueue& queue : m_RequestQueues) {
+    // Nothing will service these anymore; make sure waiters don't hang on them
+    for (const std::shared_ptr<CFileDvdRequest>& req : queue) {
+      req->PostCancelRequest();
+    }
+    queue.clear();
+  }
+  m_BusyReaders.clear();
+  lk.unlock();
+
+  // Open files keep their own reference to the mapping
+  m_MappedImage.reset();
+
+  std::unique_lock completionLk{m_CompletionMutex};
+  m_CompletionQueue.clear();
 }
 
 SDiscInfo CDvdFile::DiscInfo() {
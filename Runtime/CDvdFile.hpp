@@ -1,13 +1,19 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
 #include <unordered_map>
+#include <vector>
 
+#include "Runtime/CMappedFile.hpp"
 #include "Runtime/GCNTypes.hpp"
 #include "Runtime/RetroTypes.hpp"
 
@@ -23,8 +29,22 @@ namespace metaforce {
 
 enum class ESeekOrigin { Begin = 0, Cur = 1, End = 2 };
 
+/* Scheduling classes for async reads, highest priority first.
+ * Within a class, requests are serviced in elevator order by disc offset. */
+enum class EDvdPriority { AudioStream = 0, Movie = 1, AreaData = 2, Prefetch = 3, MAX };
+
 struct DVDFileInfo;
 class IDvdRequest;
+class CFileDvdRequest;
+
+struct SDvdQueueStats {
+  u32 queueDepth = 0;
+  u32 maxQueueDepth = 0;
+  u32 completed = 0;
+  u32 coalesced = 0;
+  std::chrono::microseconds maxLatency{};
+  std::chrono::microseconds avgLatency{}; // Moving average, not cleared by ResetQueueStats
+};
 
 struct SDiscInfo {
   std::array<char, 6> gameId;
@@ -35,27 +55,49 @@ struct SDiscInfo {
 class CDvdFile {
   friend class CResLoader;
   friend class CFileDvdRequest;
+  using RequestQueue = std::vector<std::shared_ptr<CFileDvdRequest>>;
   static std::unique_ptr<nod::DiscBase> m_DvdRoot;
   //  static std::unordered_map<std::string, std::string> m_caseInsensitiveMap;
 #ifdef HAS_DVD_THREAD
-  static std::thread m_WorkerThread;
-  static std::mutex m_WorkerMutex;
+  static std::vector<std::thread> m_WorkerThreads;
   static std::condition_variable m_WorkerCV;
-  static std::mutex m_WaitMutex;
+  static std::condition_variable m_ReaderCV;
   static std::atomic_bool m_WorkerRun;
 #endif
-  static std::vector<std::shared_ptr<IDvdRequest>> m_RequestQueue;
+  static std::mutex m_WorkerMutex;
+  static std::mutex m_CompletionMutex;
+  static std::vector<std::weak_ptr<CFileDvdRequest>> m_CompletionQueue;
+  static u32 m_WorkerCount;
+  static std::array<RequestQueue, size_t(EDvdPriority::MAX)> m_RequestQueues;
+  static std::array<u64, size_t(EDvdPriority::MAX)> m_ElevatorHeads;
+  static std::array<SDvdQueueStats, size_t(EDvdPriority::MAX)> m_QueueStats;
+  static std::vector<const nod::IPartReadStream*> m_BusyReaders;
+  static thread_local u32 t_BatchDepth;
+  static thread_local RequestQueue t_BatchRequests;
   static std::string m_rootDirectory;
   static std::unique_ptr<u8[]> m_dolBuf;
+  static bool m_MemoryMapEnabled;
+  static std::shared_ptr<CMappedFile> m_MappedImage;
+  static void MapDiscImage(std::string_view path);
   static void WorkerProc();
+  static bool TakeBatch(RequestQueue& batchOut);
+  static void ProcessBatch(RequestQueue& batch);
+  static void EnqueueRequest(std::shared_ptr<CFileDvdRequest> req);
+  static bool IsReaderBusy(const nod::IPartReadStream* reader);
+  static void ReleaseReader(const nod::IPartReadStream* reader);
+  static void FlushBatch();
 
   std::string x18_path;
   std::shared_ptr<nod::IPartReadStream> m_reader;
-  uint64_t m_begin;
-  uint64_t m_size;
+  uint64_t m_begin = 0;
+  uint64_t m_size = 0;
+  uint64_t m_filePos = 0;
+  EDvdPriority m_priority = EDvdPriority::AreaData;
+  std::shared_ptr<CMappedFile> m_mapping;
 
   static nod::Node* ResolvePath(std::string_view path);
   //  static void RecursiveBuildCaseInsensitiveMap(const hecl::ProjectPath& path, std::string::size_type prefixLen);
+  uint64_t ResolveOffset(ESeekOrigin whence, int off) const;
 
 public:
   static bool Initialize(const std::string_view& path);
@@ -64,23 +106,54 @@ public:
   static void Shutdown();
   static u8* GetDolBuf() { return m_dolBuf.get(); }
   static void DoWork();
+  /* Runs completion callbacks registered through IDvdRequest::PostCompletion; call from the game thread */
+  static void DispatchCompletions();
+  /* Number of DVD worker threads; takes effect on the next Initialize */
+  static void SetWorkerCount(u32 count) { m_WorkerCount = std::max(1u, count); }
+  /* Map raw GameCube images into memory on the next Initialize so files can be read without going through nod */
+  static void SetMemoryMapEnabled(bool enabled) { m_MemoryMapEnabled = enabled; }
+  static bool IsDiscImageMapped() { return m_MappedImage.operator bool(); }
+  static SDvdQueueStats GetQueueStats(EDvdPriority priority);
+  static void ResetQueueStats();
+  /* Moves a still-queued request into a more urgent class, e.g. when a prefetch turns into a demand load */
+  static void RaisePriority(const std::shared_ptr<IDvdRequest>& req, EDvdPriority priority);
+  /* Requests made on this thread until the matching EndBatch are queued in one go, so the scheduler can order and
+   * coalesce the whole set instead of starting on the first request alone. Batches nest. */
+  static void BeginBatch() { ++t_BatchDepth; }
+  static void EndBatch();
 
   CDvdFile(std::string_view path);
   operator bool() const { return m_reader.operator bool(); }
-  void UpdateFilePos(int pos) { m_reader->seek(pos, SEEK_SET); }
+  void UpdateFilePos(int pos) { m_filePos = pos; }
+  void SetPriority(EDvdPriority priority) { m_priority = priority; }
+  EDvdPriority GetPriority() const { return m_priority; }
   static bool FileExists(std::string_view path) {
     nod::Node* node = ResolvePath(path);
     return node != nullptr && node->getKind() == nod::Node::Kind::File;
   }
   void CloseFile() { m_reader.reset(); }
   std::shared_ptr<IDvdRequest> AsyncSeekRead(void* buf, u32 len, ESeekOrigin whence, int off,
-                                             std::function<void(u32)>&& cb = {});
+                                             std::function<void(u32)>&& cb = {}) {
+    return AsyncSeekRead(buf, len, whence, off, std::move(cb), m_priority);
+  }
+  std::shared_ptr<IDvdRequest> AsyncSeekRead(void* buf, u32 len, ESeekOrigin whence, int off,
+                                             std::function<void(u32)>&& cb, EDvdPriority priority);
   u32 SyncSeekRead(void* buf, u32 len, ESeekOrigin whence, int offset);
   std::shared_ptr<IDvdRequest> AsyncRead(void* buf, u32 len, std::function<void(u32)>&& cb = {}) {
     return AsyncSeekRead(buf, len, ESeekOrigin::Cur, 0, std::move(cb));
   }
-  u32 SyncRead(void* buf, u32 len) { return m_reader->read(buf, len); }
+  u32 SyncRead(void* buf, u32 len) { return SyncSeekRead(buf, len, ESeekOrigin::Cur, 0); }
   u64 Length() const { return m_size; }
+  /* Start of the file within the data partition; the scheduler orders requests by this plus the file offset */
+  u64 GetDiscOffset() const { return m_begin; }
+  bool IsMapped() const { return m_mapping.operator bool(); }
+  /* Zero-copy view of [offset, offset + len) within this file; empty if the file is not mapped or out of range */
+  SMappedView GetMappedView(u32 offset, u32 len) const {
+    if (!m_mapping || u64(offset) + len > m_size) {
+      return {};
+    }
+    return {m_mapping, m_mapping->GetData() + m_begin + offset, len};
+  }
   std::string_view GetPath() const { return x18_path; }
 };
 } // namespace metaforce
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <chrono>
+#include <functional>
+
 namespace metaforce {
 
 class IDvdRequest {
@@ -9,6 +12,14 @@ public:
   virtual void WaitUntilComplete() = 0;
   virtual bool IsComplete() = 0;
   virtual void PostCancelRequest() = 0;
+  /* Queues cb to run on the game thread (from CDvdFile::DispatchCompletions) once the read has completed.
+   * Fires at the next dispatch if the request is already complete. Never fires for cancelled requests or once the
+   * last reference to the request is gone, so cb may capture an owner that holds the request for its lifetime. */
+  virtual void PostCompletion(std::function<void()>&& cb) = 0;
+  /* Metaforce addition: time spent waiting for a reader and time spent in the read itself.
+   * Only meaningful once IsComplete() has returned true. */
+  virtual std::chrono::nanoseconds GetQueueWait() const { return {}; }
+  virtual std::chrono::nanoseconds GetReadTime() const { return {}; }
 
   enum class EMediaType { ARAM = 0, Real = 1, File = 2, NOD = 3 };
   virtual EMediaType GetMediaType() const = 0;
@@ -0,0 +1,146 @@
+#include "Runtime/CEntityProfiler.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <numeric>
+#include <typeinfo>
+
+#include "Runtime/World/CEntity.hpp"
+
+#include <logvisor/logvisor.hpp>
+
+namespace metaforce {
+namespace {
+logvisor::Module Log("metaforce::CEntityProfiler");
+
+#ifdef _MSC_VER
+constexpr const char* WriteMode = "wb";
+#else
+constexpr const char* WriteMode = "wbe";
+#endif
+
+constexpr std::array<std::string_view, CEntityProfiler::kEventCount> EventNames{
+    "preThink", "think", "touch", "acceptScriptMsg", "addToRenderer", "render", "move",
+};
+} // namespace
+
+u64 CEntityProfiler::SClassStats::GetWindowNanos() const {
+  return std::accumulate(x20_windowNanos.cbegin(), x20_windowNanos.cend(), u64(0));
+}
+
+void CEntityProfiler::CScope::Begin(CEntityProfiler& profiler, CEntity& ent, EEntityProfileEvent event) {
+  m_profiler = &profiler;
+  m_parent = profiler.m_currentScope;
+  m_class = profiler.GetClass(ent);
+  m_event = event;
+  profiler.m_currentScope = this;
+  m_start = std::chrono::steady_clock::now();
+}
+
+void CEntityProfiler::CScope::End() {
+  const auto elapsed = std::chrono::steady_clock::now() - m_start;
+  m_profiler->m_currentScope = m_parent;
+  if (m_parent != nullptr) {
+    m_parent->m_children += elapsed;
+  }
+  m_profiler->Add(m_class, m_event, elapsed - m_children);
+}
+
+size_t CEntityProfiler::GetClass(CEntity& ent) {
+  const auto [it, inserted] = m_classIdx.try_emplace(std::type_index(typeid(ent)), m_classes.size());
+  if (inserted) {
+    m_classes.emplace_back().x0_name = ent.ImGuiType();
+  }
+  return it->second;
+}
+
+void CEntityProfiler::Add(size_t cls, EEntityProfileEvent event, std::chrono::nanoseconds time) {
+  SFrameSample& sample = m_classes[cls].x74_current;
+  sample.x0_nanos[size_t(event)] += u32(std::max<s64>(time.count(), 0));
+  ++sample.x1c_calls[size_t(event)];
+}
+
+void CEntityProfiler::Reset() {
+  m_currentScope = nullptr;
+  m_classes.clear();
+  m_classIdx.clear();
+  m_historyPos = 0;
+  m_frameCount = 0;
+}
+
+void CEntityProfiler::EndFrame() {
+  if (m_pendingEnabled != m_enabled) {
+    m_enabled = m_pendingEnabled;
+    if (m_enabled) {
+      Reset();
+    }
+    return;
+  }
+  if (!m_enabled) {
+    return;
+  }
+
+  for (SClassStats& stats : m_classes) {
+    SFrameSample& oldest = stats.xac_history[m_historyPos];
+    for (size_t i = 0; i < kEventCount; ++i) {
+      stats.x20_windowNanos[i] += stats.x74_current.x0_nanos[i] - u64(oldest.x0_nanos[i]);
+      stats.x58_windowCalls[i] += stats.x74_current.x1c_calls[i] - oldest.x1c_calls[i];
+    }
+    oldest = stats.x74_current;
+    stats.x74_current = {};
+  }
+  m_historyPos = (m_historyPos + 1) % kHistoryFrames;
+  m_frameCount = std::min(m_frameCount + 1, kHistoryFrames);
+}
+
+void CEntityProfiler::GetHistoryMs(const SClassStats* stats, std::array<float, kHistoryFrames>& out) const {
+  out.fill(0.f);
+  const auto addClass = [&](const SClassStats& cls) {
+    for (size_t i = 0; i < kHistoryFrames; ++i) {
+      const SFrameSample& sample = cls.xac_history[(m_historyPos + i) % kHistoryFrames];
+      out[i] += float(std::accumulate(sample.x0_nanos.cbegin(), sample.x0_nanos.cend(), u64(0))) / 1000000.f;
+    }
+  };
+  if (stats != nullptr) {
+    addClass(*stats);
+  } else {
+    for (const SClassStats& cls : m_classes) {
+      addClass(cls);
+    }
+  }
+}
+
+bool CEntityProfiler::WriteCSV(const std::string& path) const {
+  FILE* file = fopen(path.c_str(), WriteMode);
+  if (file == nullptr) {
+    Log.report(logvisor::Error, FMT_STRING("unable to open '{}' for writing"), path);
+    return false;
+  }
+
+  // Averages per frame over the history, like the ImGui table
+  const double frames = double(std::max<size_t>(m_frameCount, 1));
+  fmt::print(file, FMT_STRING("class,frames,totalMs"));
+  for (const std::string_view name : EventNames) {
+    fmt::print(file, FMT_STRING(",{0}Ms,{0}Calls"), name);
+  }
+  fmt::print(file, FMT_STRING("\n"));
+  for (const SClassStats& stats : m_classes) {
+    fmt::print(file, FMT_STRING("{},{},{:.4f}"), stats.x0_name, m_frameCount,
+               double(stats.GetWindowNanos()) / 1000000.0 / frames);
+    for (size_t i = 0; i < kEventCount; ++i) {
+      fmt::print(file, FMT_STRING(",{:.4f},{:.2f}"), double(stats.x20_windowNanos[i]) / 1000000.0 / frames,
+                 double(stats.x58_windowCalls[i]) / frames);
+    }
+    fmt::print(file, FMT_STRING("\n"));
+  }
+  const bool ok = ferror(file) == 0;
+  fclose(file);
+  if (ok) {
+    Log.report(logvisor::Info, FMT_STRING("wrote {} entity classes to '{}'"), m_classes.size(), path);
+  }
+  return ok;
+}
+
+std::string_view CEntityProfiler::EventName(EEntityProfileEvent event) { return EventNames[size_t(event)]; }
+
+} // namespace metaforce
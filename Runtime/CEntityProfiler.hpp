@@ -0,0 +1,106 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+#include "Runtime/RetroTypes.hpp"
+
+namespace metaforce {
+class CEntity;
+
+/* Metaforce addition: the entity calls CStateManager charges to a class in CEntityProfiler */
+enum class EEntityProfileEvent { PreThink, Think, Touch, AcceptScriptMsg, AddToRenderer, Render, Move, MAX };
+
+/* Metaforce addition: per-class cost of the entity calls CStateManager makes, kept over the last kHistoryFrames
+ * frames. Classes are C++ classes named by ImGuiType, so script object types built on one class share a row.
+ * Times are exclusive: a message delivered from inside another entity's Think counts towards the receiver's
+ * AcceptScriptMsg only. A frame runs from one CStateManager::Update to the next and so holds the draw of the
+ * previous update; render times are CPU time spent building draws, not GPU time.
+ * Scopes are main thread only. The parallel think phase times its jobs itself and hands the results to Add. */
+class CEntityProfiler {
+public:
+  static constexpr size_t kHistoryFrames = 120;
+  static constexpr size_t kEventCount = size_t(EEntityProfileEvent::MAX);
+
+  struct SFrameSample {
+    std::array<u32, kEventCount> x0_nanos{};
+    std::array<u32, kEventCount> x1c_calls{};
+  };
+
+  struct SClassStats {
+    std::string x0_name;
+    /* Sums over the frames in the history */
+    std::array<u64, kEventCount> x20_windowNanos{};
+    std::array<u32, kEventCount> x58_windowCalls{};
+    SFrameSample x74_current;
+    /* Ring indexed like m_historyPos */
+    std::array<SFrameSample, kHistoryFrames> xac_history{};
+
+    u64 GetWindowNanos() const;
+  };
+
+  /* Times one entity call; does nothing when the profiler is null or disabled */
+  class CScope {
+    CEntityProfiler* m_profiler = nullptr;
+    CScope* m_parent = nullptr;
+    size_t m_class = 0;
+    EEntityProfileEvent m_event{};
+    std::chrono::steady_clock::time_point m_start;
+    std::chrono::nanoseconds m_children{};
+
+    void Begin(CEntityProfiler& profiler, CEntity& ent, EEntityProfileEvent event);
+    void End();
+
+  public:
+    CScope(CEntityProfiler* profiler, CEntity& ent, EEntityProfileEvent event) {
+      if (profiler != nullptr && profiler->m_enabled) {
+        Begin(*profiler, ent, event);
+      }
+    }
+    ~CScope() {
+      if (m_profiler != nullptr) {
+        End();
+      }
+    }
+    CScope(const CScope&) = delete;
+    CScope& operator=(const CScope&) = delete;
+  };
+
+private:
+  bool m_enabled = false;
+  bool m_pendingEnabled = false;
+  CScope* m_currentScope = nullptr;
+  std::vector<SClassStats> m_classes;
+  std::unordered_map<std::type_index, size_t> m_classIdx;
+  /* Slot the next finished frame goes in, and how many slots hold frames */
+  size_t m_historyPos = 0;
+  size_t m_frameCount = 0;
+
+  size_t GetClass(CEntity& ent);
+  void Add(size_t cls, EEntityProfileEvent event, std::chrono::nanoseconds time);
+
+public:
+  bool IsEnabled() const { return m_enabled; }
+  /* Takes effect on the next EndFrame so a frame is never half recorded; enabling starts a fresh history */
+  void SetEnabled(bool enabled) { m_pendingEnabled = enabled; }
+  void Reset();
+  /* Rolls the frame recorded so far into the history */
+  void EndFrame();
+  void Add(CEntity& ent, EEntityProfileEvent event, std::chrono::nanoseconds time) { Add(GetClass(ent), event, time); }
+
+  const std::vector<SClassStats>& GetClasses() const { return m_classes; }
+  size_t GetFrameCount() const { return m_frameCount; }
+  /* Milliseconds per frame over the history, oldest first; every class together when stats is null */
+  void GetHistoryMs(const SClassStats* stats, std::array<float, kHistoryFrames>& out) const;
+  /* One row per class with the per-frame average time and calls of each event over the history */
+  bool WriteCSV(const std::string& path) const;
+
+  static std::string_view EventName(EEntityProfileEvent event);
+};
+
+} // namespace metaforce
@@ -2,10 +2,13 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cctype>
+#include <cstring>
 #include <iterator>
 #include "optick.h"
 
+#include "Runtime/CMappedFile.hpp"
 #include "Runtime/CStopwatch.hpp"
 #include "Runtime/IObj.hpp"
 
@@ -19,6 +22,13 @@ constexpr std::array TypeTable{
     FOURCC('HINT'), FOURCC('MAPU'), FOURCC('DUMB'), FOURCC('OIDS'),
 };
 
+namespace {
+std::atomic<u32> g_inflateCount{0};
+std::atomic<u64> g_inflateCompressedBytes{0};
+std::atomic<u64> g_inflateInflatedBytes{0};
+std::atomic<s64> g_inflateNanos{0};
+} // namespace
+
 CFactoryFnReturn CFactoryMgr::MakeObject(const SObjectTag& tag, metaforce::CInputStream& in,
                                          const CVParamTransfer& paramXfer, CObjectReference* selfRef) {
   auto search = x10_factories.find(tag.type);
@@ -42,12 +52,8 @@ CFactoryFnReturn CFactoryMgr::MakeObjectFromMemory(const SObjectTag& tag, std::u
   const auto memFactoryIter = x24_memFactories.find(tag.type);
   if (memFactoryIter != x24_memFactories.cend()) {
     if (compressed) {
-      std::unique_ptr<CInputStream> compRead =
-          std::make_unique<CMemoryInStream>(localBuf.get(), size, CMemoryInStream::EOwnerShip::NotOwned);
-      const u32 decompLen = compRead->ReadLong();
-      CZipInputStream r(std::move(compRead));
-      std::unique_ptr<u8[]> decompBuf(new u8[decompLen]);
-      r.Get(decompBuf.get(), decompLen);
+      u32 decompLen = 0;
+      std::unique_ptr<u8[]> decompBuf = InflateResource(localBuf.get(), size, decompLen);
       return memFactoryIter->second(tag, std::move(decompBuf), decompLen, paramXfer, selfRef);
     } else {
       return memFactoryIter->second(tag, std::move(localBuf), size, paramXfer, selfRef);
@@ -72,6 +78,83 @@ CFactoryFnReturn CFactoryMgr::MakeObjectFromMemory(const SObjectTag& tag, std::u
   }
 }
 
+CFactoryFnReturn CFactoryMgr::MakeObjectFromView(const SObjectTag& tag, const SMappedView& view, bool compressed,
+                                                 const CVParamTransfer& paramXfer, CObjectReference* selfRef) {
+  OPTICK_EVENT();
+  if (!compressed) {
+    const auto viewFactoryIter = m_viewFactories.find(tag.type);
+    if (viewFactoryIter != m_viewFactories.cend()) {
+      return viewFactoryIter->second(tag, view, paramXfer, selfRef);
+    }
+  }
+
+  const u8* data = view.x8_data;
+  const u32 size = view.xc_size;
+  const auto memFactoryIter = x24_memFactories.find(tag.type);
+  if (memFactoryIter != x24_memFactories.cend()) {
+    if (compressed) {
+      u32 decompLen = 0;
+      std::unique_ptr<u8[]> decompBuf = InflateResource(data, size, decompLen);
+      return memFactoryIter->second(tag, std::move(decompBuf), decompLen, paramXfer, selfRef);
+    }
+    // Memory factories keep their buffer for the lifetime of the object
+    std::unique_ptr<u8[]> copy(new u8[size]);
+    std::memcpy(copy.get(), data, size);
+    return memFactoryIter->second(tag, std::move(copy), size, paramXfer, selfRef);
+  }
+
+  const auto factoryIter = x10_factories.find(tag.type);
+  if (factoryIter == x10_factories.end()) {
+    return {};
+  }
+
+  if (compressed) {
+    std::unique_ptr<CInputStream> compRead =
+        std::make_unique<CMemoryInStream>(data, size, CMemoryInStream::EOwnerShip::NotOwned);
+
+    compRead->ReadLong();
+    CZipInputStream r(std::move(compRead));
+    return factoryIter->second(tag, r, paramXfer, selfRef);
+  }
+  CMemoryInStream r(data, size, CMemoryInStream::EOwnerShip::NotOwned);
+  return factoryIter->second(tag, r, paramXfer, selfRef);
+}
+
+std::unique_ptr<u8[]> CFactoryMgr::InflateResource(const u8* buf, u32 size, u32& decompLenOut) {
+  OPTICK_EVENT();
+  const auto start = std::chrono::steady_clock::now();
+  std::unique_ptr<CInputStream> compRead =
+      std::make_unique<CMemoryInStream>(buf, size, CMemoryInStream::EOwnerShip::NotOwned);
+  decompLenOut = compRead->ReadLong();
+  CZipInputStream r(std::move(compRead));
+  std::unique_ptr<u8[]> decompBuf(new u8[decompLenOut]);
+  r.Get(decompBuf.get(), decompLenOut);
+
+  g_inflateCount.fetch_add(1, std::memory_order_relaxed);
+  g_inflateCompressedBytes.fetch_add(size, std::memory_order_relaxed);
+  g_inflateInflatedBytes.fetch_add(decompLenOut, std::memory_order_relaxed);
+  g_inflateNanos.fetch_add(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count(),
+      std::memory_order_relaxed);
+  return decompBuf;
+}
+
+CFactoryMgr::SInflateStats CFactoryMgr::GetInflateStats() {
+  SInflateStats ret;
+  ret.count = g_inflateCount.load(std::memory_order_relaxed);
+  ret.compressedBytes = g_inflateCompressedBytes.load(std::memory_order_relaxed);
+  ret.inflatedBytes = g_inflateInflatedBytes.load(std::memory_order_relaxed);
+  ret.time = std::chrono::nanoseconds{g_inflateNanos.load(std::memory_order_relaxed)};
+  return ret;
+}
+
+void CFactoryMgr::ResetInflateStats() {
+  g_inflateCount.store(0, std::memory_order_relaxed);
+  g_inflateCompressedBytes.store(0, std::memory_order_relaxed);
+  g_inflateInflatedBytes.store(0, std::memory_order_relaxed);
+  g_inflateNanos.store(0, std::memory_order_relaxed);
+}
+
 CFactoryMgr::ETypeTable CFactoryMgr::FourCCToTypeIdx(FourCC fcc) {
   for (size_t i = 0; i < 4; ++i) {
     fcc.getChars()[i] = char(std::toupper(fcc.getChars()[i]));
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <chrono>
+#include <memory>
 #include <unordered_map>
 
 #include "Runtime/IFactory.hpp"
@@ -14,15 +16,29 @@ class IObj;
 class CFactoryMgr {
   std::unordered_map<FourCC, FFactoryFunc> x10_factories;
   std::unordered_map<FourCC, FMemFactoryFunc> x24_memFactories;
+  std::unordered_map<FourCC, FViewFactoryFunc> m_viewFactories;
 
 public:
+  struct SInflateStats {
+    u32 count = 0;
+    u64 compressedBytes = 0;
+    u64 inflatedBytes = 0;
+    std::chrono::nanoseconds time{};
+  };
+
   CFactoryFnReturn MakeObject(const SObjectTag& tag, metaforce::CInputStream& in, const CVParamTransfer& paramXfer,
                               CObjectReference* selfRef);
   bool CanMakeMemory(const metaforce::SObjectTag& tag) const;
   CFactoryFnReturn MakeObjectFromMemory(const SObjectTag& tag, std::unique_ptr<u8[]>&& buf, int size, bool compressed,
                                         const CVParamTransfer& paramXfer, CObjectReference* selfRef);
+  /* Builds straight from a memory-mapped PAK. View factories and stream factories read the view in place; memory
+   * factories receive an owned copy or the inflated buffer. */
+  CFactoryFnReturn MakeObjectFromView(const SObjectTag& tag, const SMappedView& view, bool compressed,
+                                      const CVParamTransfer& paramXfer, CObjectReference* selfRef);
   void AddFactory(FourCC key, FFactoryFunc func) { x10_factories.insert_or_assign(key, std::move(func)); }
   void AddFactory(FourCC key, FMemFactoryFunc func) { x24_memFactories.insert_or_assign(key, std::move(func)); }
+  /* Used over the memory factory of the same type whenever the resource is mapped and uncompressed */
+  void AddFactory(FourCC key, FViewFactoryFunc func) { m_viewFactories.insert_or_assign(key, std::move(func)); }
 
   enum class ETypeTable : u8 {
     CLSN,
@@ -67,6 +83,12 @@ public:
     Invalid = 127
   };
 
+  /* Inflates a compressed PAK resource (decompressed length followed by a zlib stream) into a new buffer.
+   * Safe to call from worker threads; every call contributes to the per-frame inflate counters. */
+  static std::unique_ptr<u8[]> InflateResource(const u8* buf, u32 size, u32& decompLenOut);
+  static SInflateStats GetInflateStats();
+  static void ResetInflateStats();
+
   static ETypeTable FourCCToTypeIdx(FourCC fcc);
   static FourCC TypeIdxToFourCC(ETypeTable fcc);
 };
@@ -0,0 +1,286 @@
+#include "Runtime/CGameplayReplay.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <type_traits>
+
+#include "Runtime/IMain.hpp"
+#include "Runtime/ConsoleVariables/CVarManager.hpp"
+#include "Runtime/World/CWorld.hpp"
+
+#include <logvisor/logvisor.hpp>
+
+namespace metaforce {
+namespace {
+logvisor::Module Log("metaforce::CGameplayReplay");
+
+#ifdef _MSC_VER
+constexpr const char* ReadMode = "rb";
+constexpr const char* WriteMode = "wb";
+#else
+constexpr const char* ReadMode = "rbe";
+constexpr const char* WriteMode = "wbe";
+#endif
+
+constexpr u32 ReplayMagic = SBIG('MRPL');
+constexpr u32 ReplayVersion = 1;
+
+static_assert(std::is_trivially_copyable_v<CFinalInput>, "recordings store raw CFinalInput copies");
+
+CVar* replayRecord = nullptr;
+CVar* replayPlay = nullptr;
+CVar* replayQuitOnEnd = nullptr;
+
+constexpr std::array<std::string_view, size_t(EUpdatePhase::MAX)> PhaseNames{
+    "preThink", "moveActors", "collision", "crossTouch", "think", "camera", "world", "other",
+};
+
+double ToMs(std::chrono::nanoseconds time) { return std::chrono::duration<double, std::milli>(time).count(); }
+
+/* Nearest-rank percentile over an already sorted list */
+std::chrono::nanoseconds Percentile(const std::vector<std::chrono::nanoseconds>& sorted, u32 pct) {
+  const size_t rank = (sorted.size() * pct + 99) / 100;
+  return sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1];
+}
+
+template <typename T>
+void WriteValue(FILE* file, const T& value) {
+  fwrite(&value, sizeof(T), 1, file);
+}
+
+template <typename T>
+bool ReadValue(FILE* file, T& value) {
+  return fread(&value, sizeof(T), 1, file) == 1;
+}
+} // namespace
+
+std::unique_ptr<CGameplayReplay> CGameplayReplay::Create() {
+  if (replayRecord == nullptr) {
+    replayRecord = CVarManager::instance()->findOrMakeCVar(
+        "replay.record"sv, "Records in-game input to this path for replay.play; takes effect on the next game"sv, ""sv,
+        CVar::EFlags::Game);
+    replayPlay = CVarManager::instance()->findOrMakeCVar(
+        "replay.play"sv,
+        "Replays the recording at this path in place of input on the next game, stopping at the first frame that "
+        "diverges; runs with the window and renderer, not headless"sv,
+        ""sv, CVar::EFlags::Game);
+    replayQuitOnEnd = CVarManager::instance()->findOrMakeCVar(
+        "replay.quitOnEnd"sv, "Quits once replay.play has run every recorded frame or diverged"sv, false,
+        CVar::EFlags::Game);
+  }
+
+  if (std::string path = replayPlay->toLiteral(); !path.empty()) {
+    std::unique_ptr<CGameplayReplay> ret(new CGameplayReplay(EMode::Play, std::move(path)));
+    if (!ret->Read()) {
+      return nullptr;
+    }
+    return ret;
+  }
+  if (std::string path = replayRecord->toLiteral(); !path.empty()) {
+    return std::unique_ptr<CGameplayReplay>(new CGameplayReplay(EMode::Record, std::move(path)));
+  }
+  return nullptr;
+}
+
+bool CGameplayReplay::Read() {
+  FILE* file = fopen(m_path.c_str(), ReadMode);
+  if (file == nullptr) {
+    Log.report(logvisor::Error, FMT_STRING("unable to open '{}' for reading"), m_path);
+    return false;
+  }
+
+  u32 magic = 0;
+  u32 version = 0;
+  u32 inputSize = 0;
+  u64 worldId = 0;
+  u32 frameCount = 0;
+  bool ok = ReadValue(file, magic) && ReadValue(file, version) && ReadValue(file, inputSize) &&
+            ReadValue(file, worldId) && ReadValue(file, m_areaId) && ReadValue(file, frameCount);
+  if (ok && (magic != ReplayMagic || version != ReplayVersion || inputSize != sizeof(CFinalInput))) {
+    Log.report(logvisor::Error, FMT_STRING("'{}' is not a recording from this build"), m_path);
+    ok = false;
+  }
+  if (ok && frameCount == 0) {
+    // BeginFrame plays m_frames[m_frameIdx] until the last one, so there has to be a first one
+    Log.report(logvisor::Error, FMT_STRING("'{}' has no recorded frames"), m_path);
+    fclose(file);
+    return false;
+  }
+  m_worldId = CAssetId(worldId);
+
+  m_frames.resize(ok ? frameCount : 0);
+  for (SFrame& frame : m_frames) {
+    u32 inputCount = 0;
+    ok = ReadValue(file, frame.x0_dt) && ReadValue(file, frame.x4_updateFrameIdx) &&
+         ReadValue(file, frame.x8_randomSeed) && ReadValue(file, frame.xc_stateHash) && ReadValue(file, inputCount);
+    if (!ok) {
+      break;
+    }
+    frame.x10_inputs.resize(inputCount);
+    ok = fread(frame.x10_inputs.data(), sizeof(CFinalInput), inputCount, file) == inputCount;
+    if (!ok) {
+      break;
+    }
+  }
+  fclose(file);
+
+  if (!ok) {
+    Log.report(logvisor::Error, FMT_STRING("unable to read recording '{}'"), m_path);
+    return false;
+  }
+  m_phaseTimes.reserve(m_frames.size());
+  Log.report(logvisor::Info, FMT_STRING("replaying {} frames from '{}'"), m_frames.size(), m_path);
+  return true;
+}
+
+bool CGameplayReplay::Write() const {
+  if (m_frames.empty()) {
+    Log.report(logvisor::Warning, FMT_STRING("no frames were recorded, not writing '{}'"), m_path);
+    return false;
+  }
+
+  FILE* file = fopen(m_path.c_str(), WriteMode);
+  if (file == nullptr) {
+    Log.report(logvisor::Error, FMT_STRING("unable to open '{}' for writing"), m_path);
+    return false;
+  }
+
+  WriteValue(file, ReplayMagic);
+  WriteValue(file, ReplayVersion);
+  WriteValue(file, u32(sizeof(CFinalInput)));
+  WriteValue(file, m_worldId.Value());
+  WriteValue(file, m_areaId);
+  WriteValue(file, u32(m_frames.size()));
+  for (const SFrame& frame : m_frames) {
+    WriteValue(file, frame.x0_dt);
+    WriteValue(file, frame.x4_updateFrameIdx);
+    WriteValue(file, frame.x8_randomSeed);
+    WriteValue(file, frame.xc_stateHash);
+    WriteValue(file, u32(frame.x10_inputs.size()));
+    fwrite(frame.x10_inputs.data(), sizeof(CFinalInput), frame.x10_inputs.size(), file);
+  }
+  const bool ok = ferror(file) == 0;
+  fclose(file);
+  if (ok) {
+    Log.report(logvisor::Info, FMT_STRING("recorded {} frames to '{}'"), m_frames.size(), m_path);
+  }
+  return ok;
+}
+
+void CGameplayReplay::RecordInput(const CFinalInput& input) {
+  if (m_mode == EMode::Record) {
+    m_pending.x10_inputs.push_back(input);
+  }
+}
+
+float CGameplayReplay::BeginFrame(CStateManager& mgr, float dt) {
+  if (m_mode == EMode::Record) {
+    if (m_frames.empty()) {
+      m_worldId = mgr.GetWorld()->IGetWorldAssetId();
+      m_areaId = mgr.GetNextAreaId();
+    }
+    m_pending.x0_dt = dt;
+    m_pending.x4_updateFrameIdx = mgr.GetUpdateFrameIndex();
+    m_pending.x8_randomSeed = mgr.GetDefaultRandomSeed();
+    return dt;
+  }
+
+  if (m_finished) {
+    return dt;
+  }
+  if (m_frameIdx == 0 && (mgr.GetWorld()->IGetWorldAssetId() != m_worldId || mgr.GetNextAreaId() != m_areaId)) {
+    Log.report(logvisor::Warning, FMT_STRING("recording starts in world {} area {}, this game in world {} area {}"),
+               m_worldId, m_areaId, mgr.GetWorld()->IGetWorldAssetId(), mgr.GetNextAreaId());
+  }
+
+  const SFrame& frame = m_frames[m_frameIdx];
+  if (m_frameIdx == 0) {
+    // Only the starting seeds come from the recording; reseeding later frames would hide a divergence
+    mgr.SetReplaySeeds(frame.x4_updateFrameIdx, frame.x8_randomSeed);
+  } else if (mgr.GetUpdateFrameIndex() != frame.x4_updateFrameIdx ||
+             mgr.GetDefaultRandomSeed() != frame.x8_randomSeed) {
+    Log.report(logvisor::Warning, FMT_STRING("seeds diverged from the recording on frame {}"), m_frameIdx);
+    m_firstDivergence = m_frameIdx;
+    Stop();
+    return dt;
+  }
+  for (const CFinalInput& input : frame.x10_inputs) {
+    mgr.ProcessInput(input);
+  }
+  return frame.x0_dt;
+}
+
+void CGameplayReplay::EndFrame(const CStateManager& mgr) {
+  if (m_mode == EMode::Record) {
+    m_pending.xc_stateHash = mgr.ComputeStateHash();
+    m_frames.push_back(std::move(m_pending));
+    m_pending = {};
+    return;
+  }
+
+  if (m_finished) {
+    return;
+  }
+  m_phaseTimes.push_back(mgr.GetUpdatePhaseTimes());
+  if (mgr.ComputeStateHash() != m_frames[m_frameIdx].xc_stateHash) {
+    Log.report(logvisor::Warning, FMT_STRING("state diverged from the recording on frame {}"), m_frameIdx);
+    m_firstDivergence = m_frameIdx;
+    Stop();
+    return;
+  }
+
+  if (++m_frameIdx == m_frames.size()) {
+    Stop();
+  }
+}
+
+void CGameplayReplay::Stop() {
+  // Later frames would replay input against a different state, so live input takes over from here
+  m_finished = true;
+  Log.report(logvisor::Info, FMT_STRING("{}"), Summarize());
+  if (replayQuitOnEnd->toBoolean()) {
+    g_Main->Quit();
+  }
+}
+
+void CGameplayReplay::Finish() {
+  if (m_mode == EMode::Record) {
+    Write();
+  } else if (!m_finished) {
+    Log.report(logvisor::Warning, FMT_STRING("game ended after {} of {} recorded frames\n{}"), m_frameIdx,
+               m_frames.size(), Summarize());
+  }
+}
+
+std::string CGameplayReplay::Summarize() const {
+  std::string ret = fmt::format(FMT_STRING("replay of '{}': {} frames"), m_path, m_phaseTimes.size());
+  if (m_firstDivergence == SIZE_MAX) {
+    ret += ", deterministic\n";
+  } else {
+    ret += fmt::format(FMT_STRING(", diverged on frame {} of {}\n"), m_firstDivergence, m_frames.size());
+  }
+  if (m_phaseTimes.empty()) {
+    return ret;
+  }
+
+  ret += "update phase times in ms as p50/p90/p99/max:";
+  std::vector<std::chrono::nanoseconds> times;
+  std::vector<std::chrono::nanoseconds> totals(m_phaseTimes.size());
+  for (size_t phase = 0; phase < PhaseNames.size(); ++phase) {
+    times.clear();
+    for (size_t i = 0; i < m_phaseTimes.size(); ++i) {
+      times.push_back(m_phaseTimes[i][phase]);
+      totals[i] += m_phaseTimes[i][phase];
+    }
+    std::sort(times.begin(), times.end());
+    ret += fmt::format(FMT_STRING(" {}={:.2f}/{:.2f}/{:.2f}/{:.2f}"), PhaseNames[phase], ToMs(Percentile(times, 50)),
+                       ToMs(Percentile(times, 90)), ToMs(Percentile(times, 99)), ToMs(times.back()));
+  }
+  std::sort(totals.begin(), totals.end());
+  ret += fmt::format(FMT_STRING(" total={:.2f}/{:.2f}/{:.2f}/{:.2f}\n"), ToMs(Percentile(totals, 50)),
+                     ToMs(Percentile(totals, 90)), ToMs(Percentile(totals, 99)), ToMs(totals.back()));
+  return ret;
+}
+
+} // namespace metaforce
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Runtime/CStateManager.hpp"
+#include "Runtime/RetroTypes.hpp"
+#include "Runtime/Input/CFinalInput.hpp"
+
+namespace metaforce {
+
+/* Metaforce addition: records what CMFGame feeds CStateManager on every in-game update (the controller input handed
+ * to ProcessInput, the frame dt, the default random seed and the update frame index the particle generators seed
+ * from) along with the state hash after the update, and plays a recording back in place of live input.
+ * Playback sets the seeds once, before the first frame, and from then on only checks them: the first frame whose
+ * seeds or state hash differ from the recording is reported and ends playback, along with per-phase update times up
+ * to it. Set replay.record or replay.play before starting a game; both begin with the first in-game update of the
+ * session. Playback runs inside CMFGame with the window and renderer up, since loading a world needs them; there is
+ * no headless runner, so the phase times include the cost of drawing alongside. Pausing, the map screen and skipping
+ * cinematics are not recorded, so a recording that uses them diverges on playback. Frames hold raw CFinalInput
+ * copies, so only the build that wrote a recording can play it back. */
+class CGameplayReplay {
+public:
+  enum class EMode { Record, Play };
+
+  struct SFrame {
+    float x0_dt = 0.f;
+    u32 x4_updateFrameIdx = 0;
+    s32 x8_randomSeed = 0;
+    u32 xc_stateHash = 0;
+    std::vector<CFinalInput> x10_inputs;
+  };
+
+private:
+  EMode m_mode;
+  std::string m_path;
+  CAssetId m_worldId;
+  TAreaId m_areaId = kInvalidAreaId;
+  std::vector<SFrame> m_frames;
+  /* Record: input collected for the next update. Play: the frame the next update replays */
+  SFrame m_pending;
+  size_t m_frameIdx = 0;
+  bool m_finished = false;
+  size_t m_firstDivergence = SIZE_MAX;
+  std::vector<UpdatePhaseTimes> m_phaseTimes;
+
+  CGameplayReplay(EMode mode, std::string path) : m_mode(mode), m_path(std::move(path)) {}
+  bool Read();
+  bool Write() const;
+  std::string Summarize() const;
+  void Stop();
+
+public:
+  /* Reads replay.record and replay.play; nullptr when neither is set or the recording cannot be read */
+  static std::unique_ptr<CGameplayReplay> Create();
+
+  EMode GetMode() const { return m_mode; }
+  bool IsPlaying() const { return m_mode == EMode::Play && !m_finished; }
+  void RecordInput(const CFinalInput& input);
+  /* Call right before CStateManager::Update; returns the dt to update with */
+  float BeginFrame(CStateManager& mgr, float dt);
+  /* Call right after CStateManager::Update */
+  void EndFrame(const CStateManager& mgr);
+  /* Writes the recording, or reports on playback that stopped early; called when the game session ends */
+  void Finish();
+};
+
+} // namespace metaforce
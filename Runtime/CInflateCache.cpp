@@ -0,0 +1,244 @@
+#include "Runtime/CInflateCache.hpp"
+
+#include <cstdio>
+
+#include "Runtime/CBasics.hpp"
+#include "Runtime/CCRC32.hpp"
+#include "Runtime/Streams/CFileOutStream.hpp"
+#include "Runtime/Streams/CMemoryInStream.hpp"
+
+#include <logvisor/logvisor.hpp>
+#include <optick.h>
+
+namespace metaforce {
+namespace {
+logvisor::Module Log("metaforce::CInflateCache");
+
+constexpr u32 IndexMagic = 0x49434845; // 'ICHE'
+// Version 1 keyed entries by their place in the PAK rather than by payload; same record layout
+constexpr u32 IndexVersion = 2;
+constexpr u32 IndexWriteInterval = 64;
+
+#ifdef _MSC_VER
+constexpr const char* ReadMode = "rb";
+constexpr const char* WriteMode = "wb";
+#else
+constexpr const char* ReadMode = "rbe";
+constexpr const char* WriteMode = "wbe";
+#endif
+
+std::unique_ptr<u8[]> ReadWholeFile(const std::string& path, u32 expectedSize) {
+  FILE* file = fopen(path.c_str(), ReadMode);
+  if (file == nullptr) {
+    return nullptr;
+  }
+  std::unique_ptr<u8[]> buf(new u8[expectedSize]);
+  const size_t readLen = fread(buf.get(), 1, expectedSize, file);
+  // Trailing bytes mean the entry does not belong to this index
+  const bool atEnd = fgetc(file) == EOF;
+  fclose(file);
+  if (readLen != expectedSize || !atEnd) {
+    return nullptr;
+  }
+  return buf;
+}
+} // namespace
+
+CInflateCache::CInflateCache(std::string_view directory, u64 maxBytes) : m_directory(directory), m_maxBytes(maxBytes) {
+  if (CBasics::RecursiveMakeDir(m_directory.c_str()) != 0) {
+    Log.report(logvisor::Warning, FMT_STRING("Unable to create inflate cache directory {}"), m_directory);
+  }
+  LoadIndex();
+}
+
+CInflateCache::~CInflateCache() { WriteIndex(); }
+
+CInflateCache::SKey CInflateCache::MakeKey(CAssetId id, const u8* compressed, u32 size) {
+  OPTICK_EVENT();
+  return {id, CCRC32::Calculate(compressed, size)};
+}
+
+std::string CInflateCache::EntryPath(const SKey& key) const {
+  return fmt::format(FMT_STRING("{}/{:016X}_{:08X}.bin"), m_directory, key.x0_id.Value(), key.x8_hash);
+}
+
+void CInflateCache::LoadIndex() {
+  const std::string path = m_directory + "/index.bin";
+  CBasics::Sstat st;
+  if (CBasics::Stat(path.c_str(), &st) != 0 || st.st_size < 12) {
+    return;
+  }
+  std::unique_ptr<u8[]> buf = ReadWholeFile(path, u32(st.st_size));
+  if (!buf) {
+    return;
+  }
+  CMemoryInStream r(buf.get(), u32(st.st_size), CMemoryInStream::EOwnerShip::NotOwned);
+  if (r.ReadLong() != IndexMagic) {
+    return;
+  }
+  const u32 version = r.ReadLong();
+  if (version == 0 || version > IndexVersion) {
+    return;
+  }
+  const u32 count = r.ReadLong();
+  if (u64(count) * 16 + 12 > u64(st.st_size)) {
+    return;
+  }
+  for (u32 i = 0; i < count; ++i) {
+    SEntry entry{{CAssetId(r.ReadUint64()), u32(r.ReadLong())}, u32(r.ReadLong())};
+    if (version != IndexVersion) {
+      // Keys from an older scheme would never hit again; drop their files rather than leave them taking space
+      std::remove(EntryPath(entry.x0_key).c_str());
+      m_dirty = true;
+      continue;
+    }
+    if (m_index.contains(entry.x0_key)) {
+      continue;
+    }
+    m_index.emplace(entry.x0_key, m_lru.insert(m_lru.end(), entry));
+    m_totalBytes += entry.x10_size;
+  }
+
+  // The size limit may have been lowered since the index was written
+  std::vector<SKey> evicted;
+  Evict(evicted);
+  for (const SKey& key : evicted) {
+    std::remove(EntryPath(key).c_str());
+  }
+}
+
+void CInflateCache::WriteIndex() {
+  std::unique_lock writeLk{m_indexWriteMutex};
+  std::vector<SEntry> entries;
+  {
+    std::unique_lock lk{m_mutex};
+    if (!m_dirty) {
+      return;
+    }
+    entries.assign(m_lru.cbegin(), m_lru.cend());
+    m_dirty = false;
+    m_unsavedStores = 0;
+  }
+
+  const std::string tmpPath = m_directory + "/index.bin.tmp";
+  const std::string path = m_directory + "/index.bin";
+  {
+    CFileOutStream w(tmpPath);
+    w.WriteLong(IndexMagic);
+    w.WriteLong(IndexVersion);
+    w.WriteLong(u32(entries.size()));
+    for (const SEntry& entry : entries) {
+      w.WriteLongLong(entry.x0_key.x0_id.Value());
+      w.WriteLong(entry.x0_key.x8_hash);
+      w.WriteLong(entry.x10_size);
+    }
+  }
+  std::remove(path.c_str());
+  if (std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+    Log.report(logvisor::Warning, FMT_STRING("Unable to write inflate cache index {}"), path);
+  }
+}
+
+void CInflateCache::Evict(std::vector<SKey>& evictedOut) {
+  while (m_totalBytes > m_maxBytes && !m_lru.empty()) {
+    const SEntry& entry = m_lru.back();
+    m_totalBytes -= entry.x10_size;
+    evictedOut.push_back(entry.x0_key);
+    m_index.erase(entry.x0_key);
+    m_lru.pop_back();
+    m_dirty = true;
+  }
+}
+
+void CInflateCache::Remove(const SKey& key) {
+  {
+    std::unique_lock lk{m_mutex};
+    const auto search = m_index.find(key);
+    if (search == m_index.end()) {
+      return;
+    }
+    m_totalBytes -= search->second->x10_size;
+    m_lru.erase(search->second);
+    m_index.erase(search);
+    m_dirty = true;
+  }
+  std::remove(EntryPath(key).c_str());
+}
+
+std::unique_ptr<u8[]> CInflateCache::Load(const SKey& key, u32& sizeOut) {
+  OPTICK_EVENT();
+  {
+    std::unique_lock lk{m_mutex};
+    const auto search = m_index.find(key);
+    if (search == m_index.end()) {
+      return nullptr;
+    }
+    sizeOut = search->second->x10_size;
+    m_lru.splice(m_lru.begin(), m_lru, search->second);
+    m_dirty = true;
+  }
+
+  std::unique_ptr<u8[]> buf = ReadWholeFile(EntryPath(key), sizeOut);
+  if (!buf) {
+    Log.report(logvisor::Warning, FMT_STRING("Dropping unreadable inflate cache entry {}"), key.x0_id);
+    Remove(key);
+    sizeOut = 0;
+  }
+  return buf;
+}
+
+void CInflateCache::Store(const SKey& key, const u8* data, u32 size) {
+  OPTICK_EVENT();
+  if (size > m_maxBytes) {
+    return;
+  }
+  {
+    // Workers racing on the same resource must not share a temporary file
+    std::unique_lock lk{m_mutex};
+    if (m_index.contains(key) || !m_pending.insert(key).second) {
+      return;
+    }
+  }
+
+  // Write under a temporary name so a crash never leaves a truncated entry behind a valid index record
+  const std::string path = EntryPath(key);
+  const std::string tmpPath = path + ".tmp";
+  bool written = false;
+  if (FILE* file = fopen(tmpPath.c_str(), WriteMode)) {
+    written = fwrite(data, 1, size, file) == size;
+    fclose(file);
+  }
+  std::remove(path.c_str());
+  if (!written || std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+    std::remove(tmpPath.c_str());
+    std::unique_lock lk{m_mutex};
+    m_pending.erase(key);
+    return;
+  }
+
+  std::vector<SKey> evicted;
+  bool writeIndex = false;
+  {
+    std::unique_lock lk{m_mutex};
+    m_pending.erase(key);
+    m_index.emplace(key, m_lru.insert(m_lru.begin(), SEntry{key, size}));
+    m_totalBytes += size;
+    m_dirty = true;
+    Evict(evicted);
+    writeIndex = ++m_unsavedStores >= IndexWriteInterval;
+  }
+  for (const SKey& evictedKey : evicted) {
+    std::remove(EntryPath(evictedKey).c_str());
+  }
+  // Keep the index roughly current so a crash does not orphan a whole session of entries
+  if (writeIndex) {
+    WriteIndex();
+  }
+}
+
+u64 CInflateCache::GetTotalBytes() const {
+  std::unique_lock lk{m_mutex};
+  return m_totalBytes;
+}
+
+} // namespace metaforce
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "Runtime/RetroTypes.hpp"
+
+namespace metaforce {
+
+/* Size-bounded on-disk cache of inflated PAK resources, so warm starts and area reloads skip zlib.
+ * Entries are keyed by asset id plus a CRC of the compressed payload they were inflated from, so a
+ * changed resource misses even if its PAK entry kept its place. The compressed bytes are still read,
+ * only the inflate is skipped. Safe to use from the inflate workers. */
+class CInflateCache {
+public:
+  struct SKey {
+    CAssetId x0_id;
+    u32 x8_hash = 0;
+
+    bool operator==(const SKey& other) const { return x0_id == other.x0_id && x8_hash == other.x8_hash; }
+  };
+
+  static SKey MakeKey(CAssetId id, const u8* compressed, u32 size);
+
+private:
+  struct SKeyHash {
+    size_t operator()(const SKey& key) const { return std::hash<u64>()(key.x0_id.Value() ^ (u64(key.x8_hash) << 32)); }
+  };
+  struct SEntry {
+    SKey x0_key;
+    u32 x10_size;
+  };
+
+  std::string m_directory;
+  u64 m_maxBytes;
+  mutable std::mutex m_mutex;
+  std::mutex m_indexWriteMutex;
+  std::list<SEntry> m_lru; /* Front is most recently used */
+  std::unordered_map<SKey, std::list<SEntry>::iterator, SKeyHash> m_index;
+  std::unordered_set<SKey, SKeyHash> m_pending; /* Entries currently being written by Store */
+  u64 m_totalBytes = 0;
+  u32 m_unsavedStores = 0;
+  bool m_dirty = false;
+
+  std::string EntryPath(const SKey& key) const;
+  void LoadIndex();
+  void Evict(std::vector<SKey>& evictedOut);
+  void Remove(const SKey& key);
+
+public:
+  CInflateCache(std::string_view directory, u64 maxBytes);
+  ~CInflateCache();
+  CInflateCache(const CInflateCache&) = delete;
+  CInflateCache& operator=(const CInflateCache&) = delete;
+
+  /* Returns nullptr on miss or if the entry on disk turns out to be unreadable */
+  std::unique_ptr<u8[]> Load(const SKey& key, u32& sizeOut);
+  void Store(const SKey& key, const u8* data, u32 size);
+  void WriteIndex();
+
+  u64 GetTotalBytes() const;
+  u64 GetMaxBytes() const { return m_maxBytes; }
+};
+
+} // namespace metaforce
@@ -243,6 +243,8 @@ public:
 
     if (!m_projectInitialized && !m_deferredProject.empty()) {
       Log.report(logvisor::Info, FMT_STRING("Loading game from '{}'"), m_deferredProject);
+      CDvdFile::SetWorkerCount(m_cvarCommons.getDvdWorkerThreads());
+      CDvdFile::SetMemoryMapEnabled(m_cvarCommons.getDvdMemoryMap());
       if (CDvdFile::Initialize(m_deferredProject)) {
         m_projectInitialized = true;
         m_cvarCommons.m_lastDiscPath->fromLiteral(m_deferredProject);
@@ -255,6 +257,9 @@ public:
 
     const auto targetFrameTime = getTargetFrameTime();
     bool skipRetrace = false;
+    if (m_projectInitialized) {
+      CDvdFile::DispatchCompletions();
+    }
     if (g_ResFactory != nullptr) {
       OPTICK_EVENT("Async Load Resources");
       const auto idleTime = m_limiter.SleepTime(targetFrameTime);
@@ -0,0 +1,97 @@
+#include "Runtime/CMappedFile.hpp"
+
+#include <string>
+
+#if _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#include <nowide/stackstring.hpp>
+#elif __unix__ || __APPLE__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define HAS_POSIX_MMAP
+#endif
+
+#include <logvisor/logvisor.hpp>
+
+namespace metaforce {
+static logvisor::Module Log("metaforce::CMappedFile");
+
+CMappedFile::~CMappedFile() {
+#if _WIN32
+  if (m_data != nullptr) {
+    UnmapViewOfFile(m_data);
+  }
+  if (m_mappingHandle != nullptr) {
+    CloseHandle(m_mappingHandle);
+  }
+  if (m_fileHandle != nullptr && m_fileHandle != INVALID_HANDLE_VALUE) {
+    CloseHandle(m_fileHandle);
+  }
+#elif defined(HAS_POSIX_MMAP)
+  if (m_data != nullptr) {
+    munmap(const_cast<u8*>(m_data), m_size);
+  }
+#endif
+}
+
+std::shared_ptr<CMappedFile> CMappedFile::Open(std::string_view path) {
+  if constexpr (sizeof(void*) < 8) {
+    // Whole disc images don't fit comfortably in a 32-bit address space
+    return nullptr;
+  }
+  const std::string pathStr{path};
+  auto ret = std::make_shared<CMappedFile>();
+#if _WIN32
+  const nowide::wstackstring wpath(pathStr.c_str());
+  ret->m_fileHandle = CreateFileW(wpath.get(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (ret->m_fileHandle == INVALID_HANDLE_VALUE) {
+    return nullptr;
+  }
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(ret->m_fileHandle, &size) || size.QuadPart == 0) {
+    return nullptr;
+  }
+  ret->m_mappingHandle = CreateFileMappingW(ret->m_fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (ret->m_mappingHandle == nullptr) {
+    return nullptr;
+  }
+  ret->m_data = static_cast<const u8*>(MapViewOfFile(ret->m_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+  if (ret->m_data == nullptr) {
+    return nullptr;
+  }
+  ret->m_size = u64(size.QuadPart);
+#elif defined(HAS_POSIX_MMAP)
+  const int fd = open(pathStr.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return nullptr;
+  }
+  struct stat st {};
+  if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size == 0) {
+    close(fd);
+    return nullptr;
+  }
+  void* data = mmap(nullptr, size_t(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+  // The mapping holds its own reference to the file
+  close(fd);
+  if (data == MAP_FAILED) {
+    Log.report(logvisor::Warning, FMT_STRING("Unable to map '{}'"), path);
+    return nullptr;
+  }
+  ret->m_data = static_cast<const u8*>(data);
+  ret->m_size = u64(st.st_size);
+#else
+  return nullptr;
+#endif
+  return ret;
+}
+
+} // namespace metaforce
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <memory>
+#include <string_view>
+
+#include "Runtime/GCNTypes.hpp"
+
+namespace metaforce {
+
+/* Read-only memory mapping of a host file. Shared ownership keeps the mapping alive for as long as any
+ * view into it (PAK backends, in-flight loads) still exists. */
+class CMappedFile {
+  const u8* m_data = nullptr;
+  u64 m_size = 0;
+#if _WIN32
+  void* m_fileHandle = nullptr;
+  void* m_mappingHandle = nullptr;
+#endif
+
+public:
+  CMappedFile() = default;
+  ~CMappedFile();
+  CMappedFile(const CMappedFile&) = delete;
+  CMappedFile& operator=(const CMappedFile&) = delete;
+
+  static std::shared_ptr<CMappedFile> Open(std::string_view path);
+
+  const u8* GetData() const { return m_data; }
+  u64 GetSize() const { return m_size; }
+};
+
+/* Borrowed byte range inside a mapping */
+struct SMappedView {
+  std::shared_ptr<CMappedFile> x0_mapping;
+  const u8* x8_data = nullptr;
+  u32 xc_size = 0;
+
+  explicit operator bool() const { return x8_data != nullptr; }
+};
+
+} // namespace metaforce
@@ -1,15 +1,22 @@
 #include "Runtime/CObjectList.hpp"
 
+#include <algorithm>
+
 #include <logvisor/logvisor.hpp>
 namespace metaforce {
 namespace {
 logvisor::Module Log("metaforce::CObjectList");
 }
 
-CObjectList::CObjectList(EGameObjectList listEnum) : x2004_listEnum(listEnum) {}
+CObjectList::CObjectList(EGameObjectList listEnum, EObjectListOrder order) : x2004_listEnum(listEnum), m_order(order) {}
 
 void CObjectList::AddObject(CEntity& entity) {
   if (IsQualified(entity)) {
+    const size_t idx = entity.GetUniqueId().Value();
+    if (idx >= x0_list.size()) {
+      x0_list.resize(idx + 1);
+      m_denseIdx.resize(idx + 1, -1);
+    }
 #ifndef NDEBUG
     if (x0_list[entity.GetUniqueId().Value()].entity != nullptr &&
         x0_list[entity.GetUniqueId().Value()].entity != &entity)
@@ -17,6 +24,15 @@ void CObjectList::AddObject(CEntity& entity) {
                  FMT_STRING("INVALID USAGE DETECTED: Attempting to assign entity '{} ({})' to existing node '{}'!!!"),
                  entity.GetName(), entity.GetEditorId(), entity.GetUniqueId().Value());
 #endif
+    if (m_denseEnd == m_dense.size()) {
+      // Squeeze out holes before growing, so the array never outgrows the most entities live at once; a live view
+      // still needs every entry where it was, so grow instead
+      if (m_denseEnd != x200a_count && m_denseViews == 0) {
+        CompactDense();
+      } else {
+        m_dense.push_back(nullptr);
+      }
+    }
     s16 prevFirst = -1;
     if (x2008_firstId != -1) {
       x0_list[x2008_firstId].prev = entity.GetUniqueId().Value();
@@ -27,11 +43,20 @@ void CObjectList::AddObject(CEntity& entity) {
     newEnt.entity = &entity;
     newEnt.next = prevFirst;
     newEnt.prev = -1;
+    m_dense[m_denseEnd] = &entity;
+    m_denseIdx[x2008_firstId] = s16(m_denseEnd);
+    ++m_denseEnd;
+    if (x2004_listEnum != EGameObjectList::Invalid) {
+      entity.m_objectListMask |= u8(1u << int(x2004_listEnum));
+    }
     ++x200a_count;
   }
 }
 
 void CObjectList::RemoveObject(TUniqueId uid) {
+  if (uid.Value() >= x0_list.size()) {
+    return;
+  }
   SObjectListEntry& ent = x0_list[uid.Value()];
   if (!ent.entity || ent.entity->GetUniqueId() != uid)
     return;
@@ -44,13 +69,57 @@ void CObjectList::RemoveObject(TUniqueId uid) {
     if (ent.next != -1)
       x0_list[ent.next].prev = ent.prev;
   }
+
+  // Holes left while a view was live go before swapping, so the last entry is never one
+  if (m_order == EObjectListOrder::Unordered && m_denseViews == 0 && m_denseEnd != x200a_count) {
+    CompactDense();
+  }
+  const s16 denseIdx = m_denseIdx[uid.Value()];
+  if (m_order == EObjectListOrder::Stable || m_denseViews != 0) {
+    m_dense[denseIdx] = nullptr;
+  } else {
+    const u16 last = m_denseEnd - 1;
+    if (denseIdx != last) {
+      m_dense[denseIdx] = m_dense[last];
+      m_denseIdx[m_dense[denseIdx]->GetUniqueId().Value()] = denseIdx;
+    }
+    m_dense[last] = nullptr;
+    --m_denseEnd;
+  }
+  m_denseIdx[uid.Value()] = -1;
+  if (x2004_listEnum != EGameObjectList::Invalid) {
+    ent.entity->m_objectListMask &= u8(~(1u << int(x2004_listEnum)));
+  }
+
   ent.entity = nullptr;
   ent.next = -1;
   ent.prev = -1;
   --x200a_count;
+
+  // Compacting once half the array is holes keeps unloading a whole area linear overall
+  if (m_denseViews == 0 && (m_denseEnd - x200a_count) * 2 > m_denseEnd) {
+    CompactDense();
+  }
+}
+
+void CObjectList::CompactDense() {
+  u16 out = 0;
+  for (u16 i = 0; i < m_denseEnd; ++i) {
+    if (m_dense[i] == nullptr) {
+      continue;
+    }
+    m_dense[out] = m_dense[i];
+    m_denseIdx[m_dense[out]->GetUniqueId().Value()] = s16(out);
+    ++out;
+  }
+  std::fill(m_dense.begin() + out, m_dense.begin() + m_denseEnd, nullptr);
+  m_denseEnd = out;
 }
 
 const CEntity* CObjectList::operator[](size_t i) const {
+  if (i >= x0_list.size()) {
+    return nullptr;
+  }
   const SObjectListEntry& ent = x0_list[i];
   if (!ent.entity || ent.entity->x30_26_scriptingBlocked)
     return nullptr;
@@ -58,6 +127,9 @@ const CEntity* CObjectList::operator[](size_t i) const {
 }
 
 CEntity* CObjectList::operator[](size_t i) {
+  if (i >= x0_list.size()) {
+    return nullptr;
+  }
   SObjectListEntry& ent = x0_list[i];
   if (!ent.entity || ent.entity->x30_26_scriptingBlocked)
     return nullptr;
@@ -65,7 +137,7 @@ CEntity* CObjectList::operator[](size_t i) {
 }
 
 const CEntity* CObjectList::GetObjectById(TUniqueId uid) const {
-  if (uid == kInvalidUniqueId)
+  if (uid == kInvalidUniqueId || uid.Value() >= x0_list.size())
     return nullptr;
   const SObjectListEntry& ent = x0_list[uid.Value()];
   if (!ent.entity || ent.entity->x30_26_scriptingBlocked)
@@ -74,7 +146,7 @@ const CEntity* CObjectList::GetObjectById(TUniqueId uid) const {
 }
 
 CEntity* CObjectList::GetObjectById(TUniqueId uid) {
-  if (uid == kInvalidUniqueId)
+  if (uid == kInvalidUniqueId || uid.Value() >= x0_list.size())
     return nullptr;
   SObjectListEntry& ent = x0_list[uid.Value()];
   if (!ent.entity || ent.entity->x30_26_scriptingBlocked)
@@ -83,7 +155,7 @@ CEntity* CObjectList::GetObjectById(TUniqueId uid) {
 }
 
 const CEntity* CObjectList::GetValidObjectById(TUniqueId uid) const {
-  if (uid == kInvalidUniqueId)
+  if (uid == kInvalidUniqueId || uid.Value() >= x0_list.size())
     return nullptr;
   const SObjectListEntry& ent = x0_list[uid.Value()];
   if (!ent.entity)
@@ -94,7 +166,7 @@ const CEntity* CObjectList::GetValidObjectById(TUniqueId uid) const {
 }
 
 CEntity* CObjectList::GetValidObjectById(TUniqueId uid) {
-  if (uid == kInvalidUniqueId)
+  if (uid == kInvalidUniqueId || uid.Value() >= x0_list.size())
     return nullptr;
   SObjectListEntry& ent = x0_list[uid.Value()];
   if (!ent.entity)
@@ -1,6 +1,6 @@
 #pragma once
 
-#include <array>
+#include <vector>
 
 #include "Runtime/RetroTypes.hpp"
 #include "Runtime/World/CEntity.hpp"
@@ -19,6 +19,11 @@ enum class EGameObjectList {
   PlatformAndDoor,
 };
 
+/* Metaforce addition: how RemoveObject keeps the packed entity array. Stable preserves begin()/end() order by leaving a
+ * hole that is compacted out once holes make up half the array; Unordered swaps the last entity into the hole unless
+ * a dense view is live. */
+enum class EObjectListOrder { Stable, Unordered };
+
 class CObjectList {
   friend class CGameArea;
 
@@ -27,11 +32,24 @@ class CObjectList {
     s16 next = -1;
     s16 prev = -1;
   };
-  std::array<SObjectListEntry, kMaxEntities> x0_list; // was an rstl::reserved_vector
+  // Metaforce addition: grows to the highest unique id value added rather than holding kMaxEntities entries, since
+  // every area keeps a list of its own
+  std::vector<SObjectListEntry> x0_list; // was an rstl::reserved_vector
   EGameObjectList x2004_listEnum;
   s16 x2008_firstId = -1;
   u16 x200a_count = 0;
 
+  // Metaforce addition: live entities packed in insertion order, so the list reads backwards in begin()/end() order.
+  // Entries [0, m_denseEnd) are in use; Stable removals leave nullptr holes among them until CompactDense.
+  std::vector<CEntity*> m_dense;
+  std::vector<s16> m_denseIdx; // parallel to x0_list
+  u16 m_denseEnd = 0;
+  EObjectListOrder m_order;
+  // Metaforce addition: dense views alive; while any is, entries keep their index so the views can keep walking
+  mutable u16 m_denseViews = 0;
+
+  void CompactDense();
+
 public:
   class iterator {
     friend class CObjectList;
@@ -65,6 +83,54 @@ public:
     const CEntity* operator*() const { return m_list.GetObjectByIndex(m_id); }
   };
 
+  /* Live entities as a contiguous range; in begin()/end() order for Stable lists. Entities added while iterating are
+   * not visited, like with begin()/end(). Removals while the view lives leave holes in either order and nothing is
+   * compacted until it is gone, so entities may be added and removed freely during iteration. */
+  class dense_view {
+    friend class CObjectList;
+    const CObjectList* m_list;
+    u16 m_end;
+    u16 m_size;
+    dense_view(const CObjectList& list) : m_list(&list), m_end(list.m_denseEnd), m_size(list.x200a_count) {
+      ++m_list->m_denseViews;
+    }
+
+  public:
+    dense_view(const dense_view& other) : m_list(other.m_list), m_end(other.m_end), m_size(other.m_size) {
+      ++m_list->m_denseViews;
+    }
+    dense_view& operator=(const dense_view&) = delete;
+    ~dense_view() { --m_list->m_denseViews; }
+
+    /* Walks the array backwards from the newest entry, stepping over holes. Holds an index rather than a pointer, as
+     * the array may grow underneath it. */
+    class iterator {
+      friend class dense_view;
+      const CObjectList* m_list;
+      u16 m_cur; // one past the current entry
+      iterator(const CObjectList* list, u16 cur) : m_list(list), m_cur(cur) { SkipHoles(); }
+      void SkipHoles() {
+        while (m_cur != 0 && m_list->m_dense[m_cur - 1] == nullptr) {
+          --m_cur;
+        }
+      }
+
+    public:
+      iterator& operator++() {
+        --m_cur;
+        SkipHoles();
+        return *this;
+      }
+      bool operator==(const iterator& other) const { return m_cur == other.m_cur; }
+      bool operator!=(const iterator& other) const { return !operator==(other); }
+      CEntity* operator*() const { return m_list->m_dense[m_cur - 1]; }
+    };
+
+    [[nodiscard]] iterator begin() const { return iterator(m_list, m_end); }
+    [[nodiscard]] iterator end() const { return iterator(m_list, 0); }
+    [[nodiscard]] size_t size() const { return m_size; }
+  };
+
   [[nodiscard]] iterator begin() { return iterator(*this, x2008_firstId); }
   [[nodiscard]] iterator end() { return iterator(*this, -1); }
   [[nodiscard]] const_iterator begin() const { return const_iterator(*this, x2008_firstId); }
@@ -72,7 +138,7 @@ public:
   [[nodiscard]] const_iterator cbegin() const { return begin(); }
   [[nodiscard]] const_iterator cend() const { return end(); }
 
-  explicit CObjectList(EGameObjectList listEnum);
+  explicit CObjectList(EGameObjectList listEnum, EObjectListOrder order = EObjectListOrder::Stable);
   virtual ~CObjectList() = default;
 
   void AddObject(CEntity& entity);
@@ -80,8 +146,10 @@ public:
   const CEntity* operator[](size_t i) const;
   CEntity* operator[](size_t i);
   const CEntity* GetObjectById(TUniqueId uid) const;
-  const CEntity* GetObjectByIndex(s16 index) const { return x0_list[index].entity; }
-  CEntity* GetObjectByIndex(s16 index) { return x0_list[index].entity; }
+  const CEntity* GetObjectByIndex(s16 index) const {
+    return size_t(index) < x0_list.size() ? x0_list[index].entity : nullptr;
+  }
+  CEntity* GetObjectByIndex(s16 index) { return size_t(index) < x0_list.size() ? x0_list[index].entity : nullptr; }
   CEntity* GetObjectById(TUniqueId uid);
   const CEntity* GetValidObjectById(TUniqueId uid) const;
   CEntity* GetValidObjectById(TUniqueId uid);
@@ -89,6 +157,7 @@ public:
   s16 GetNextObjectIndex(s16 prev) const { return x0_list[prev].next; }
   virtual bool IsQualified(const CEntity&) const;
   u16 size() const { return x200a_count; }
+  [[nodiscard]] dense_view GetDenseView() const { return dense_view(*this); }
 };
 
 } // namespace metaforce
@@ -14,6 +14,7 @@ namespace metaforce {
 
 class CPakFile : public CDvdFile {
   friend class CResLoader;
+  friend class CAssetIndex;
 
 public:
   struct SResInfo {
@@ -0,0 +1,108 @@
+#include "Runtime/CPoseSnapshot.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+#include "Runtime/CStateManager.hpp"
+#include "Runtime/World/CActor.hpp"
+#include "Runtime/World/CPhysicsActor.hpp"
+#include "Runtime/World/CWorld.hpp"
+
+#include "TCastTo.hpp" // Generated file, do not modify include path
+
+#include <fmt/format.h>
+
+namespace metaforce {
+namespace {
+double ToMs(std::chrono::nanoseconds time) { return std::chrono::duration<double, std::milli>(time).count(); }
+} // namespace
+
+bool CPoseSnapshot::Capture(CStateManager& mgr) {
+  const CWorld* world = mgr.GetWorld();
+  if (world == nullptr) {
+    return false;
+  }
+
+  m_worldId = world->IGetWorldAssetId();
+  m_poses.clear();
+  for (CEntity* ent : mgr.GetAllObjectList().GetDenseView()) {
+    const TCastToConstPtr<CActor> act = ent;
+    if (!act || act->IsInGraveyard()) {
+      continue;
+    }
+
+    SPose& pose = m_poses.emplace_back();
+    pose.x0_uid = act->GetUniqueId();
+    pose.x4_transform = act->GetTransform();
+    if (const TCastToConstPtr<CPhysicsActor> phys = ent) {
+      pose.x2_physics = true;
+      pose.x34_velocity = phys->GetVelocity();
+      pose.x40_angularVelocity = phys->GetAngularVelocityWR();
+    }
+  }
+
+  m_valid = true;
+  return true;
+}
+
+bool CPoseSnapshot::Restore(CStateManager& mgr, SRestoreStats* stats) const {
+  const CWorld* world = mgr.GetWorld();
+  if (!m_valid || world == nullptr || world->IGetWorldAssetId() != m_worldId) {
+    return false;
+  }
+
+  SRestoreStats localStats;
+  SRestoreStats& out = stats != nullptr ? *stats : localStats;
+  out = {};
+
+  for (const SPose& pose : m_poses) {
+    const TCastToPtr<CActor> act = mgr.ObjectById(pose.x0_uid);
+    if (!act || act->GetUniqueId() != pose.x0_uid || act->IsInGraveyard()) {
+      ++out.x4_missing;
+      continue;
+    }
+
+    act->SetTransform(pose.x4_transform);
+    if (pose.x2_physics) {
+      auto& phys = static_cast<CPhysicsActor&>(*act);
+      phys.ClearForcesAndTorques();
+      phys.ClearImpulses();
+      phys.SetVelocityWR(pose.x34_velocity);
+      phys.SetAngularVelocityWR(pose.x40_angularVelocity);
+    }
+    mgr.UpdateActorInSortedLists(*act);
+    ++out.x0_restored;
+  }
+  return true;
+}
+
+std::string CPoseSnapshot::Benchmark(CStateManager& mgr, u32 iterations) {
+  using Clock = std::chrono::steady_clock;
+  iterations = std::max(iterations, 1u);
+  std::vector<std::chrono::nanoseconds> captures;
+  std::vector<std::chrono::nanoseconds> restores;
+  CPoseSnapshot snapshot;
+  for (u32 i = 0; i < iterations; ++i) {
+    const auto start = Clock::now();
+    if (!snapshot.Capture(mgr)) {
+      return "capture failed";
+    }
+    captures.push_back(Clock::now() - start);
+  }
+  for (u32 i = 0; i < iterations; ++i) {
+    const auto start = Clock::now();
+    if (!snapshot.Restore(mgr)) {
+      return "restore failed";
+    }
+    restores.push_back(Clock::now() - start);
+  }
+
+  std::sort(captures.begin(), captures.end());
+  std::sort(restores.begin(), restores.end());
+  return fmt::format(
+      FMT_STRING("{} actors in {} bytes; capture {:.3f}/{:.3f} ms, restore {:.3f}/{:.3f} ms (p50/max over {})"),
+      snapshot.GetActorCount(), snapshot.GetSizeBytes(), ToMs(captures[captures.size() / 2]), ToMs(captures.back()),
+      ToMs(restores[restores.size() / 2]), ToMs(restores.back()), iterations);
+}
+
+} // namespace metaforce
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Runtime/RetroTypes.hpp"
+
+#include <zeus/CAxisAngle.hpp>
+#include <zeus/CTransform.hpp>
+#include <zeus/CVector3f.hpp>
+
+namespace metaforce {
+class CStateManager;
+
+/* Metaforce addition: in-memory poses of the actors of a running CStateManager, for putting a scene back into place
+ * while testing. Capture copies every live actor's transform and, for physics actors, velocities; Restore puts them
+ * back on the actors that are still live under the same unique id. Nothing else is touched: AI state machines,
+ * timers, health, script state, the camera and the random seed carry on from where they are, and actors spawned or
+ * freed since the capture stay that way. Captures reuse their storage, so capturing into the same snapshot again does
+ * not allocate. */
+class CPoseSnapshot {
+public:
+  struct SPose {
+    TUniqueId x0_uid;
+    bool x2_physics = false;
+    zeus::CTransform x4_transform;
+    zeus::CVector3f x34_velocity;
+    zeus::CAxisAngle x40_angularVelocity;
+  };
+
+  struct SRestoreStats {
+    u32 x0_restored = 0; /* Actors put back into their captured pose */
+    u32 x4_missing = 0;  /* Captured actors freed since */
+  };
+
+private:
+  bool m_valid = false;
+  CAssetId m_worldId;
+  std::vector<SPose> m_poses;
+
+public:
+  bool IsValid() const { return m_valid; }
+  CAssetId GetWorldId() const { return m_worldId; }
+  size_t GetActorCount() const { return m_poses.size(); }
+  /* Bytes held by the pose array */
+  size_t GetSizeBytes() const { return m_poses.size() * sizeof(SPose); }
+
+  bool Capture(CStateManager& mgr);
+  /* Call between updates. Fails without changing anything when the snapshot is from another world. */
+  bool Restore(CStateManager& mgr, SRestoreStats* stats = nullptr) const;
+
+  /* Captures the current poses iterations times, then restores them as often; returns p50/max times in ms */
+  static std::string Benchmark(CStateManager& mgr, u32 iterations);
+};
+
+} // namespace metaforce
@@ -1,46 +1,204 @@
 #include "Runtime/CResFactory.hpp"
 
+#include "Runtime/CResLoadTrace.hpp"
 #include "Runtime/CSimplePool.hpp"
 #include "Runtime/CStopwatch.hpp"
+#include "Runtime/Streams/CMemoryInStream.hpp"
 #include "optick.h"
 
 namespace metaforce {
 static logvisor::Module Log("CResFactory");
 
-void CResFactory::AddToLoadList(SLoadingData&& data) {
+namespace {
+/* Compressed PAK entries lead with their big-endian inflated length */
+u32 GetInflatedSize(const u8* data, u32 size, bool compressed) {
+  if (!compressed || size < 4) {
+    return size;
+  }
+  return CMemoryInStream(data, 4, CMemoryInStream::EOwnerShip::NotOwned).ReadLong();
+}
+} // namespace
+
+CResFactory::CResFactory() {
+  if (const u32 threadCount = CWorkerPool::DefaultThreadCount()) {
+    m_inflatePool = std::make_unique<CWorkerPool>("CResFactory Inflate", threadCount);
+  }
+}
+
+CResFactory::~CResFactory() {
+  // Drain and join inflate workers before the load list goes away
+  m_inflatePool.reset();
+}
+
+CResFactory::SLoadingData& CResFactory::AddToLoadList(SLoadingData&& data) {
   const SObjectTag tag = data.x0_tag;
-  m_loadMap.insert_or_assign(tag, m_loadList.insert(m_loadList.end(), std::move(data)));
+  const auto it = m_loadList.insert(m_loadList.end(), std::move(data));
+  m_loadMap.insert_or_assign(tag, it);
+  return *it;
 }
 
 CFactoryFnReturn CResFactory::BuildSync(const SObjectTag& tag, const CVParamTransfer& xfer, CObjectReference* selfRef) {
+  SResLoadRecord trace{tag};
+  trace.xc_compressedSize = x4_loader.ResourceSize(tag);
+  trace.x10_size = trace.xc_compressedSize;
+  trace.x38_syncBuilt = true;
+  auto stageStart = std::chrono::steady_clock::now();
+  const auto endStage = [&stageStart](std::chrono::nanoseconds& out) {
+    const auto now = std::chrono::steady_clock::now();
+    out = now - stageStart;
+    stageStart = now;
+  };
+
   CFactoryFnReturn ret;
-  if (x5c_factoryMgr.CanMakeMemory(tag)) {
+  if (x4_loader.GetInflateCache() != nullptr && x4_loader.GetResourceCompression(tag)) {
+    u32 size = 0;
+    if (std::unique_ptr<u8[]> data = x4_loader.LoadInflatedResourceSync(tag, size)) {
+      // Read and inflate (or the cache hit standing in for both) happen inside one call
+      endStage(trace.x28_inflate);
+      trace.x10_size = size;
+      ret = x5c_factoryMgr.MakeObjectFromMemory(tag, std::move(data), size, false, xfer, selfRef);
+    } else {
+      ret = std::make_unique<TObjOwnerDerivedFromIObjUntyped>(nullptr);
+    }
+  } else if (const SMappedView view = x4_loader.GetMappedResource(tag)) {
+    const bool compressed = x4_loader.GetResourceCompression(tag);
+    trace.x10_size = GetInflatedSize(view.x8_data, view.xc_size, compressed);
+    ret = x5c_factoryMgr.MakeObjectFromView(tag, view, compressed, xfer, selfRef);
+  } else if (x5c_factoryMgr.CanMakeMemory(tag)) {
     std::unique_ptr<uint8_t[]> data;
     int size = 0;
     x4_loader.LoadMemResourceSync(tag, data, &size);
-    if (size)
-      ret = x5c_factoryMgr.MakeObjectFromMemory(tag, std::move(data), size, x4_loader.GetResourceCompression(tag), xfer,
-                                                selfRef);
-    else
+    endStage(trace.x20_read);
+    if (size) {
+      const bool compressed = x4_loader.GetResourceCompression(tag);
+      trace.x10_size = GetInflatedSize(data.get(), u32(size), compressed);
+      ret = x5c_factoryMgr.MakeObjectFromMemory(tag, std::move(data), size, compressed, xfer, selfRef);
+    } else
       ret = std::make_unique<TObjOwnerDerivedFromIObjUntyped>(nullptr);
   } else {
-    if (auto rp = x4_loader.LoadNewResourceSync(tag, nullptr))
+    if (auto rp = x4_loader.LoadNewResourceSync(tag, nullptr)) {
+      endStage(trace.x20_read);
       ret = x5c_factoryMgr.MakeObject(tag, *rp, xfer, selfRef);
-    else
+    } else
       ret = std::make_unique<TObjOwnerDerivedFromIObjUntyped>(nullptr);
   }
+  endStage(trace.x30_factory);
+  CResLoadTrace::Record(trace);
   Log.report(logvisor::Warning, FMT_STRING("sync-built {}"), tag);
   return ret;
 }
 
+template <typename MakeFn>
+void CResFactory::FinishBuild(SLoadingData& data, u32 size, std::chrono::nanoseconds readTime,
+                              std::chrono::nanoseconds inflateTime, MakeFn&& make) {
+  if (!CResLoadTrace::IsEnabled()) {
+    *data.xc_targetPtr = make();
+  } else {
+    const auto start = std::chrono::steady_clock::now();
+    *data.xc_targetPtr = make();
+    CResLoadTrace::Record({data.x0_tag, data.x14_resSize, size, data.m_queueWait, readTime, inflateTime,
+                           std::chrono::steady_clock::now() - start, false});
+  }
+  Log.report(logvisor::Info, FMT_STRING("async-built {}"), data.x0_tag);
+}
+
+void CResFactory::IssueRead(SLoadingData& data) {
+  // Mapped PAKs skip the DVD queue entirely; the object is built from the mapping on the next pump
+  data.m_mappedView = x4_loader.GetMappedResource(data.x0_tag);
+  if (data.m_mappedView) {
+    return;
+  }
+  data.x10_loadBuffer = std::unique_ptr<u8[]>(new u8[data.x14_resSize]);
+  data.x8_dvdReq = x4_loader.LoadResourceAsync(data.x0_tag, data.x10_loadBuffer.get(), m_buildPriority);
+  // Hand the payload to the inflate pool as soon as the read lands rather than when AsyncIdle next gets to it. Load
+  // list nodes stay put until erased, and erasing one drops the request, which drops the callback with it.
+  data.x8_dvdReq->PostCompletion([this, &data] { FinishRead(data); });
+}
+
+void CResFactory::FinishRead(SLoadingData& data) {
+  data.m_queueWait = data.x8_dvdReq->GetQueueWait();
+  data.m_readTime = data.x8_dvdReq->GetReadTime();
+  data.x8_dvdReq.reset();
+  if (data.m_compressed && m_inflatePool) {
+    StartInflate(data);
+  }
+}
+
+void CResFactory::StartInflate(SLoadingData& data) {
+  auto task = std::make_shared<SInflateTask>();
+  task->m_compBuf = std::move(data.x10_loadBuffer);
+  task->m_compView = std::move(data.m_mappedView);
+  task->m_compSize = data.x14_resSize;
+  task->m_cache = x4_loader.GetInflateCache();
+  task->m_id = data.x0_tag.id;
+  data.m_inflateTask = task;
+  m_inflatePool->Submit([task = std::move(task)]() {
+    const auto start = std::chrono::steady_clock::now();
+    const u8* src = task->m_compView ? task->m_compView.x8_data : task->m_compBuf.get();
+    CInflateCache::SKey cacheKey;
+    if (task->m_cache != nullptr) {
+      cacheKey = CInflateCache::MakeKey(task->m_id, src, task->m_compSize);
+      task->m_decompBuf = task->m_cache->Load(cacheKey, task->m_decompSize);
+    }
+    const bool hit = task->m_decompBuf != nullptr;
+    if (!hit) {
+      task->m_decompBuf = CFactoryMgr::InflateResource(src, task->m_compSize, task->m_decompSize);
+    }
+    task->m_time = std::chrono::steady_clock::now() - start;
+    task->m_compBuf.reset();
+    task->m_compView = {};
+    if (task->m_cache != nullptr && !hit) {
+      task->m_cache->Store(cacheKey, task->m_decompBuf.get(), task->m_decompSize);
+    }
+    task->m_done.store(true, std::memory_order_release);
+    task->m_done.notify_all();
+  });
+}
+
 bool CResFactory::PumpResource(SLoadingData& data) {
   OPTICK_EVENT();
-  if (data.x8_dvdReq && data.x8_dvdReq->IsComplete()) {
-    data.x8_dvdReq.reset();
-    *data.xc_targetPtr =
-        x5c_factoryMgr.MakeObjectFromMemory(data.x0_tag, std::move(data.x10_loadBuffer), data.x14_resSize,
-                                            data.m_compressed, data.x18_cvXfer, data.m_selfRef);
-    Log.report(logvisor::Info, FMT_STRING("async-built {}"), data.x0_tag);
+  if (data.m_inflateTask) {
+    if (!data.m_inflateTask->m_done.load(std::memory_order_acquire)) {
+      return false;
+    }
+    SInflateTask& task = *data.m_inflateTask;
+    // A cache hit stands in for the inflate, so its hash and load time are reported as the inflate
+    FinishBuild(data, task.m_decompSize, data.m_readTime, task.m_time, [&] {
+      return x5c_factoryMgr.MakeObjectFromMemory(data.x0_tag, std::move(task.m_decompBuf), task.m_decompSize, false,
+                                                 data.x18_cvXfer, data.m_selfRef);
+    });
+    data.m_inflateTask.reset();
+    return true;
+  }
+  if (data.m_mappedView) {
+    if (data.m_compressed && m_inflatePool) {
+      StartInflate(data);
+      return false;
+    }
+    const u32 size = GetInflatedSize(data.m_mappedView.x8_data, data.x14_resSize, data.m_compressed);
+    FinishBuild(data, size, data.m_readTime, {}, [&] {
+      return x5c_factoryMgr.MakeObjectFromView(data.x0_tag, data.m_mappedView, data.m_compressed, data.x18_cvXfer,
+                                               data.m_selfRef);
+    });
+    data.m_mappedView = {};
+    return true;
+  }
+  if (data.x8_dvdReq) {
+    // Normally FinishRead already ran from the completion callback; a blocking Build can get here first
+    if (!data.x8_dvdReq->IsComplete()) {
+      return false;
+    }
+    FinishRead(data);
+    if (data.m_inflateTask) {
+      return false;
+    }
+  }
+  if (data.x10_loadBuffer) {
+    const u32 size = GetInflatedSize(data.x10_loadBuffer.get(), data.x14_resSize, data.m_compressed);
+    FinishBuild(data, size, data.m_readTime, {}, [&] {
+      return x5c_factoryMgr.MakeObjectFromMemory(data.x0_tag, std::move(data.x10_loadBuffer), data.x14_resSize,
+                                                 data.m_compressed, data.x18_cvXfer, data.m_selfRef);
+    });
     return true;
   }
   return false;
@@ -50,7 +208,15 @@ std::unique_ptr<IObj> CResFactory::Build(const SObjectTag& tag, const CVParamTra
                                          CObjectReference* selfRef) {
   auto search = m_loadMap.find(tag);
   if (search != m_loadMap.end()) {
-    while (!PumpResource(*search->second) || !search->second->xc_targetPtr) {}
+    SLoadingData& data = *search->second;
+    // Block on the read and inflate stages rather than spinning on them
+    while (!PumpResource(data) || !data.xc_targetPtr) {
+      if (data.m_inflateTask) {
+        data.m_inflateTask->m_done.wait(false, std::memory_order_acquire);
+      } else if (data.x8_dvdReq) {
+        data.x8_dvdReq->WaitUntilComplete();
+      }
+    }
     std::unique_ptr<IObj> ret = std::move(*search->second->xc_targetPtr);
     m_loadList.erase(search->second);
     m_loadMap.erase(search);
@@ -66,9 +232,8 @@ void CResFactory::BuildAsync(const SObjectTag& tag, const CVParamTransfer& xfer,
     SLoadingData data(tag, target, xfer, x4_loader.GetResourceCompression(tag), selfRef);
     data.x14_resSize = x4_loader.ResourceSize(tag);
     if (data.x14_resSize != 0) {
-      data.x10_loadBuffer = std::unique_ptr<u8[]>(new u8[data.x14_resSize]);
-      data.x8_dvdReq = x4_loader.LoadResourceAsync(tag, data.x10_loadBuffer.get());
-      AddToLoadList(std::move(data));
+      // Start once the entry has its final address, which the read's completion callback refers to
+      IssueRead(AddToLoadList(std::move(data)));
     } else {
       *target = std::make_unique<TObjOwnerDerivedFromIObjUntyped>(nullptr);
     }
@@ -81,20 +246,37 @@ bool CResFactory::AsyncIdle(std::chrono::nanoseconds target) {
     return false;
   }
   auto startTime = std::chrono::high_resolution_clock::now();
+  const auto timeLeft = [&]() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() -
+                                                                startTime) < target;
+  };
   do {
-    auto& task = m_loadList.front();
-    if (PumpResource(task)) {
-      m_loadMap.erase(task.x0_tag);
-      m_loadList.pop_front();
-      if (m_loadList.empty()) {
-        return false;
+    // Walk the whole list so completed reads are handed to the inflate pool while earlier entries are still busy
+    for (auto it = m_loadList.begin(); it != m_loadList.end();) {
+      if (PumpResource(*it)) {
+        m_loadMap.erase(it->x0_tag);
+        it = m_loadList.erase(it);
+      } else {
+        ++it;
+      }
+      if (!timeLeft()) {
+        break;
       }
     }
-  } while (std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - startTime) <
-           target);
+    if (m_loadList.empty()) {
+      return false;
+    }
+  } while (timeLeft());
   return true;
 }
 
+void CResFactory::RaiseBuildPriority(const SObjectTag& tag, EDvdPriority priority) {
+  const auto search = m_loadMap.find(tag);
+  if (search != m_loadMap.end()) {
+    CDvdFile::RaisePriority(search->second->x8_dvdReq, priority);
+  }
+}
+
 void CResFactory::CancelBuild(const SObjectTag& tag) {
   auto search = m_loadMap.find(tag);
   if (search != m_loadMap.end()) {
@@ -107,15 +289,17 @@ void CResFactory::CancelBuild(const SObjectTag& tag) {
 
 void CResFactory::LoadPersistentResources(CSimplePool& sp) {
   const auto& paks = x4_loader.GetPaks();
+  std::vector<SObjectTag> tags;
   for (const auto & pak : paks) {
     if (!pak->IsWorldPak()) {
       for (const CAssetId& id : pak->GetDepList()) {
-        SObjectTag tag(GetResourceTypeById(id), id);
-        m_nonWorldTokens.push_back(sp.GetObj(tag));
-        m_nonWorldTokens.back().Lock();
+        tags.emplace_back(GetResourceTypeById(id), id);
       }
     }
   }
+  std::vector<CToken> tokens = sp.GetObjs(tags).ReleaseTokens();
+  m_nonWorldTokens.insert(m_nonWorldTokens.end(), std::make_move_iterator(tokens.begin()),
+                          std::make_move_iterator(tokens.end()));
 }
 
 } // namespace metaforce
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <list>
 #include <memory>
 #include <unordered_map>
@@ -7,6 +9,7 @@
 
 #include "Runtime/CResLoader.hpp"
 #include "Runtime/CToken.hpp"
+#include "Runtime/CWorkerPool.hpp"
 #include "Runtime/IFactory.hpp"
 #include "Runtime/IVParamObj.hpp"
 
@@ -19,6 +22,21 @@ class CResFactory : public IFactory {
   CFactoryMgr x5c_factoryMgr;
 
 public:
+  /* Compressed payload handed to the inflate pool once its DVD read completes (or straight from a mapped PAK).
+   * With the inflate cache enabled, the worker hashes the payload and either reads the inflated bytes back from the
+   * cache or inflates and stores them. */
+  struct SInflateTask {
+    std::unique_ptr<u8[]> m_compBuf;
+    SMappedView m_compView;
+    u32 m_compSize = 0;
+    std::unique_ptr<u8[]> m_decompBuf;
+    u32 m_decompSize = 0;
+    CInflateCache* m_cache = nullptr;
+    CAssetId m_id;
+    std::chrono::nanoseconds m_time{}; /* Time the worker spent inflating or reading the cache entry */
+    std::atomic_bool m_done = false;
+  };
+
   struct SLoadingData {
     SObjectTag x0_tag;
     std::shared_ptr<IDvdRequest> x8_dvdReq;
@@ -28,6 +46,10 @@ public:
     CVParamTransfer x18_cvXfer;
     bool m_compressed = false;
     CObjectReference* m_selfRef = nullptr;
+    std::shared_ptr<SInflateTask> m_inflateTask;
+    SMappedView m_mappedView;
+    std::chrono::nanoseconds m_queueWait{}; /* Copied from x8_dvdReq for CResLoadTrace before it is released */
+    std::chrono::nanoseconds m_readTime{};
 
     SLoadingData() = default;
     SLoadingData(const SObjectTag& tag, std::unique_ptr<IObj>* ptr, const CVParamTransfer& xfer, bool compressed,
@@ -39,16 +61,32 @@ private:
   std::list<SLoadingData> m_loadList;
   std::unordered_map<SObjectTag, std::list<SLoadingData>::iterator> m_loadMap;
   std::vector<CToken> m_nonWorldTokens; /* URDE: always keep non-world resources resident */
-  void AddToLoadList(SLoadingData&& data);
+  std::unique_ptr<CWorkerPool> m_inflatePool; /* Metaforce addition: keeps zlib off the game thread */
+  EDvdPriority m_buildPriority = EDvdPriority::AreaData;
+  SLoadingData& AddToLoadList(SLoadingData&& data);
+  void IssueRead(SLoadingData& data);
+  void FinishRead(SLoadingData& data);
+  void StartInflate(SLoadingData& data);
   CFactoryFnReturn BuildSync(const SObjectTag&, const CVParamTransfer&, CObjectReference* selfRef);
   bool PumpResource(SLoadingData& data);
+  template <typename MakeFn>
+  void FinishBuild(SLoadingData& data, u32 size, std::chrono::nanoseconds readTime,
+                   std::chrono::nanoseconds inflateTime, MakeFn&& make);
 
 public:
+  CResFactory();
+  ~CResFactory() override;
+
   CResLoader& GetLoader() { return x4_loader; }
   std::unique_ptr<IObj> Build(const SObjectTag&, const CVParamTransfer&, CObjectReference* selfRef) override;
   void BuildAsync(const SObjectTag&, const CVParamTransfer&, std::unique_ptr<IObj>*,
                   CObjectReference* selfRef) override;
   bool AsyncIdle(std::chrono::nanoseconds target) override;
+  void SetBuildPriority(EDvdPriority priority) override { m_buildPriority = priority; }
+  void RaiseBuildPriority(const SObjectTag& tag, EDvdPriority priority) override;
+  u64 GetLoadOrder(const SObjectTag& tag) const override { return x4_loader.GetResourceDiscOffset(tag); }
+  void BeginBuildBatch() override { CDvdFile::BeginBatch(); }
+  void EndBuildBatch() override { CDvdFile::EndBatch(); }
   void CancelBuild(const SObjectTag&) override;
 
   bool CanBuild(const SObjectTag& tag) override { return x4_loader.ResourceExists(tag); }
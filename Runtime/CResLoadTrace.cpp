@@ -0,0 +1,112 @@
+#include "Runtime/CResLoadTrace.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <utility>
+
+#include <logvisor/logvisor.hpp>
+
+namespace metaforce {
+namespace {
+logvisor::Module Log("metaforce::CResLoadTrace");
+
+#ifdef _MSC_VER
+constexpr const char* WriteMode = "w";
+#else
+constexpr const char* WriteMode = "we";
+#endif
+
+std::atomic_bool s_enabled = false;
+std::mutex s_mutex;
+std::vector<SResLoadRecord> s_records;
+
+double ToMs(std::chrono::nanoseconds time) { return std::chrono::duration<double, std::milli>(time).count(); }
+
+/* Nearest-rank percentile over an already sorted list */
+std::chrono::nanoseconds Percentile(const std::vector<std::chrono::nanoseconds>& sorted, u32 pct) {
+  if (sorted.empty()) {
+    return {};
+  }
+  const size_t rank = (sorted.size() * pct + 99) / 100;
+  return sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1];
+}
+} // namespace
+
+void CResLoadTrace::SetEnabled(bool enabled) { s_enabled.store(enabled, std::memory_order_relaxed); }
+
+bool CResLoadTrace::IsEnabled() { return s_enabled.load(std::memory_order_relaxed); }
+
+void CResLoadTrace::Record(const SResLoadRecord& record) {
+  if (!IsEnabled()) {
+    return;
+  }
+  std::unique_lock lk{s_mutex};
+  s_records.push_back(record);
+}
+
+std::vector<SResLoadRecord> CResLoadTrace::TakeRecords() {
+  std::unique_lock lk{s_mutex};
+  return std::exchange(s_records, {});
+}
+
+bool CResLoadTrace::WriteCSV(const std::string& path, const std::vector<SResLoadRecord>& records) {
+  FILE* file = fopen(path.c_str(), WriteMode);
+  if (file == nullptr) {
+    Log.report(logvisor::Error, FMT_STRING("unable to open '{}' for writing"), path);
+    return false;
+  }
+  fmt::print(file, FMT_STRING("type,id,compressedSize,size,queueWaitMs,readMs,inflateMs,factoryMs,syncBuilt\n"));
+  for (const SResLoadRecord& rec : records) {
+    fmt::print(file, FMT_STRING("{},{},{},{},{:.4f},{:.4f},{:.4f},{:.4f},{}\n"), rec.x0_tag.type, rec.x0_tag.id,
+               rec.xc_compressedSize, rec.x10_size, ToMs(rec.x18_queueWait), ToMs(rec.x20_read),
+               ToMs(rec.x28_inflate), ToMs(rec.x30_factory), rec.x38_syncBuilt ? 1 : 0);
+  }
+  const bool ok = ferror(file) == 0;
+  fclose(file);
+  return ok;
+}
+
+std::string CResLoadTrace::Summarize(const std::vector<SResLoadRecord>& records) {
+  using Stage = std::chrono::nanoseconds (*)(const SResLoadRecord&);
+  static constexpr std::array<std::pair<std::string_view, Stage>, 5> Stages{{
+      {"total", [](const SResLoadRecord& rec) { return rec.GetTotalTime(); }},
+      {"queue", [](const SResLoadRecord& rec) { return rec.x18_queueWait; }},
+      {"read", [](const SResLoadRecord& rec) { return rec.x20_read; }},
+      {"inflate", [](const SResLoadRecord& rec) { return rec.x28_inflate; }},
+      {"factory", [](const SResLoadRecord& rec) { return rec.x30_factory; }},
+  }};
+
+  std::map<u32, std::vector<const SResLoadRecord*>> byType;
+  for (const SResLoadRecord& rec : records) {
+    byType[rec.x0_tag.type.toUint32()].push_back(&rec);
+  }
+
+  std::string ret = fmt::format(FMT_STRING("{} resources, times in ms as p50/p90/p99/max\n"), records.size());
+  std::vector<std::chrono::nanoseconds> times;
+  for (const auto& [type, typeRecords] : byType) {
+    u64 bytes = 0;
+    u32 syncCount = 0;
+    for (const SResLoadRecord* rec : typeRecords) {
+      bytes += rec->xc_compressedSize;
+      syncCount += rec->x38_syncBuilt ? 1 : 0;
+    }
+    ret += fmt::format(FMT_STRING("{} count={} sync={} bytes={}"), FourCC(type), typeRecords.size(), syncCount, bytes);
+    for (const auto& [name, stage] : Stages) {
+      times.clear();
+      for (const SResLoadRecord* rec : typeRecords) {
+        times.push_back(stage(*rec));
+      }
+      std::sort(times.begin(), times.end());
+      ret += fmt::format(FMT_STRING(" {}={:.2f}/{:.2f}/{:.2f}/{:.2f}"), name, ToMs(Percentile(times, 50)),
+                         ToMs(Percentile(times, 90)), ToMs(Percentile(times, 99)), ToMs(times.back()));
+    }
+    ret += '\n';
+  }
+  return ret;
+}
+
+} // namespace metaforce
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Runtime/RetroTypes.hpp"
+
+namespace metaforce {
+
+/* One record per resource built by CResFactory. Stage times are wall-clock; a stage the resource skipped
+ * (an uncompressed asset has no inflate, a mapped PAK has no queue wait) stays zero. */
+struct SResLoadRecord {
+  SObjectTag x0_tag;
+  u32 xc_compressedSize = 0; /* Bytes stored in the PAK */
+  u32 x10_size = 0;          /* Bytes handed to the factory; equal to xc_compressedSize when uncompressed */
+  std::chrono::nanoseconds x18_queueWait{};
+  std::chrono::nanoseconds x20_read{};
+  std::chrono::nanoseconds x28_inflate{};
+  std::chrono::nanoseconds x30_factory{};
+  bool x38_syncBuilt = false;
+
+  std::chrono::nanoseconds GetTotalTime() const { return x18_queueWait + x20_read + x28_inflate + x30_factory; }
+};
+
+/* Metaforce addition: process-wide resource load trace. Recording is off until SetEnabled(true), so the
+ * only cost in normal play is one relaxed load per built resource. */
+class CResLoadTrace {
+public:
+  static void SetEnabled(bool enabled);
+  static bool IsEnabled();
+  static void Record(const SResLoadRecord& record);
+  /* Hands over everything recorded so far and starts a fresh trace */
+  static std::vector<SResLoadRecord> TakeRecords();
+
+  static bool WriteCSV(const std::string& path, const std::vector<SResLoadRecord>& records);
+  /* Per-type p50/p90/p99/max of each stage, one type per line, in milliseconds */
+  static std::string Summarize(const std::vector<SResLoadRecord>& records);
+};
+
+} // namespace metaforce
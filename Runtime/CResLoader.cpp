@@ -2,10 +2,12 @@
 
 #include "Runtime/CPakFile.hpp"
 
+#include <cstring>
+
 namespace metaforce {
 static logvisor::Module Log("CResLoader");
 
-CResLoader::CResLoader() { x48_curPak = x18_pakLoadedList.end(); }
+CResLoader::CResLoader() = default;
 
 const std::vector<CAssetId>* CResLoader::GetTagListForFile(std::string_view name) const {
   const std::string namePak = std::string(name).append(".pak");
@@ -43,7 +45,7 @@ std::unique_ptr<CInputStream> CResLoader::LoadNewResourcePartSync(const SObjectT
   }
 
   CPakFile* const file = FindResourceForLoad(tag);
-  file->SyncSeekRead(buf, length, ESeekOrigin::Begin, x50_cachedResInfo->GetOffset() + offset);
+  ReadFromPak(*file, buf, length, x50_cachedResInfo->GetOffset() + offset);
   return std::make_unique<CMemoryInStream>(
       buf, length, extBuf == nullptr ? CMemoryInStream::EOwnerShip::Owned : CMemoryInStream::EOwnerShip::NotOwned);
 }
@@ -51,7 +53,7 @@ std::unique_ptr<CInputStream> CResLoader::LoadNewResourcePartSync(const SObjectT
 void CResLoader::LoadMemResourceSync(const SObjectTag& tag, std::unique_ptr<u8[]>& bufOut, int* sizeOut) {
   if (CPakFile* file = FindResourceForLoad(tag)) {
     bufOut = std::unique_ptr<u8[]>(new u8[x50_cachedResInfo->GetSize()]);
-    file->SyncSeekRead(bufOut.get(), x50_cachedResInfo->GetSize(), ESeekOrigin::Begin, x50_cachedResInfo->GetOffset());
+    ReadFromPak(*file, bufOut.get(), x50_cachedResInfo->GetSize(), x50_cachedResInfo->GetOffset());
     *sizeOut = x50_cachedResInfo->GetSize();
   }
 }
@@ -71,16 +73,23 @@ std::unique_ptr<CInputStream> CResLoader::LoadNewResourceSync(const SObjectTag&
   if (CPakFile* const file = FindResourceForLoad(tag)) {
     const size_t resSz = ROUND_UP_32(x50_cachedResInfo->GetSize());
 
-    void* buf = extBuf;
-    if (buf == nullptr) {
-      buf = new u8[resSz];
+    std::unique_ptr<CInputStream> newStrm;
+    if (const SMappedView view = file->GetMappedView(x50_cachedResInfo->GetOffset(), resSz);
+        view && extBuf == nullptr) {
+      // Zero-copy; the stream holds the mapping for as long as it reads from it
+      newStrm = std::make_unique<CMemoryInStream>(view.x8_data, resSz, view.x0_mapping);
+    } else {
+      void* buf = extBuf;
+      if (buf == nullptr) {
+        buf = new u8[resSz];
+      }
+
+      ReadFromPak(*file, buf, resSz, x50_cachedResInfo->GetOffset());
+
+      const bool takeOwnership = extBuf == nullptr;
+      newStrm = std::make_unique<CMemoryInStream>(
+          buf, resSz, takeOwnership ? CMemoryInStream::EOwnerShip::Owned : CMemoryInStream::EOwnerShip::NotOwned);
     }
-
-    file->SyncSeekRead(buf, resSz, ESeekOrigin::Begin, x50_cachedResInfo->GetOffset());
-
-    const bool takeOwnership = extBuf == nullptr;
-    std::unique_ptr<CInputStream> newStrm = std::make_unique<CMemoryInStream>(
-        buf, resSz, takeOwnership ? CMemoryInStream::EOwnerShip::Owned : CMemoryInStream::EOwnerShip::NotOwned);
     if (x50_cachedResInfo->IsCompressed()) {
       newStrm->ReadLong();
       newStrm = std::make_unique<CZipInputStream>(std::move(newStrm));
@@ -103,18 +112,32 @@ std::shared_ptr<IDvdRequest> CResLoader::LoadResourceAsync(const SObjectTag& tag
                              x50_cachedResInfo->GetOffset());
 }
 
+std::shared_ptr<IDvdRequest> CResLoader::LoadResourceAsync(const SObjectTag& tag, void* buf, EDvdPriority priority) {
+  CPakFile* file = FindResourceForLoad(tag.id);
+  return file->AsyncSeekRead(buf, ROUND_UP_32(x50_cachedResInfo->GetSize()), ESeekOrigin::Begin,
+                             x50_cachedResInfo->GetOffset(), {}, priority);
+}
+
 std::unique_ptr<u8[]> CResLoader::LoadResourceSync(const metaforce::SObjectTag& tag) {
   CPakFile* file = FindResourceForLoad(tag.id);
   u32 size = ROUND_UP_32(x50_cachedResInfo->GetSize());
   std::unique_ptr<u8[]> ret(new u8[size]);
-  file->SyncSeekRead(ret.get(), size, ESeekOrigin::Begin, x50_cachedResInfo->GetOffset());
+  ReadFromPak(*file, ret.get(), size, x50_cachedResInfo->GetOffset());
   return ret;
 }
 
+SMappedView CResLoader::GetMappedResource(const SObjectTag& tag) {
+  CPakFile* const file = FindResourceForLoad(tag.id);
+  if (file == nullptr || !file->IsMapped()) {
+    return {};
+  }
+  return file->GetMappedView(x50_cachedResInfo->GetOffset(), x50_cachedResInfo->GetSize());
+}
+
 std::unique_ptr<u8[]> CResLoader::LoadNewResourcePartSync(const metaforce::SObjectTag& tag, u32 off, u32 size) {
   CPakFile* file = FindResourceForLoad(tag.id);
   std::unique_ptr<u8[]> ret(new u8[size]);
-  file->SyncSeekRead(ret.get(), size, ESeekOrigin::Begin, x50_cachedResInfo->GetOffset() + off);
+  ReadFromPak(*file, ret.get(), size, x50_cachedResInfo->GetOffset() + off);
   return ret;
 }
 
@@ -146,6 +169,56 @@ bool CResLoader::_GetTagListForFile(std::vector<SObjectTag>& out, const std::str
   return false;
 }
 
+std::unique_ptr<u8[]> CResLoader::LoadInflatedResourceSync(const SObjectTag& tag, u32& sizeOut) {
+  sizeOut = 0;
+  CPakFile* const file = FindResourceForLoad(tag.id);
+  if (file == nullptr) {
+    return nullptr;
+  }
+  const u32 size = x50_cachedResInfo->GetSize();
+  const u32 offset = x50_cachedResInfo->GetOffset();
+  if (!x50_cachedResInfo->IsCompressed()) {
+    std::unique_ptr<u8[]> ret(new u8[size]);
+    ReadFromPak(*file, ret.get(), size, offset);
+    sizeOut = size;
+    return ret;
+  }
+
+  const SMappedView view = file->GetMappedView(offset, size);
+  std::unique_ptr<u8[]> compBuf;
+  if (!view) {
+    compBuf.reset(new u8[size]);
+    ReadFromPak(*file, compBuf.get(), size, offset);
+  }
+  const u8* const compData = view ? view.x8_data : compBuf.get();
+  CInflateCache::SKey cacheKey;
+  if (m_inflateCache) {
+    cacheKey = CInflateCache::MakeKey(tag.id, compData, size);
+    if (std::unique_ptr<u8[]> ret = m_inflateCache->Load(cacheKey, sizeOut)) {
+      return ret;
+    }
+  }
+  std::unique_ptr<u8[]> ret = CFactoryMgr::InflateResource(compData, size, sizeOut);
+  if (m_inflateCache) {
+    m_inflateCache->Store(cacheKey, ret.get(), sizeOut);
+  }
+  return ret;
+}
+
+void CResLoader::EnableInflateCache(std::string_view directory, u64 maxBytes) {
+  m_inflateCache = std::make_unique<CInflateCache>(directory, maxBytes);
+  Log.report(logvisor::Info, FMT_STRING("Inflate cache at {} ({} of {} MiB used)"), directory,
+             m_inflateCache->GetTotalBytes() >> 20, maxBytes >> 20);
+}
+
+void CResLoader::ReadFromPak(CPakFile& file, void* buf, u32 len, u32 offset) {
+  if (const SMappedView view = file.GetMappedView(offset, len)) {
+    std::memcpy(buf, view.x8_data, len);
+  } else {
+    file.SyncSeekRead(buf, len, ESeekOrigin::Begin, offset);
+  }
+}
+
 bool CResLoader::GetResourceCompression(const SObjectTag& tag) const {
   if (FindResource(tag.id))
     return x50_cachedResInfo->IsCompressed();
@@ -158,6 +231,14 @@ u32 CResLoader::ResourceSize(const SObjectTag& tag) const {
   return 0;
 }
 
+u64 CResLoader::GetResourceDiscOffset(const SObjectTag& tag) const {
+  const CAssetIndex::SEntry* entry = SelectEntry(tag.id);
+  if (entry == nullptr) {
+    return UINT64_MAX;
+  }
+  return entry->x0_pak->GetDiscOffset() + entry->x8_info->GetOffset();
+}
+
 bool CResLoader::ResourceExists(const SObjectTag& tag) const { return FindResource(tag.id); }
 
 FourCC CResLoader::GetResourceTypeById(CAssetId id) const {
@@ -192,25 +273,28 @@ void CResLoader::AsyncIdlePakLoading() {
   }
 }
 
-bool CResLoader::FindResource(CAssetId id) const {
-  if (x4c_cachedResId == id)
-    return true;
-
-  for (auto it = m_overridePakList.begin(); it != m_overridePakList.end(); ++it) {
-    if (CacheFromPak(**it, id)) {
-      return true;
+const CAssetIndex::SEntry* CResLoader::SelectEntry(CAssetId id) const {
+  const CAssetIndex::SEntry* entry = m_assetIndex.Find(id);
+  // Overrides always win; otherwise stay on the current PAK if it has a copy, for locality
+  if (entry == nullptr || entry->x0_pak->IsOverridePak() || x48_curPak == nullptr) {
+    return entry;
+  }
+  for (const CAssetIndex::SEntry* test = entry; test != nullptr; test = m_assetIndex.GetNext(*test)) {
+    if (test->x0_pak == x48_curPak) {
+      return test;
     }
   }
+  return entry;
+}
 
-  if (x48_curPak != x18_pakLoadedList.end())
-    if (CacheFromPak(**x48_curPak, id))
-      return true;
+bool CResLoader::FindResource(CAssetId id) const {
+  if (x4c_cachedResId == id)
+    return true;
 
-  for (auto it = x18_pakLoadedList.begin(); it != x18_pakLoadedList.end(); ++it) {
-    if (it == x48_curPak)
-      continue;
-    if (CacheFromPak(**it, id))
-      return true;
+  if (const CAssetIndex::SEntry* entry = SelectEntry(id)) {
+    x4c_cachedResId = id;
+    x50_cachedResInfo = entry->x8_info;
+    return true;
   }
 
   Log.report(logvisor::Warning, FMT_STRING("Unable to find asset {}"), id);
@@ -218,27 +302,25 @@ bool CResLoader::FindResource(CAssetId id) const {
 }
 
 CPakFile* CResLoader::FindResourceForLoad(CAssetId id) {
-  for (auto it = m_overridePakList.begin(); it != m_overridePakList.end(); ++it) {
-    if (CacheFromPakForLoad(**it, id)) {
-      return &**it;
-    }
+  const CAssetIndex::SEntry* entry = SelectEntry(id);
+  if (entry == nullptr) {
+    Log.report(logvisor::Error, FMT_STRING("Unable to find asset {}"), id);
+    return nullptr;
   }
 
-  if (x48_curPak != x18_pakLoadedList.end())
-    if (CacheFromPakForLoad(**x48_curPak, id))
-      return &**x48_curPak;
-
-  for (auto it = x18_pakLoadedList.begin(); it != x18_pakLoadedList.end(); ++it) {
-    if (it == x48_curPak)
-      continue;
-    if (CacheFromPakForLoad(**it, id)) {
-      x48_curPak = it;
-      return &**it;
-    }
+  CPakFile* file = entry->x0_pak;
+  if (entry->x14_dupInPak) {
+    CacheFromPakForLoad(*file, id);
+  } else {
+    x54_forwardSeek = false;
+    x4c_cachedResId = id;
+    x50_cachedResInfo = entry->x8_info;
+    file->x84_currentSeek = entry->x8_info->GetOffset() + entry->x8_info->GetSize();
   }
-
-  Log.report(logvisor::Error, FMT_STRING("Unable to find asset {}"), id);
-  return nullptr;
+  if (!file->IsOverridePak()) {
+    x48_curPak = file;
+  }
+  return file;
 }
 
 CPakFile* CResLoader::FindResourceForLoad(const SObjectTag& tag) { return FindResourceForLoad(tag.id); }
@@ -270,6 +352,7 @@ bool CResLoader::CacheFromPak(const CPakFile& file, CAssetId id) const {
 }
 
 void CResLoader::MoveToCorrectLoadedList(std::unique_ptr<CPakFile>&& file) {
+  m_assetIndex.AddPak(*file);
   if (file->IsOverridePak())
     m_overridePakList.push_back(std::move(file));
   else
@@ -6,6 +6,9 @@
 #include <string>
 #include <vector>
 
+#include "Runtime/CAssetIndex.hpp"
+#include "Runtime/CInflateCache.hpp"
+#include "Runtime/CMappedFile.hpp"
 #include "Runtime/CPakFile.hpp"
 #include "Runtime/Streams/IOStreams.hpp"
 #include "Runtime/RetroTypes.hpp"
@@ -22,13 +25,17 @@ class CResLoader {
   std::list<std::unique_ptr<CPakFile>>
       m_overridePakList; // URDE Addition, Trilogy has a similar mechanism, need to verify behavior against it
   u32 x44_pakLoadingCount = 0;
-  std::list<std::unique_ptr<CPakFile>>::iterator x48_curPak;
+  CPakFile* x48_curPak = nullptr; /* Regular PAK the last load came from; preferred for locality */
   mutable CAssetId x4c_cachedResId;
   mutable const CPakFile::SResInfo* x50_cachedResInfo = nullptr;
   bool x54_forwardSeek = false;
+  std::unique_ptr<CInflateCache> m_inflateCache;
+  CAssetIndex m_assetIndex; /* Metaforce addition: every loaded PAK's assets in one hash table */
 
   bool _GetTagListForFile(std::vector<SObjectTag>& out, const std::string& path,
                           const std::unique_ptr<CPakFile>& file) const;
+  static void ReadFromPak(CPakFile& file, void* buf, u32 len, u32 offset);
+  const CAssetIndex::SEntry* SelectEntry(CAssetId id) const;
 
 public:
   CResLoader();
@@ -42,11 +49,20 @@ public:
   std::unique_ptr<CInputStream> LoadNewResourceSync(const SObjectTag& tag, void* extBuf = nullptr);
   std::shared_ptr<IDvdRequest> LoadResourcePartAsync(const SObjectTag& tag, u32 off, u32 size, void* buf);
   std::shared_ptr<IDvdRequest> LoadResourceAsync(const SObjectTag& tag, void* buf);
+  std::shared_ptr<IDvdRequest> LoadResourceAsync(const SObjectTag& tag, void* buf, EDvdPriority priority);
   std::unique_ptr<u8[]> LoadResourceSync(const metaforce::SObjectTag& tag);
+  /* Raw (possibly compressed) resource bytes straight from a memory-mapped PAK; empty when not mapped */
+  SMappedView GetMappedResource(const SObjectTag& tag);
   std::unique_ptr<u8[]> LoadNewResourcePartSync(const metaforce::SObjectTag& tag, u32 off, u32 size);
+  /* Uncompressed resource bytes, served from the inflate cache when possible and inserted into it otherwise */
+  std::unique_ptr<u8[]> LoadInflatedResourceSync(const SObjectTag& tag, u32& sizeOut);
+  void EnableInflateCache(std::string_view directory, u64 maxBytes);
+  CInflateCache* GetInflateCache() const { return m_inflateCache.get(); }
   void GetTagListForFile(const char* pakName, std::vector<SObjectTag>& out) const;
   bool GetResourceCompression(const SObjectTag& tag) const;
   u32 ResourceSize(const SObjectTag& tag) const;
+  /* Absolute position of the resource within the data partition; UINT64_MAX if it is not in any loaded PAK */
+  u64 GetResourceDiscOffset(const SObjectTag& tag) const;
   bool ResourceExists(const SObjectTag& tag) const;
   FourCC GetResourceTypeById(CAssetId id) const;
   const SObjectTag* GetResourceIdByName(std::string_view name) const;
@@ -62,6 +78,7 @@ public:
   void EnumerateResources(const std::function<bool(const SObjectTag&)>& lambda) const;
   void EnumerateNamedResources(const std::function<bool(std::string_view, const SObjectTag&)>& lambda) const;
   const std::list<std::unique_ptr<CPakFile>>& GetPaks() const { return x18_pakLoadedList; }
+  const CAssetIndex& GetAssetIndex() const { return m_assetIndex; }
 };
 
 } // namespace metaforce
@@ -0,0 +1,144 @@
+#include "Runtime/CScriptIdIndex.hpp"
+
+#include <algorithm>
+
+#include "Runtime/World/CEntity.hpp"
+
+namespace metaforce {
+
+void CScriptIdIndex::Flush() const {
+  if (m_pending.empty() || m_walkDepth != 0) {
+    return;
+  }
+
+  std::stable_sort(m_pending.begin(), m_pending.end(),
+                   [](const SPending& a, const SPending& b) { return a.x0_entry.first < b.x0_entry.first; });
+
+  /* Stable merge: existing entries stay ahead of new ones with the same editor id */
+  const size_t total = m_ids.size() + m_pending.size();
+  m_mergeIds.clear();
+  m_mergeEntities.clear();
+  m_mergeIds.reserve(total);
+  m_mergeEntities.reserve(total);
+  size_t i = 0;
+  for (const SPending& pending : m_pending) {
+    for (; i < m_ids.size() && !(pending.x0_entry.first < m_ids[i].first); ++i) {
+      m_mergeIds.push_back(m_ids[i]);
+      m_mergeEntities.push_back(m_entities[i]);
+    }
+    m_mergeIds.push_back(pending.x0_entry);
+    m_mergeEntities.push_back(pending.x8_entity);
+  }
+  m_mergeIds.insert(m_mergeIds.end(), m_ids.cbegin() + i, m_ids.cend());
+  m_mergeEntities.insert(m_mergeEntities.end(), m_entities.cbegin() + i, m_entities.cend());
+
+  m_ids.swap(m_mergeIds);
+  m_entities.swap(m_mergeEntities);
+  m_pending.clear();
+}
+
+std::pair<size_t, size_t> CScriptIdIndex::SortedRange(TEditorId id) const {
+  const auto range = std::equal_range(m_ids.cbegin(), m_ids.cend(), Entry{id, kInvalidUniqueId},
+                                      [](const Entry& a, const Entry& b) { return a.first < b.first; });
+  return {size_t(range.first - m_ids.cbegin()), size_t(range.second - m_ids.cbegin())};
+}
+
+void CScriptIdIndex::EndWalk() {
+  if (--m_walkDepth != 0 || m_blanked == 0) {
+    return;
+  }
+
+  std::erase_if(m_pending, [](const SPending& pending) { return pending.x8_entity == nullptr; });
+  size_t out = 0;
+  for (size_t i = 0; i < m_ids.size(); ++i) {
+    if (m_entities[i] == nullptr) {
+      continue;
+    }
+    m_ids[out] = m_ids[i];
+    m_entities[out] = m_entities[i];
+    ++out;
+  }
+  m_ids.resize(out);
+  m_entities.resize(out);
+  m_blanked = 0;
+}
+
+void CScriptIdIndex::Insert(CEntity& ent) {
+  m_pending.push_back({{ent.GetEditorId(), ent.GetUniqueId()}, &ent});
+}
+
+void CScriptIdIndex::Remove(TEditorId id, TUniqueId uid) {
+  const auto pendingIt = std::find_if(m_pending.begin(), m_pending.end(), [&](const SPending& pending) {
+    return pending.x0_entry.first == id && pending.x0_entry.second == uid;
+  });
+  if (pendingIt != m_pending.end()) {
+    if (m_walkDepth != 0) {
+      // A walk may be indexing m_pending; blank the entry and let EndWalk erase it
+      *pendingIt = {{id, kInvalidUniqueId}, nullptr};
+      ++m_blanked;
+    } else {
+      m_pending.erase(pendingIt);
+    }
+    return;
+  }
+
+  const auto [first, last] = SortedRange(id);
+  for (size_t i = first; i < last; ++i) {
+    if (m_ids[i].second == uid) {
+      if (m_walkDepth != 0) {
+        m_ids[i].second = kInvalidUniqueId;
+        m_entities[i] = nullptr;
+        ++m_blanked;
+      } else {
+        m_ids.erase(m_ids.begin() + i);
+        m_entities.erase(m_entities.begin() + i);
+      }
+      return;
+    }
+  }
+}
+
+void CScriptIdIndex::Clear() {
+  if (m_walkDepth != 0) {
+    for (SPending& pending : m_pending) {
+      pending = {{pending.x0_entry.first, kInvalidUniqueId}, nullptr};
+    }
+    for (size_t i = 0; i < m_ids.size(); ++i) {
+      m_ids[i].second = kInvalidUniqueId;
+      m_entities[i] = nullptr;
+    }
+    m_blanked += u32(m_pending.size() + m_ids.size());
+    return;
+  }
+  m_ids.clear();
+  m_entities.clear();
+  m_pending.clear();
+}
+
+std::pair<CScriptIdIndex::const_iterator, CScriptIdIndex::const_iterator>
+CScriptIdIndex::EqualRange(TEditorId id) const {
+  Flush();
+  const auto [first, last] = SortedRange(id);
+  if (first == last) {
+    return {m_ids.cend(), m_ids.cend()};
+  }
+  return {m_ids.cbegin() + first, m_ids.cbegin() + last};
+}
+
+TUniqueId CScriptIdIndex::FindFirst(TEditorId id) const {
+  Flush();
+  const auto [first, last] = SortedRange(id);
+  for (size_t i = first; i < last; ++i) {
+    if (m_entities[i] != nullptr) {
+      return m_ids[i].second;
+    }
+  }
+  for (const SPending& pending : m_pending) {
+    if (pending.x0_entry.first == id && pending.x8_entity != nullptr) {
+      return pending.x0_entry.second;
+    }
+  }
+  return kInvalidUniqueId;
+}
+
+} // namespace metaforce
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "Runtime/RetroTypes.hpp"
+
+namespace metaforce {
+class CEntity;
+
+/* Metaforce addition: the original kept editor id -> unique id in a multimap, so every connection message paid a
+ * tree walk plus an object list lookup per target. This keeps the ids sorted in a flat array with the entity
+ * pointers alongside, so dispatch is a binary search and a linear walk. Insertions land in an unsorted tail that
+ * is merged in one pass before the next lookup, which turns an area load into a single sort.
+ * While ForEachEntity or ForEach is running the sorted arrays are left alone; ranges handed out during that time
+ * do not include entries added since, dispatch itself does. Removals during a walk only blank the entry (uid
+ * kInvalidUniqueId, no entity) so the walk skips it; the blanks are erased once the outermost walk returns. */
+class CScriptIdIndex {
+public:
+  using Entry = std::pair<TEditorId, TUniqueId>;
+  using const_iterator = std::vector<Entry>::const_iterator;
+
+private:
+  struct SPending {
+    Entry x0_entry;
+    CEntity* x8_entity;
+  };
+
+  /* Sorted by editor id, equal ids in insertion order like the multimap; m_entities is parallel to m_ids */
+  mutable std::vector<Entry> m_ids;
+  mutable std::vector<CEntity*> m_entities;
+  mutable std::vector<SPending> m_pending;
+  mutable std::vector<Entry> m_mergeIds;
+  mutable std::vector<CEntity*> m_mergeEntities;
+  u32 m_walkDepth = 0;
+  u32 m_blanked = 0;
+
+  std::pair<size_t, size_t> SortedRange(TEditorId id) const;
+  void EndWalk();
+
+public:
+  /* Merges the unsorted tail; once it is empty, the const lookups do not write and are safe to call concurrently */
+  void Flush() const;
+  void Insert(CEntity& ent);
+  void Remove(TEditorId id, TUniqueId uid);
+  void Clear();
+
+  std::pair<const_iterator, const_iterator> EqualRange(TEditorId id) const;
+  const_iterator end() const { return m_ids.cend(); }
+  TUniqueId FindFirst(TEditorId id) const;
+
+  /* Calls fn(CEntity&) for every object with this editor id, including ones inserted by fn */
+  template <typename Fn>
+  void ForEachEntity(TEditorId id, Fn&& fn) {
+    Flush();
+    ++m_walkDepth;
+    const auto [first, last] = SortedRange(id);
+    for (size_t i = first; i < last; ++i) {
+      if (m_entities[i] != nullptr) {
+        fn(*m_entities[i]);
+      }
+    }
+    for (size_t i = 0; i < m_pending.size(); ++i) {
+      if (m_pending[i].x0_entry.first == id && m_pending[i].x8_entity != nullptr) {
+        fn(*m_pending[i].x8_entity);
+      }
+    }
+    EndWalk();
+  }
+
+  /* Calls fn(const Entry&) for every object, sorted or not */
+  template <typename Fn>
+  void ForEach(Fn&& fn) {
+    ++m_walkDepth;
+    for (size_t i = 0; i < m_ids.size(); ++i) {
+      if (m_entities[i] != nullptr) {
+        fn(m_ids[i]);
+      }
+    }
+    for (size_t i = 0; i < m_pending.size(); ++i) {
+      if (m_pending[i].x8_entity != nullptr) {
+        fn(m_pending[i].x0_entry);
+      }
+    }
+    EndWalk();
+  }
+};
+
+} // namespace metaforce
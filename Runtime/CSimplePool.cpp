@@ -3,6 +3,7 @@
 #include "Runtime/CToken.hpp"
 #include "Runtime/IVParamObj.hpp"
 
+#include <algorithm>
 #include <cassert>
 
 namespace metaforce {
@@ -29,6 +30,41 @@ CToken CSimplePool::GetObj(const SObjectTag& tag, const CVParamTransfer& paramXf
 
 CToken CSimplePool::GetObj(const SObjectTag& tag) { return GetObj(tag, x1c_paramXfer); }
 
+CTokenGroup CSimplePool::GetObjs(std::span<const SObjectTag> tags) {
+  std::vector<CToken> tokens;
+  tokens.reserve(tags.size());
+  std::vector<std::pair<u64, size_t>> toBuild;
+  for (const SObjectTag& tag : tags) {
+    if (!tag) {
+      tokens.emplace_back();
+      continue;
+    }
+
+    const auto iter = x8_resources.find(tag);
+    if (iter != x8_resources.end()) {
+      tokens.push_back(CToken(iter->second));
+      continue;
+    }
+
+    auto* const ref = new CObjectReference(*this, nullptr, tag, x1c_paramXfer);
+    x8_resources.emplace(tag, ref);
+    toBuild.emplace_back(x18_factory.GetLoadOrder(tag), tokens.size());
+    tokens.push_back(CToken(ref));
+  }
+
+  // Locking starts the build; do the new ones front to back and let the scheduler see all of their reads together
+  std::sort(toBuild.begin(), toBuild.end());
+  x18_factory.BeginBuildBatch();
+  for (const auto& [order, idx] : toBuild) {
+    tokens[idx].Lock();
+  }
+  x18_factory.EndBuildBatch();
+  for (CToken& token : tokens) {
+    token.Lock();
+  }
+  return CTokenGroup(std::move(tokens));
+}
+
 CToken CSimplePool::GetObj(std::string_view resourceName) { return GetObj(resourceName, x1c_paramXfer); }
 
 CToken CSimplePool::GetObj(std::string_view resourceName, const CVParamTransfer& paramXfer) {
@@ -68,4 +104,23 @@ std::vector<SObjectTag> CSimplePool::GetReferencedTags() const {
   return ret;
 }
 
+u32 CTokenGroup::GetLoadedCount() const {
+  return u32(std::count_if(x0_tokens.cbegin(), x0_tokens.cend(),
+                           [](const CToken& token) { return !token || token.IsLoaded(); }));
+}
+
+void CTokenGroup::WaitForLoad() {
+  for (CToken& token : x0_tokens) {
+    if (token) {
+      token.GetObj();
+    }
+  }
+}
+
+void CTokenGroup::Unlock() {
+  for (CToken& token : x0_tokens) {
+    token.Unlock();
+  }
+}
+
 } // namespace metaforce
@@ -1,8 +1,10 @@
 #pragma once
 
+#include <span>
 #include <unordered_map>
 #include <vector>
 
+#include "Runtime/CToken.hpp"
 #include "Runtime/IObjectStore.hpp"
 #include "Runtime/IVParamObj.hpp"
 #include "Runtime/RetroTypes.hpp"
@@ -11,6 +13,23 @@ namespace metaforce {
 class CObjectReference;
 class IFactory;
 
+/* Locked tokens requested together through CSimplePool::GetObjs, in request order; poll or wait on them as a unit */
+class CTokenGroup {
+  std::vector<CToken> x0_tokens;
+
+public:
+  CTokenGroup() = default;
+  explicit CTokenGroup(std::vector<CToken>&& tokens) : x0_tokens(std::move(tokens)) {}
+
+  const std::vector<CToken>& GetTokens() const { return x0_tokens; }
+  std::vector<CToken> ReleaseTokens() { return std::move(x0_tokens); }
+  u32 GetLoadedCount() const;
+  bool IsLoaded() const { return GetLoadedCount() == x0_tokens.size(); }
+  /* Blocks until every token has been built */
+  void WaitForLoad();
+  void Unlock();
+};
+
 class CSimplePool : public IObjectStore {
 protected:
   u8 x4_;
@@ -26,6 +45,9 @@ public:
   CToken GetObj(const SObjectTag&) override;
   CToken GetObj(std::string_view) override;
   CToken GetObj(std::string_view, const CVParamTransfer&) override;
+  /* Locks a whole dependency set at once. Tags that are not resident yet are built in disc order and their reads are
+   * handed to the scheduler as one batch. Duplicate and invalid tags are fine. */
+  CTokenGroup GetObjs(std::span<const SObjectTag> tags);
   bool HasObject(const SObjectTag&) const override;
   bool ObjectIsLive(const SObjectTag&) const override;
   IFactory& GetFactory() const override { return x18_factory; }
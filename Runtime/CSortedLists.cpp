@@ -3,238 +3,239 @@
 #include "Runtime/World/CActor.hpp"
 
 #include <algorithm>
-#include <cassert>
+#include <bit>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define METAFORCE_SORTED_LISTS_SSE2 1
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define METAFORCE_SORTED_LISTS_NEON 1
+#endif
 
 namespace metaforce {
 namespace {
-template <typename T, typename S>
-auto AccessElement(T& arr, S idx) -> typename T::reference {
-  assert(std::size(arr) > static_cast<size_t>(idx) && idx >= 0);
-  return arr[idx];
+constexpr u32 PairKey(s16 a, s16 b) {
+  return a < b ? (u32(u16(a)) << 16) | u16(b) : (u32(u16(b)) << 16) | u16(a);
+}
+
+/* Mins sort ahead of maxes at equal values, so touching x extents count as overlapping like the box tests do */
+bool EndpointLess(float aValue, bool aMax, float bValue, bool bMax) {
+  return aValue < bValue || (aValue == bValue && !aMax && bMax);
 }
 
-template <typename T, typename S>
-auto AccessElement(const T& arr, S idx) -> typename T::const_reference {
-  assert(std::size(arr) > static_cast<size_t>(idx) && idx >= 0);
-  return arr[idx];
+/* The original built its result chain from whichever axis list was shortest, so callers never saw a positional order;
+ * id order keeps the result independent of where the actors sit */
+void SortById(EntityList& out, size_t first) {
+  std::sort(out.begin() + first, out.end(),
+            [](const TUniqueId& a, const TUniqueId& b) { return a.Value() < b.Value(); });
 }
 } // Anonymous namespace
 
 CSortedListManager::CSortedListManager() { Reset(); }
 
 void CSortedListManager::Reset() {
-  x0_nodes.fill(SNode{});
-
-  for (auto& list : xb000_sortedLists) {
-    list.Reset();
-  }
+  m_count = 0;
+  m_endpointCount = 0;
+  m_deadSlots = 0;
+  m_narrowExtentX = 0.f;
+  m_wideNodes.clear();
+  m_actors.clear();
+  m_nodeSlot.clear();
+  m_nodeEndpoints.clear();
+  m_xPairs.clear();
+  GrowSlots();
 }
 
-void CSortedListManager::AddToLinkedList(s16 nodeId, s16& headId, s16& tailId) {
-  if (headId == -1) {
-    AccessElement(x0_nodes, nodeId).x28_next = headId;
-    headId = nodeId;
-    tailId = nodeId;
-  } else {
-    if (AccessElement(x0_nodes, nodeId).x28_next != -1) {
-      return;
-    }
-    if (tailId == nodeId) {
-      return;
-    }
-    AccessElement(x0_nodes, nodeId).x28_next = headId;
-    headId = nodeId;
-  }
+void CSortedListManager::GrowSlots() {
+  // Room for one more slot plus the padding a lane block may read
+  const size_t size = std::max<size_t>(m_minX.size() * 2, m_count + 1 + kLanes);
+  m_minX.resize(size);
+  m_minY.resize(size);
+  m_minZ.resize(size);
+  m_maxX.resize(size);
+  m_maxY.resize(size);
+  m_maxZ.resize(size);
+  m_slotNode.resize(size);
+  m_endpoints.resize(size * 2);
 }
 
-void CSortedListManager::RemoveFromList(ESortedList list, s16 idx) {
-  const auto listIndex = static_cast<size_t>(list);
-  SSortedList& sl = xb000_sortedLists[listIndex];
+void CSortedListManager::SetSlotBounds(u32 slot, const zeus::CAABox& aabb) {
+  m_minX[slot] = aabb.min.x();
+  m_minY[slot] = aabb.min.y();
+  m_minZ[slot] = aabb.min.z();
+  m_maxX[slot] = aabb.max.x();
+  m_maxY[slot] = aabb.max.y();
+  m_maxZ[slot] = aabb.max.z();
+}
 
-  while (idx < sl.x800_size - 1) {
-    AccessElement(x0_nodes, AccessElement(sl.x0_ids, idx + 1)).x1c_selfIdxs[listIndex] = idx;
-    AccessElement(sl.x0_ids, idx) = AccessElement(sl.x0_ids, idx + 1);
-    ++idx;
+void CSortedListManager::SwapSlots(u32 a, u32 b) {
+  std::swap(m_minX[a], m_minX[b]);
+  std::swap(m_minY[a], m_minY[b]);
+  std::swap(m_minZ[a], m_minZ[b]);
+  std::swap(m_maxX[a], m_maxX[b]);
+  std::swap(m_maxY[a], m_maxY[b]);
+  std::swap(m_maxZ[a], m_maxZ[b]);
+  std::swap(m_slotNode[a], m_slotNode[b]);
+  if (m_slotNode[a] >= 0) {
+    m_nodeSlot[m_slotNode[a]] = s16(a);
+  }
+  if (m_slotNode[b] >= 0) {
+    m_nodeSlot[m_slotNode[b]] = s16(b);
   }
-
-  --sl.x800_size;
 }
 
-void CSortedListManager::MoveInList(ESortedList list, s16 idx) {
-  const auto listIndex = static_cast<size_t>(list);
-  SSortedList& sl = xb000_sortedLists[listIndex];
-
-  while (true) {
-    if (idx > 0 && AccessElement(x0_nodes, AccessElement(sl.x0_ids, idx - 1)).x4_box[listIndex] >
-                       AccessElement(x0_nodes, AccessElement(sl.x0_ids, idx)).x4_box[listIndex]) {
-      AccessElement(x0_nodes, AccessElement(sl.x0_ids, idx - 1)).x1c_selfIdxs[listIndex] = idx;
-      AccessElement(x0_nodes, AccessElement(sl.x0_ids, idx)).x1c_selfIdxs[listIndex] = idx - 1;
-      std::swap(AccessElement(sl.x0_ids, idx), AccessElement(sl.x0_ids, idx - 1));
-      --idx;
-    } else {
-      if (idx >= sl.x800_size - 1) {
-        return;
-      }
-      if (AccessElement(x0_nodes, AccessElement(sl.x0_ids, idx + 1)).x4_box[listIndex] >=
-          AccessElement(x0_nodes, AccessElement(sl.x0_ids, idx)).x4_box[listIndex]) {
-        return;
-      }
-      AccessElement(x0_nodes, AccessElement(sl.x0_ids, idx + 1)).x1c_selfIdxs[listIndex] = idx;
-      AccessElement(x0_nodes, AccessElement(sl.x0_ids, idx)).x1c_selfIdxs[listIndex] = idx + 1;
-      std::swap(AccessElement(sl.x0_ids, idx), AccessElement(sl.x0_ids, idx + 1));
-      ++idx;
-    }
+void CSortedListManager::SortSlot(u32 slot) {
+  /* Actors move a little per frame, so this rarely passes more than a neighbour or two */
+  while (slot > 0 && m_minX[slot - 1] > m_minX[slot]) {
+    SwapSlots(slot - 1, slot);
+    --slot;
+  }
+  while (slot + 1 < m_count && m_minX[slot + 1] < m_minX[slot]) {
+    SwapSlots(slot, slot + 1);
+    ++slot;
   }
 }
 
-void CSortedListManager::InsertInList(ESortedList list, SNode& node) {
-  const auto listIndex = static_cast<size_t>(list);
-  SSortedList& sl = xb000_sortedLists[listIndex];
-  int insIdx = 0;
-
-  for (int i = sl.x800_size; i > 0;) {
-    /* Binary search cycle to find insert index */
-    if (AccessElement(x0_nodes, AccessElement(sl.x0_ids, insIdx + i / 2)).x4_box[listIndex] < node.x4_box[listIndex]) {
-      /* Upper */
-      insIdx = insIdx + i / 2 + 1;
-      i = i - i / 2 - 1;
+void CSortedListManager::TrackExtent(s16 node, bool wasWide, float extent) {
+  const bool wide = extent >= kWideExtentX;
+  if (wide != wasWide) {
+    if (wide) {
+      m_wideNodes.push_back(node);
     } else {
-      /* Lower */
-      i /= 2;
+      std::erase(m_wideNodes, node);
     }
   }
-
-  /* Shift ids for insert */
-  for (int i = sl.x800_size; i > insIdx; --i) {
-    AccessElement(x0_nodes, AccessElement(sl.x0_ids, i - 1)).x1c_selfIdxs[listIndex] = i;
-    AccessElement(sl.x0_ids, i) = AccessElement(sl.x0_ids, i - 1);
+  if (!wide) {
+    m_narrowExtentX = std::max(m_narrowExtentX, extent);
   }
-
-  /* Do insert */
-  AccessElement(sl.x0_ids, insIdx) = node.x0_actor->GetUniqueId().Value();
-  node.x1c_selfIdxs[listIndex] = s16(insIdx);
-  ++sl.x800_size;
 }
 
-s16 CSortedListManager::FindInListUpper(ESortedList list, float value) const {
-  const auto listIndex = static_cast<size_t>(list);
-  const SSortedList& sl = xb000_sortedLists[listIndex];
-  int idx = 0;
-
-  for (int i = sl.x800_size; i > 0;) {
-    // Binary search cycle to find index
-    if (!(value < AccessElement(x0_nodes, AccessElement(sl.x0_ids, idx + i / 2)).x4_box[listIndex])) {
-      // Upper
-      idx = idx + i / 2 + 1;
-      i = i - i / 2 - 1;
+void CSortedListManager::SwapEndpoints(u32 left, u32 right) {
+  SEndpoint& l = m_endpoints[left];
+  SEndpoint& r = m_endpoints[right];
+  if (l.x4_node >= 0 && r.x4_node >= 0 && l.x4_node != r.x4_node && l.x6_max != r.x6_max) {
+    if (l.x6_max) {
+      /* A max passing a min to its right: the two x extents start overlapping */
+      m_xPairs.insert(PairKey(l.x4_node, r.x4_node));
     } else {
-      // Lower
-      i /= 2;
+      /* A min passing a max to its right: they stop */
+      m_xPairs.erase(PairKey(l.x4_node, r.x4_node));
     }
   }
-
-  return idx;
+  std::swap(l, r);
+  if (l.x4_node >= 0) {
+    m_nodeEndpoints[l.x4_node][l.x6_max] = u16(left);
+  }
+  if (r.x4_node >= 0) {
+    m_nodeEndpoints[r.x4_node][r.x6_max] = u16(right);
+  }
 }
 
-s16 CSortedListManager::FindInListLower(ESortedList list, float value) const {
-  const auto listIndex = static_cast<size_t>(list);
-  const SSortedList& sl = xb000_sortedLists[listIndex];
-  int idx = 0;
-
-  for (int i = sl.x800_size; i > 0;) {
-    // Binary search cycle to find index
-    if (AccessElement(x0_nodes, AccessElement(sl.x0_ids, idx + i / 2)).x4_box[listIndex] < value) {
-      // Upper
-      idx = idx + i / 2 + 1;
-      i = i - i / 2 - 1;
-    } else {
-      // Lower
-      i /= 2;
-    }
+void CSortedListManager::SortEndpoint(u32 idx) {
+  while (idx > 0 && EndpointLess(m_endpoints[idx].x0_value, m_endpoints[idx].x6_max, m_endpoints[idx - 1].x0_value,
+                                 m_endpoints[idx - 1].x6_max)) {
+    SwapEndpoints(idx - 1, idx);
+    --idx;
+  }
+  while (idx + 1 < m_endpointCount && EndpointLess(m_endpoints[idx + 1].x0_value, m_endpoints[idx + 1].x6_max,
+                                                   m_endpoints[idx].x0_value, m_endpoints[idx].x6_max)) {
+    SwapEndpoints(idx, idx + 1);
+    ++idx;
   }
-
-  return idx;
 }
 
-s16 CSortedListManager::ConstructIntersectionArray(const zeus::CAABox& aabb) {
-  const int minXa = FindInListLower(ESortedList::MinX, aabb.min.x());
-  const int maxXa = FindInListUpper(ESortedList::MinX, aabb.max.x());
-  const int minXb = FindInListLower(ESortedList::MaxX, aabb.min.x());
-  const int maxXb = FindInListUpper(ESortedList::MaxX, aabb.max.x());
-  const int xEnd = std::min(int(xb000_sortedLists[3].x800_size) - maxXb, minXa) + (maxXb + (maxXa - minXa) - minXb) / 2;
-
-  const int minYa = FindInListLower(ESortedList::MinY, aabb.min.y());
-  const int maxYa = FindInListUpper(ESortedList::MinY, aabb.max.y());
-  const int minYb = FindInListLower(ESortedList::MaxY, aabb.min.y());
-  const int maxYb = FindInListUpper(ESortedList::MaxY, aabb.max.y());
-  const int yEnd = std::min(int(xb000_sortedLists[4].x800_size) - maxYb, minYa) + (maxYb + (maxYa - minYa) - minYb) / 2;
-
-  const int minZa = FindInListLower(ESortedList::MinZ, aabb.min.z());
-  const int maxZa = FindInListUpper(ESortedList::MinZ, aabb.max.z());
-  const int minZb = FindInListLower(ESortedList::MaxZ, aabb.min.z());
-  const int maxZb = FindInListUpper(ESortedList::MaxZ, aabb.max.z());
-  const int zEnd = std::min(int(xb000_sortedLists[5].x800_size) - maxZb, minZa) + (maxZb + (maxZa - minZa) - minZb) / 2;
-
-  if (xEnd < yEnd && xEnd < zEnd) {
-    return CalculateIntersections(ESortedList::MinX, ESortedList::MaxX, minXa, maxXa, minXb, maxXb, ESortedList::MinY,
-                                  ESortedList::MaxY, ESortedList::MinZ, ESortedList::MaxZ, aabb);
-  } else if (yEnd < zEnd) {
-    return CalculateIntersections(ESortedList::MinY, ESortedList::MaxY, minYa, maxYa, minYb, maxYb, ESortedList::MinX,
-                                  ESortedList::MaxX, ESortedList::MinZ, ESortedList::MaxZ, aabb);
-  } else {
-    return CalculateIntersections(ESortedList::MinZ, ESortedList::MaxZ, minZa, maxZa, minZb, maxZb, ESortedList::MinX,
-                                  ESortedList::MaxX, ESortedList::MinY, ESortedList::MaxY, aabb);
-  }
+bool CSortedListManager::NodesOverlap(s16 a, s16 b) const {
+  const s16 sa = m_nodeSlot[a];
+  const s16 sb = m_nodeSlot[b];
+  return m_minX[sa] <= m_maxX[sb] && m_maxX[sa] >= m_minX[sb] && m_minY[sa] <= m_maxY[sb] &&
+         m_maxY[sa] >= m_minY[sb] && m_minZ[sa] <= m_maxZ[sb] && m_maxZ[sa] >= m_minZ[sb];
 }
 
-s16 CSortedListManager::CalculateIntersections(ESortedList la, ESortedList lb, s16 a, s16 b, s16 c, s16 d,
-                                               ESortedList slA, ESortedList slB, ESortedList slC, ESortedList slD,
-                                               const zeus::CAABox& aabb) {
-  const auto listAIndex = static_cast<size_t>(la);
-  const auto listBIndex = static_cast<size_t>(lb);
+bool CSortedListManager::SlotOverlaps(u32 slot, const zeus::CAABox& aabb) const {
+  return m_minX[slot] <= aabb.max.x() && m_maxX[slot] >= aabb.min.x() && m_minY[slot] <= aabb.max.y() &&
+         m_maxY[slot] >= aabb.min.y() && m_minZ[slot] <= aabb.max.z() && m_maxZ[slot] >= aabb.min.z();
+}
 
-  s16 headId = -1;
-  s16 tailId = -1;
-  for (int i = a; i < b; ++i) {
-    AddToLinkedList(AccessElement(xb000_sortedLists[listAIndex].x0_ids, i), headId, tailId);
+u32 CSortedListManager::BlockHits(u32 base, const zeus::CAABox& aabb) const {
+  /* Bit i is set when slot base + i overlaps the query on max x, y and z; the caller's search already bounds min x.
+   * The SoA arrays are padded by kLanes, so the last block reads (and the caller masks off) slots past the end. */
+  u32 hits = 0;
+#if METAFORCE_SORTED_LISTS_SSE2
+  const __m128 minX = _mm_set1_ps(aabb.min.x());
+  const __m128 minY = _mm_set1_ps(aabb.min.y());
+  const __m128 minZ = _mm_set1_ps(aabb.min.z());
+  const __m128 maxY = _mm_set1_ps(aabb.max.y());
+  const __m128 maxZ = _mm_set1_ps(aabb.max.z());
+  for (u32 lane = 0; lane < kLanes; lane += 4) {
+    const u32 i = base + lane;
+    __m128 hit = _mm_cmpge_ps(_mm_loadu_ps(&m_maxX[i]), minX);
+    hit = _mm_and_ps(hit, _mm_cmple_ps(_mm_loadu_ps(&m_minY[i]), maxY));
+    hit = _mm_and_ps(hit, _mm_cmpge_ps(_mm_loadu_ps(&m_maxY[i]), minY));
+    hit = _mm_and_ps(hit, _mm_cmple_ps(_mm_loadu_ps(&m_minZ[i]), maxZ));
+    hit = _mm_and_ps(hit, _mm_cmpge_ps(_mm_loadu_ps(&m_maxZ[i]), minZ));
+    hits |= u32(_mm_movemask_ps(hit)) << lane;
   }
-  for (int i = c; i < d; ++i) {
-    AddToLinkedList(AccessElement(xb000_sortedLists[listBIndex].x0_ids, i), headId, tailId);
+#elif METAFORCE_SORTED_LISTS_NEON
+  static constexpr u32 LaneBits[4] = {1, 2, 4, 8};
+  const uint32x4_t laneBits = vld1q_u32(LaneBits);
+  const float32x4_t minX = vdupq_n_f32(aabb.min.x());
+  const float32x4_t minY = vdupq_n_f32(aabb.min.y());
+  const float32x4_t minZ = vdupq_n_f32(aabb.min.z());
+  const float32x4_t maxY = vdupq_n_f32(aabb.max.y());
+  const float32x4_t maxZ = vdupq_n_f32(aabb.max.z());
+  for (u32 lane = 0; lane < kLanes; lane += 4) {
+    const u32 i = base + lane;
+    uint32x4_t hit = vcgeq_f32(vld1q_f32(&m_maxX[i]), minX);
+    hit = vandq_u32(hit, vcleq_f32(vld1q_f32(&m_minY[i]), maxY));
+    hit = vandq_u32(hit, vcgeq_f32(vld1q_f32(&m_maxY[i]), minY));
+    hit = vandq_u32(hit, vcleq_f32(vld1q_f32(&m_minZ[i]), maxZ));
+    hit = vandq_u32(hit, vcgeq_f32(vld1q_f32(&m_maxZ[i]), minZ));
+    hits |= vaddvq_u32(vandq_u32(hit, laneBits)) << lane;
   }
+#else
+  for (u32 lane = 0; lane < kLanes; ++lane) {
+    const u32 i = base + lane;
+    const bool hit = (m_maxX[i] >= aabb.min.x()) & (m_minY[i] <= aabb.max.y()) & (m_maxY[i] >= aabb.min.y()) &
+                     (m_minZ[i] <= aabb.max.z()) & (m_maxZ[i] >= aabb.min.z());
+    hits |= u32(hit) << lane;
+  }
+#endif
+  return hits;
+}
 
-  if (a < xb000_sortedLists[listBIndex].x800_size - d) {
-    for (int i = 0; i < a; ++i) {
-      const s16 id = AccessElement(xb000_sortedLists[listAIndex].x0_ids, i);
-      if (AccessElement(x0_nodes, id).x4_box[listBIndex] > aabb[listBIndex]) {
-        AddToLinkedList(id, headId, tailId);
-      }
-    }
-  } else {
-    for (int i = d; i < xb000_sortedLists[listBIndex].x800_size; ++i) {
-      const s16 id = AccessElement(xb000_sortedLists[listBIndex].x0_ids, i);
-      if (AccessElement(x0_nodes, id).x4_box[listAIndex] < aabb[listAIndex]) {
-        AddToLinkedList(id, headId, tailId);
-      }
+template <typename Fn>
+void CSortedListManager::ForEachOverlap(const zeus::CAABox& aabb, Fn&& fn) const {
+  /* Slots are sorted by min x, so none past the last min x at or below the query's max x can overlap it, and no
+   * narrow slot whose min x lies more than m_narrowExtentX before the query's min x can reach it. The extra unit
+   * absorbs rounding in the subtraction, so slots that only touch the query are still found. */
+  const auto minXEnd = m_minX.cbegin() + m_count;
+  const u32 end = u32(std::upper_bound(m_minX.cbegin(), minXEnd, aabb.max.x()) - m_minX.cbegin());
+  const float reach = aabb.min.x() - m_narrowExtentX - 1.f;
+  const u32 start = u32(std::lower_bound(m_minX.cbegin(), minXEnd, reach) - m_minX.cbegin());
+
+  /* Wide slots ahead of the run are the only overlaps it leaves out */
+  for (const s16 node : m_wideNodes) {
+    const u32 slot = m_nodeSlot[node];
+    if (slot < start && SlotOverlaps(slot, aabb)) {
+      fn(*m_actors[node]);
     }
   }
 
-  for (s16* id = &headId; *id != -1;) {
-    SNode& node = AccessElement(x0_nodes, *id);
-    if (node.x4_box[size_t(slA)] > aabb[size_t(slB)] || node.x4_box[size_t(slB)] < aabb[size_t(slA)] ||
-        node.x4_box[size_t(slC)] > aabb[size_t(slD)] || node.x4_box[size_t(slD)] < aabb[size_t(slC)]) {
-      /* Not intersecting; remove from chain */
-      *id = node.x28_next;
-      node.x28_next = -1;
-      continue;
+  for (u32 base = start; base < end; base += kLanes) {
+    u32 hits = BlockHits(base, aabb);
+    if (end - base < kLanes) {
+      hits &= (1u << (end - base)) - 1;
+    }
+    for (; hits != 0; hits &= hits - 1) {
+      fn(*m_actors[m_slotNode[base + std::countr_zero(hits)]]);
     }
-    id = &node.x28_next;
   }
-
-  return headId;
 }
 
 void CSortedListManager::BuildNearList(EntityList& out, const zeus::CVector3f& pos, const zeus::CVector3f& dir,
-                                       float mag, const CMaterialFilter& filter, const CActor* actor) {
+                                       float mag, const CMaterialFilter& filter, const CActor* actor) const {
   if (mag == 0.f) {
     mag = 8000.f;
   }
@@ -245,85 +246,187 @@ void CSortedListManager::BuildNearList(EntityList& out, const zeus::CVector3f& p
   BuildNearList(out, zeus::CAABox(mins, maxs), filter, actor);
 }
 
-void CSortedListManager::BuildNearList(EntityList& out, const CActor& actor, const zeus::CAABox& aabb) {
+void CSortedListManager::BuildNearList(EntityList& out, const CActor& actor, const zeus::CAABox& aabb) const {
+  const size_t first = out.size();
   const CMaterialFilter& filter = actor.GetMaterialFilter();
-  s16 id = ConstructIntersectionArray(aabb);
-  while (id != -1) {
-    SNode& node = AccessElement(x0_nodes, id);
-    if (&actor != node.x0_actor && filter.Passes(node.x0_actor->GetMaterialList()) &&
-        node.x0_actor->GetMaterialFilter().Passes(actor.GetMaterialList())) {
-      out.push_back(node.x0_actor->GetUniqueId());
+  ForEachOverlap(aabb, [&](const CActor& other) {
+    if (&actor != &other && filter.Passes(other.GetMaterialList()) &&
+        other.GetMaterialFilter().Passes(actor.GetMaterialList())) {
+      out.push_back(other.GetUniqueId());
     }
-
-    id = node.x28_next;
-    node.x28_next = -1;
-  }
+  });
+  SortById(out, first);
 }
 
 void CSortedListManager::BuildNearList(EntityList& out, const zeus::CAABox& aabb, const CMaterialFilter& filter,
-                                       const CActor* actor) {
-  s16 id = ConstructIntersectionArray(aabb);
-  while (id != -1) {
-    SNode& node = AccessElement(x0_nodes, id);
-    if (actor != node.x0_actor && filter.Passes(node.x0_actor->GetMaterialList())) {
-      out.push_back(node.x0_actor->GetUniqueId());
+                                       const CActor* actor) const {
+  const size_t first = out.size();
+  ForEachOverlap(aabb, [&](const CActor& other) {
+    if (actor != &other && filter.Passes(other.GetMaterialList())) {
+      out.push_back(other.GetUniqueId());
     }
-
-    id = node.x28_next;
-    node.x28_next = -1;
-  }
+  });
+  SortById(out, first);
 }
 
 void CSortedListManager::Remove(const CActor* actor) {
-  SNode& node = AccessElement(x0_nodes, actor->GetUniqueId().Value());
-  if (!node.x2a_populated) {
+  const auto node = s16(actor->GetUniqueId().Value());
+  if (!HasNode(node)) {
     return;
   }
 
-  RemoveFromList(ESortedList::MinX, node.x1c_selfIdxs[0]);
-  RemoveFromList(ESortedList::MaxX, node.x1c_selfIdxs[3]);
-  RemoveFromList(ESortedList::MinY, node.x1c_selfIdxs[1]);
-  RemoveFromList(ESortedList::MaxY, node.x1c_selfIdxs[4]);
-  RemoveFromList(ESortedList::MinZ, node.x1c_selfIdxs[2]);
-  RemoveFromList(ESortedList::MaxZ, node.x1c_selfIdxs[5]);
-  node.x2a_populated = false;
+  /* Leave a tombstone: min x stays put so the slot order holds, and maxes of -inf fail every overlap test */
+  const u32 slot = m_nodeSlot[node];
+  if (m_maxX[slot] - m_minX[slot] >= kWideExtentX) {
+    std::erase(m_wideNodes, node);
+  }
+  m_maxX[slot] = -std::numeric_limits<float>::infinity();
+  m_maxY[slot] = -std::numeric_limits<float>::infinity();
+  m_maxZ[slot] = -std::numeric_limits<float>::infinity();
+  m_slotNode[slot] = -1;
+  m_endpoints[m_nodeEndpoints[node][0]].x4_node = -1;
+  m_endpoints[m_nodeEndpoints[node][1]].x4_node = -1;
+  m_actors[node] = nullptr;
+  m_nodeSlot[node] = -1;
+
+  /* Compacting once half the slots are dead keeps freeing a whole area linear overall */
+  ++m_deadSlots;
+  if (m_deadSlots * 2 > m_count) {
+    Compact();
+  }
+}
+
+void CSortedListManager::Compact() {
+  u32 out = 0;
+  m_narrowExtentX = 0.f;
+  for (u32 i = 0; i < m_count; ++i) {
+    if (m_slotNode[i] < 0) {
+      continue;
+    }
+    if (const float extent = m_maxX[i] - m_minX[i]; extent < kWideExtentX) {
+      m_narrowExtentX = std::max(m_narrowExtentX, extent);
+    }
+    m_minX[out] = m_minX[i];
+    m_minY[out] = m_minY[i];
+    m_minZ[out] = m_minZ[i];
+    m_maxX[out] = m_maxX[i];
+    m_maxY[out] = m_maxY[i];
+    m_maxZ[out] = m_maxZ[i];
+    m_slotNode[out] = m_slotNode[i];
+    m_nodeSlot[m_slotNode[out]] = s16(out);
+    ++out;
+  }
+  m_count = out;
+
+  out = 0;
+  for (u32 i = 0; i < m_endpointCount; ++i) {
+    if (m_endpoints[i].x4_node < 0) {
+      continue;
+    }
+    m_endpoints[out] = m_endpoints[i];
+    m_nodeEndpoints[m_endpoints[out].x4_node][m_endpoints[out].x6_max] = u16(out);
+    ++out;
+  }
+  m_endpointCount = out;
+  m_deadSlots = 0;
+
+  /* Remove leaves its pairs behind; drop those whose nodes died or no longer share any x extent */
+  std::erase_if(m_xPairs, [this](u32 key) {
+    const auto a = s16(key >> 16);
+    const auto b = s16(key & 0xffff);
+    if (m_actors[a] == nullptr || m_actors[b] == nullptr) {
+      return true;
+    }
+    const s16 sa = m_nodeSlot[a];
+    const s16 sb = m_nodeSlot[b];
+    return m_minX[sa] > m_maxX[sb] || m_maxX[sa] < m_minX[sb];
+  });
 }
 
 void CSortedListManager::Move(const CActor* actor, const zeus::CAABox& aabb) {
-  SNode& node = AccessElement(x0_nodes, actor->GetUniqueId().Value());
-  node.x4_box = aabb;
-
-  MoveInList(ESortedList::MinX, node.x1c_selfIdxs[0]);
-  MoveInList(ESortedList::MaxX, node.x1c_selfIdxs[3]);
-  MoveInList(ESortedList::MinY, node.x1c_selfIdxs[1]);
-  MoveInList(ESortedList::MaxY, node.x1c_selfIdxs[4]);
-  MoveInList(ESortedList::MinZ, node.x1c_selfIdxs[2]);
-  MoveInList(ESortedList::MaxZ, node.x1c_selfIdxs[5]);
+  const auto node = s16(actor->GetUniqueId().Value());
+  if (!HasNode(node)) {
+    Insert(actor, aabb);
+    return;
+  }
+
+  const u32 slot = m_nodeSlot[node];
+  const bool wasWide = m_maxX[slot] - m_minX[slot] >= kWideExtentX;
+  SetSlotBounds(slot, aabb);
+  TrackExtent(node, wasWide, aabb.max.x() - aabb.min.x());
+  SortSlot(slot);
+
+  /* Sort the endpoint on the leading side first so the two never pass each other */
+  SEndpoint& maxEnd = m_endpoints[m_nodeEndpoints[node][1]];
+  if (aabb.max.x() > maxEnd.x0_value) {
+    maxEnd.x0_value = aabb.max.x();
+    SortEndpoint(m_nodeEndpoints[node][1]);
+    m_endpoints[m_nodeEndpoints[node][0]].x0_value = aabb.min.x();
+    SortEndpoint(m_nodeEndpoints[node][0]);
+  } else {
+    m_endpoints[m_nodeEndpoints[node][0]].x0_value = aabb.min.x();
+    SortEndpoint(m_nodeEndpoints[node][0]);
+    m_endpoints[m_nodeEndpoints[node][1]].x0_value = aabb.max.x();
+    SortEndpoint(m_nodeEndpoints[node][1]);
+  }
 }
 
 void CSortedListManager::Insert(const CActor* actor, const zeus::CAABox& aabb) {
-  SNode& node = AccessElement(x0_nodes, actor->GetUniqueId().Value());
-  if (node.x2a_populated) {
+  const auto node = s16(actor->GetUniqueId().Value());
+  if (HasNode(node)) {
     Move(actor, aabb);
     return;
   }
 
-  SNode newNode(actor, aabb);
-  InsertInList(ESortedList::MinX, newNode);
-  InsertInList(ESortedList::MaxX, newNode);
-  InsertInList(ESortedList::MinY, newNode);
-  InsertInList(ESortedList::MaxY, newNode);
-  InsertInList(ESortedList::MinZ, newNode);
-  InsertInList(ESortedList::MaxZ, newNode);
-  node = newNode;
+  if (size_t(node) >= m_actors.size()) {
+    m_actors.resize(node + 1, nullptr);
+    m_nodeSlot.resize(node + 1, -1);
+    m_nodeEndpoints.resize(node + 1);
+  }
+  if (m_count + kLanes == m_minX.size()) {
+    GrowSlots();
+  }
+  m_actors[node] = actor;
+  const u32 slot = m_count++;
+  m_slotNode[slot] = node;
+  m_nodeSlot[node] = s16(slot);
+  SetSlotBounds(slot, aabb);
+  TrackExtent(node, false, aabb.max.x() - aabb.min.x());
+  SortSlot(slot);
+
+  /* Enter past every other endpoint; sorting in from there records each overlap the new extent starts */
+  const u32 minIdx = m_endpointCount;
+  const u32 maxIdx = m_endpointCount + 1;
+  m_endpoints[minIdx] = {aabb.min.x(), node, false};
+  m_endpoints[maxIdx] = {aabb.max.x(), node, true};
+  m_nodeEndpoints[node] = {u16(minIdx), u16(maxIdx)};
+  m_endpointCount += 2;
+  SortEndpoint(minIdx);
+  SortEndpoint(m_nodeEndpoints[node][1]);
 }
 
 bool CSortedListManager::ActorInLists(const CActor* actor) const {
   if (!actor) {
     return false;
   }
-  const SNode& node = AccessElement(x0_nodes, actor->GetUniqueId().Value());
-  return node.x2a_populated;
+  return HasNode(s16(actor->GetUniqueId().Value()));
+}
+
+void CSortedListManager::BuildOverlappingPairs(std::vector<OverlapPair>& out) const {
+  const size_t first = out.size();
+  for (const u32 key : m_xPairs) {
+    const auto a = s16(key >> 16);
+    const auto b = s16(key & 0xffff);
+    if (m_actors[a] != nullptr && m_actors[b] != nullptr && NodesOverlap(a, b)) {
+      out.emplace_back(m_actors[a]->GetUniqueId(), m_actors[b]->GetUniqueId());
+    }
+  }
+  std::sort(out.begin() + first, out.end(), [](const OverlapPair& a, const OverlapPair& b) {
+    if (a.first.Value() != b.first.Value()) {
+      return a.first.Value() < b.first.Value();
+    }
+    return a.second.Value() < b.second.Value();
+  });
 }
 
 } // namespace metaforce
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <array>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include "Runtime/RetroTypes.hpp"
 #include "Runtime/Collision/CMaterialFilter.hpp"
@@ -8,49 +11,90 @@
 #include <zeus/CAABox.hpp>
 
 namespace metaforce {
-enum class ESortedList { MinX, MinY, MinZ, MaxX, MaxY, MaxZ };
-
-struct SSortedList {
-  std::array<s16, kMaxEntities> x0_ids;
-  u32 x800_size = 0;
-  void Reset() { x0_ids.fill(-1); }
-  SSortedList() { Reset(); }
-};
-
 class CActor;
+
+/* Metaforce addition: the original kept six sorted s16 index lists (min/max per axis) and intersected them per query.
+ * This broadphase keeps actor bounds in structure-of-arrays form, sorted by min x and re-sorted incrementally with
+ * insertion sort on Move. A query binary-searches both ends of the run of slots whose x extents can reach it, using
+ * the widest x extent among narrow slots to bound the start, and tests that run kLanes slots at a time with SSE2 or
+ * NEON compares (plain C++ elsewhere). Slots kWideExtentX or wider are also listed apart so one huge trigger cannot
+ * stretch every run. A sweep-and-prune endpoint list on x tracks which actors' bounds persistently overlap. Remove
+ * only tombstones a slot; dead slots and endpoints are compacted out once they make up half the table. Queries do
+ * not modify the manager and return ids in ascending id order. */
 class CSortedListManager {
-  struct SNode {
-    const CActor* x0_actor = nullptr;
-    zeus::CAABox x4_box = zeus::skNullBox;
-    std::array<s16, 6> x1c_selfIdxs{-1, -1, -1, -1, -1, -1};
-    s16 x28_next = -1;
-    bool x2a_populated = false;
-    SNode() = default;
-    SNode(const CActor* act, const zeus::CAABox& aabb) : x0_actor(act), x4_box(aabb), x2a_populated(true) {}
+public:
+  using OverlapPair = std::pair<TUniqueId, TUniqueId>;
+
+private:
+  /* Lanes per overlap test block; the SoA arrays are padded by this much so a block never reads past the end */
+  static constexpr u32 kLanes = 8;
+  /* Slots at least this wide on x are searched apart and left out of m_narrowExtentX */
+  static constexpr float kWideExtentX = 32.f;
+
+  struct SEndpoint {
+    float x0_value;
+    s16 x4_node;
+    bool x6_max;
   };
-  std::array<SNode, kMaxEntities> x0_nodes;
-  std::array<SSortedList, 6> xb000_sortedLists;
+
+  /* Indexed by slot, sorted by min x; slots [0, m_count) are in use, live unless their node is -1. All of these grow
+   * together in GrowSlots, kLanes past the slots in use. */
+  std::vector<float> m_minX;
+  std::vector<float> m_minY;
+  std::vector<float> m_minZ;
+  std::vector<float> m_maxX;
+  std::vector<float> m_maxY;
+  std::vector<float> m_maxZ;
+  std::vector<s16> m_slotNode;
+  u32 m_count = 0;
+  /* Tombstoned slots within [0, m_count); each also leaves two dead endpoints */
+  u32 m_deadSlots = 0;
+  /* At least the x extent of every live slot narrower than kWideExtentX; only grows until the next Compact */
+  float m_narrowExtentX = 0.f;
+  /* Nodes whose slot is kWideExtentX or wider on x, in no particular order */
+  std::vector<s16> m_wideNodes;
+
+  /* Indexed by node (the actor's unique id value), grown up to the highest node inserted */
+  std::vector<const CActor*> m_actors;
+  std::vector<s16> m_nodeSlot;
+  std::vector<std::array<u16, 2>> m_nodeEndpoints;
+
+  /* Min and max x of every node with a slot, sorted by value with mins ahead of maxes on ties; dead ones hold -1 */
+  std::vector<SEndpoint> m_endpoints;
+  u32 m_endpointCount = 0;
+  /* Node pairs whose x extents overlap, keyed by (lower node << 16) | higher node; may also hold stale pairs left
+   * by Remove until the next Compact, so readers still test liveness and bounds */
+  std::unordered_set<u32> m_xPairs;
+
   void Reset();
-  void AddToLinkedList(s16 nodeId, s16& headId, s16& tailId);
-  void RemoveFromList(ESortedList list, s16 idx);
-  void MoveInList(ESortedList list, s16 idx);
-  void InsertInList(ESortedList list, SNode& node);
-  s16 FindInListUpper(ESortedList list, float value) const;
-  s16 FindInListLower(ESortedList list, float value) const;
-  s16 ConstructIntersectionArray(const zeus::CAABox& aabb);
-  s16 CalculateIntersections(ESortedList la, ESortedList lb, s16 a, s16 b, s16 c, s16 d, ESortedList slA,
-                             ESortedList slB, ESortedList slC, ESortedList slD, const zeus::CAABox& aabb);
+  void GrowSlots();
+  bool HasNode(s16 node) const { return size_t(node) < m_actors.size() && m_actors[node] != nullptr; }
+  void SetSlotBounds(u32 slot, const zeus::CAABox& aabb);
+  void SwapSlots(u32 a, u32 b);
+  void SortSlot(u32 slot);
+  void TrackExtent(s16 node, bool wasWide, float extent);
+  bool SlotOverlaps(u32 slot, const zeus::CAABox& aabb) const;
+  u32 BlockHits(u32 base, const zeus::CAABox& aabb) const;
+  void SwapEndpoints(u32 left, u32 right);
+  void SortEndpoint(u32 idx);
+  void Compact();
+  bool NodesOverlap(s16 a, s16 b) const;
+  template <typename Fn>
+  void ForEachOverlap(const zeus::CAABox& aabb, Fn&& fn) const;
 
 public:
   CSortedListManager();
   void BuildNearList(EntityList& out, const zeus::CVector3f& pos, const zeus::CVector3f& dir, float mag,
-                     const CMaterialFilter& filter, const CActor* actor);
-  void BuildNearList(EntityList& out, const CActor& actor, const zeus::CAABox& aabb);
-  void BuildNearList(EntityList& out, const zeus::CAABox& aabb, const CMaterialFilter& filter, const CActor* actor);
+                     const CMaterialFilter& filter, const CActor* actor) const;
+  void BuildNearList(EntityList& out, const CActor& actor, const zeus::CAABox& aabb) const;
+  void BuildNearList(EntityList& out, const zeus::CAABox& aabb, const CMaterialFilter& filter,
+                     const CActor* actor) const;
   void Remove(const CActor* actor);
   void Move(const CActor* actor, const zeus::CAABox& aabb);
   void Insert(const CActor* actor, const zeus::CAABox& aabb);
   bool ActorInLists(const CActor* actor) const;
+  /* Actors whose bounds overlap as of their last Insert/Move, lower id first, ordered by the lower then higher id */
+  void BuildOverlappingPairs(std::vector<OverlapPair>& out) const;
 };
 
 } // namespace metaforce
@@ -1,6 +1,13 @@
 #include "Runtime/CStateManager.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <iterator>
+#include <mutex>
+#include <numeric>
+#include <span>
+#include <variant>
 
 #include "Runtime/AutoMapper/CMapWorldInfo.hpp"
 #include "Runtime/Camera/CBallCamera.hpp"
@@ -16,6 +23,7 @@
 #include "Runtime/CPlayerState.hpp"
 #include "Runtime/CSortedLists.hpp"
 #include "Runtime/CTimeProvider.hpp"
+#include "Runtime/CWorkerPool.hpp"
 #include "Runtime/GameGlobalObjects.hpp"
 #include "Runtime/Graphics/CCubeRenderer.hpp"
 #include "Runtime/Graphics/CLight.hpp"
@@ -30,6 +38,7 @@
 #include "Runtime/Weapon/CWeaponMgr.hpp"
 #include "Runtime/World/CDestroyableRock.hpp"
 #include "Runtime/World/CGameLight.hpp"
+#include "Runtime/World/CDamageInfo.hpp"
 #include "Runtime/World/CPathFindSearch.hpp"
 #include "Runtime/World/CPatterned.hpp"
 #include "Runtime/World/CPlayer.hpp"
@@ -60,6 +69,64 @@ CVar* debugToolDrawCollisionActors = nullptr;
 CVar* debugToolDrawMazePath = nullptr;
 CVar* debugToolDrawPlatformCollision = nullptr;
 CVar* sm_logScripting = nullptr;
+CVar* sm_parallelThink = nullptr;
+CVar* sm_parallelMove = nullptr;
+CVar* sm_entityProfiler = nullptr;
+
+// Side effects an area-local entity issues during a parallel think phase, replayed once every batch has finished
+struct SThinkMessage {
+  TUniqueId x0_dest;
+  TUniqueId x2_src;
+  EScriptObjectMessage x4_msg;
+  bool x8_always;
+};
+struct SThinkDamage {
+  TUniqueId x0_damager;
+  TUniqueId x2_damagee;
+  TUniqueId x4_radiusSender;
+  CDamageInfo x8_info;
+  CMaterialFilter x28_filter;
+  zeus::CVector3f x40_knockbackVec;
+};
+struct SThinkFree {
+  TUniqueId x0_id;
+};
+// A message already delivered inside a move island, counted on replay since the stats are not shared
+struct SThinkCount {
+  TUniqueId x0_src;
+  EScriptObjectMessage x2_msg;
+};
+struct SThinkCommand {
+  TUniqueId x0_issuer;
+  std::variant<SThinkMessage, SThinkDamage, SThinkFree, SThinkCount, std::function<void(CStateManager&)>> x8_cmd;
+};
+struct SThinkBatch {
+  TUniqueId x0_issuer = kInvalidUniqueId;
+  std::vector<SThinkCommand> x8_cmds;
+  // Per-entity times for the entity profiler, handed over on the main thread
+  std::vector<std::pair<CEntity*, std::chrono::nanoseconds>> x20_times;
+  // Entities only this batch touches, sorted by id; messages to them are delivered at once
+  std::vector<TUniqueId> x38_members;
+
+  bool IsMember(TUniqueId id) const {
+    return std::binary_search(x38_members.cbegin(), x38_members.cend(), id);
+  }
+};
+// Batch the current thread is running, if any; set only for the duration of an area-local job
+thread_local SThinkBatch* tl_thinkBatch = nullptr;
+
+// Locks around the sorted and object lists, taken only by the jobs of a parallel phase
+std::shared_lock<std::shared_mutex> LockListsShared(std::shared_mutex& mutex) {
+  return tl_thinkBatch != nullptr ? std::shared_lock(mutex) : std::shared_lock<std::shared_mutex>();
+}
+std::unique_lock<std::shared_mutex> LockListsUnique(std::shared_mutex& mutex) {
+  return tl_thinkBatch != nullptr ? std::unique_lock(mutex) : std::unique_lock<std::shared_mutex>();
+}
+
+// Same answer as GetCameraObjectList().GetObjectById(ent.GetUniqueId()) != nullptr, from the entity's own list bits
+bool IsListedCamera(const CEntity& ent) {
+  return ent.IsInObjectList(EGameObjectList::GameCamera) && !ent.IsScriptingBlocked();
+}
 } // namespace
 logvisor::Module LogModule("metaforce::CStateManager");
 CStateManager::CStateManager(const std::weak_ptr<CScriptMailbox>& mailbox, const std::weak_ptr<CMapWorldInfo>& mwInfo,
@@ -222,6 +289,32 @@ CStateManager::CStateManager(const std::weak_ptr<CScriptMailbox>& mailbox, const
         CVar::EFlags::ReadOnly | CVar::EFlags::Archive | CVar::EFlags::Game);
   }
   m_logScriptingReference.emplace(&m_logScripting, sm_logScripting);
+
+  if (sm_parallelThink == nullptr) {
+    sm_parallelThink = CVarManager::instance()->findOrMakeCVar(
+        "stateManager.parallelThink"sv,
+        "Updates runs of area-local entities in per-area batches on worker threads, each at its place in the order",
+        false,
+        CVar::EFlags::Archive | CVar::EFlags::Game);
+  }
+  m_parallelThinkReference.emplace(&m_parallelThink, sm_parallelThink);
+
+  if (sm_parallelMove == nullptr) {
+    sm_parallelMove = CVarManager::instance()->findOrMakeCVar(
+        "stateManager.parallelMove"sv,
+        "Moves physics actors that cannot reach each other in islands on worker threads. Only classes whose collision "
+        "response stays inside their island take part, so the result matches a serial move",
+        false, CVar::EFlags::Archive | CVar::EFlags::Game);
+  }
+  m_parallelMoveReference.emplace(&m_parallelMove, sm_parallelMove);
+
+  if (sm_entityProfiler == nullptr) {
+    sm_entityProfiler = CVarManager::instance()->findOrMakeCVar(
+        "stateManager.entityProfiler"sv,
+        "Times PreThink, Think, Touch, messages, rendering and collision moves per entity class", false,
+        CVar::EFlags::Game);
+  }
+  m_entityProfileReference.emplace(&m_entityProfile, sm_entityProfiler);
 }
 
 CStateManager::~CStateManager() {
@@ -314,6 +407,7 @@ void CStateManager::RendererDrawCallback(void* drawable, void* ctx, int type) {
     if (actor.xc6_nextDrawNode != kInvalidUniqueId) {
       mgr.RecursiveDrawTree(actor.xc6_nextDrawNode);
     }
+    CEntityProfiler::CScope scope(&mgr.m_entityProfiler, actor, EEntityProfileEvent::Render);
     actor.Render(mgr);
     actor.xc8_drawnToken = mgr.x8dc_objectDrawToken;
     break;
@@ -798,14 +892,14 @@ void CStateManager::DrawWorld() {
   for (const auto& id : x86c_stateManagerContainer->xf370_) {
     if (auto* ent = static_cast<CActor*>(ObjectById(id))) {
       if (!thermal || (ent->xe6_27_thermalVisorFlags & 1) != 0) {
+        CEntityProfiler::CScope scope(&m_entityProfiler, *ent, EEntityProfileEvent::Render);
         ent->Render(*this);
       }
     }
   }
 
   bool morphingPlayerVisible = false;
-  int thermalActorCount = 0;
-  std::array<CActor*, kMaxEntities> thermalActorArr;
+  m_thermalActors.clear();
   for (int i = 0; i < areaCount; ++i) {
     const CGameArea& area = *areaArr[i];
     CPVSVisSet& pvs = pvsArr[i];
@@ -829,19 +923,22 @@ void CStateManager::DrawWorld() {
           }
           switch (x84c_player->GetMorphballTransitionState()) {
           case CPlayer::EPlayerMorphBallState::Unmorphed:
-          case CPlayer::EPlayerMorphBallState::Morphed:
+          case CPlayer::EPlayerMorphBallState::Morphed: {
+            CEntityProfiler::CScope scope(&m_entityProfiler, *x84c_player, EEntityProfileEvent::AddToRenderer);
             x84c_player->AddToRenderer(frustum, *this);
             continue;
+          }
           default:
             morphingPlayerVisible = true;
             continue;
           }
         }
         if (!thermal || (actor->xe6_27_thermalVisorFlags & 1) != 0) {
+          CEntityProfiler::CScope scope(&m_entityProfiler, *actor, EEntityProfileEvent::AddToRenderer);
           actor->AddToRenderer(frustum, *this);
         }
         if (thermal && (actor->xe6_27_thermalVisorFlags & 2) != 0) {
-          thermalActorArr[thermalActorCount++] = actor.GetPtr();
+          m_thermalActors.push_back(actor.GetPtr());
         }
       }
     }
@@ -866,6 +963,7 @@ void CStateManager::DrawWorld() {
   x880_envFxManager->Render(*this);
 
   if (morphingPlayerVisible) {
+    CEntityProfiler::CScope scope(&m_entityProfiler, *x84c_player, EEntityProfileEvent::Render);
     x84c_player->Render(*this);
   }
 
@@ -877,6 +975,7 @@ void CStateManager::DrawWorld() {
       for (const auto& id : x86c_stateManagerContainer->xf39c_renderLast) {
         if (auto* actor = static_cast<CActor*>(ObjectById(id))) {
           if ((actor->xe6_27_thermalVisorFlags & 1) != 0) {
+            CEntityProfiler::CScope scope(&m_entityProfiler, *actor, EEntityProfileEvent::Render);
             actor->Render(*this);
           }
         }
@@ -889,6 +988,7 @@ void CStateManager::DrawWorld() {
     for (const auto& id : x86c_stateManagerContainer->xf370_) {
       if (auto* actor = static_cast<CActor*>(ObjectById(id))) {
         if ((actor->xe6_27_thermalVisorFlags & 2) != 0) {
+          CEntityProfiler::CScope scope(&m_entityProfiler, *actor, EEntityProfileEvent::Render);
           actor->Render(*this);
         }
       }
@@ -909,13 +1009,13 @@ void CStateManager::DrawWorld() {
       const CGameArea& area = *areaArr[i];
       CPVSVisSet& pvs = pvsArr[i];
 
-      for (int j = 0; j < thermalActorCount; ++j) {
-        CActor* actor = thermalActorArr[j];
+      for (CActor* actor : m_thermalActors) {
         if (actor->GetAreaIdAlways() != area.x4_selfIdx) {
           if (actor->GetAreaIdAlways() != kInvalidAreaId || area.x4_selfIdx != visAreaId) {
             continue;
           }
         }
+        CEntityProfiler::CScope scope(&m_entityProfiler, *actor, EEntityProfileEvent::AddToRenderer);
         actor->AddToRenderer(frustum, *this);
       }
 
@@ -923,6 +1023,7 @@ void CStateManager::DrawWorld() {
         x884_actorModelParticles->AddStragglersToRenderer(*this);
         CDecalManager::AddToRenderer(frustum, *this);
         if (x84c_player) {
+          CEntityProfiler::CScope scope(&m_entityProfiler, *x84c_player, EEntityProfileEvent::AddToRenderer);
           x84c_player->AddToRenderer(frustum, *this);
         }
       }
@@ -955,6 +1056,7 @@ void CStateManager::DrawWorld() {
     for (const auto& id : x86c_stateManagerContainer->xf39c_renderLast) {
       if (auto* actor = static_cast<CActor*>(ObjectById(id))) {
         if (!thermal || actor->xe6_27_thermalVisorFlags & 0x2) {
+          CEntityProfiler::CScope scope(&m_entityProfiler, *actor, EEntityProfileEvent::Render);
           actor->Render(*this);
         }
       }
@@ -1194,6 +1296,7 @@ void CStateManager::RecursiveDrawTree(TUniqueId node) {
         RecursiveDrawTree(actor->xc6_nextDrawNode);
       }
       if (x8dc_objectDrawToken == actor->xcc_addedToken) {
+        CEntityProfiler::CScope scope(&m_entityProfiler, *actor, EEntityProfileEvent::Render);
         actor->Render(*this);
       }
       actor->xc8_drawnToken = x8dc_objectDrawToken;
@@ -1206,6 +1309,15 @@ void CStateManager::SendScriptMsg(CEntity* dest, TUniqueId src, EScriptObjectMes
     return;
   }
 
+  if (tl_thinkBatch == nullptr) {
+    CountScriptMsg(src, msg);
+  } else if (tl_thinkBatch->IsMember(dest->GetUniqueId())) {
+    tl_thinkBatch->x8_cmds.push_back({tl_thinkBatch->x0_issuer, SThinkCount{src, msg}});
+  } else {
+    tl_thinkBatch->x8_cmds.push_back({tl_thinkBatch->x0_issuer, SThinkMessage{dest->GetUniqueId(), src, msg, false}});
+    return;
+  }
+
   if (m_logScripting) {
     auto srcObj = GetObjectById(src);
     if (srcObj != nullptr) {
@@ -1217,7 +1329,13 @@ void CStateManager::SendScriptMsg(CEntity* dest, TUniqueId src, EScriptObjectMes
     }
   }
 
+  // Scopes are main thread only; a move job charges the delivery to the moving actor instead
+  CEntityProfiler::CScope scope(tl_thinkBatch == nullptr ? &m_entityProfiler : nullptr, *dest,
+                                EEntityProfileEvent::AcceptScriptMsg);
+  const u32 nesting = tl_thinkBatch == nullptr ? 1 : 0;
+  m_scriptMsgNesting += nesting;
   dest->AcceptScriptMsg(msg, src, *this);
+  m_scriptMsgNesting -= nesting;
 }
 
 void CStateManager::SendScriptMsg(TUniqueId dest, TUniqueId src, EScriptObjectMessage msg) {
@@ -1226,11 +1344,22 @@ void CStateManager::SendScriptMsg(TUniqueId dest, TUniqueId src, EScriptObjectMe
 }
 
 void CStateManager::SendScriptMsgAlways(TUniqueId dest, TUniqueId src, EScriptObjectMessage msg) {
+  if (tl_thinkBatch != nullptr && !tl_thinkBatch->IsMember(dest)) {
+    tl_thinkBatch->x8_cmds.push_back({tl_thinkBatch->x0_issuer, SThinkMessage{dest, src, msg, true}});
+    return;
+  }
+
   CEntity* dst = ObjectById(dest);
   if (dst == nullptr) {
     return;
   }
 
+  if (tl_thinkBatch == nullptr) {
+    CountScriptMsg(src, msg);
+  } else {
+    tl_thinkBatch->x8_cmds.push_back({tl_thinkBatch->x0_issuer, SThinkCount{src, msg}});
+  }
+
   if (m_logScripting) {
     auto srcObj = GetObjectById(src);
     if (srcObj != nullptr) {
@@ -1242,39 +1371,62 @@ void CStateManager::SendScriptMsgAlways(TUniqueId dest, TUniqueId src, EScriptOb
     }
   }
 
+  CEntityProfiler::CScope scope(tl_thinkBatch == nullptr ? &m_entityProfiler : nullptr, *dst,
+                                EEntityProfileEvent::AcceptScriptMsg);
+  const u32 nesting = tl_thinkBatch == nullptr ? 1 : 0;
+  m_scriptMsgNesting += nesting;
   dst->AcceptScriptMsg(msg, src, *this);
+  m_scriptMsgNesting -= nesting;
 }
 
 void CStateManager::SendScriptMsg(TUniqueId src, TEditorId dest, EScriptObjectMessage msg, EScriptObjectState state) {
   // CEntity* ent = GetObjectById(src);
-  const auto search = GetIdListForScript(dest);
-  if (search.first == x890_scriptIdMap.cend()) {
+  if (tl_thinkBatch != nullptr) {
+    // Worker threads only read the index; it was flushed before the parallel phase began
+    const auto search = x890_scriptIdMap.EqualRange(dest);
+    for (auto it = search.first; it != search.second; ++it) {
+      SendScriptMsg(ObjectById(it->second), src, msg);
+    }
     return;
   }
+  x890_scriptIdMap.ForEachEntity(dest, [&](CEntity& dobj) { SendScriptMsg(&dobj, src, msg); });
+}
 
-  for (auto it = search.first; it != search.second; ++it) {
-    const TUniqueId id = it->second;
-    CEntity* dobj = GetAllObjectList().GetObjectById(id);
-    SendScriptMsg(dobj, src, msg);
+void CStateManager::CountScriptMsg(TUniqueId src, EScriptObjectMessage msg) {
+  ++m_scriptMsgStats.x100_total;
+  m_scriptMsgStats.x104_deepestChain = std::max(m_scriptMsgStats.x104_deepestChain, m_scriptMsgNesting + 1);
+  const auto slot = size_t(s32(msg) + 1);
+  if (slot < m_scriptMsgStats.x0_perMessage.size()) {
+    ++m_scriptMsgStats.x0_perMessage[slot];
+  }
+  if (m_scriptMsgSenderStats) {
+    CEntity* sender = ObjectById(src);
+    ++m_scriptMsgStats.xc8_perSender[sender != nullptr ? sender->ImGuiType() : "None"sv];
   }
 }
 
+void SScriptMsgStats::Reset() {
+  x0_perMessage.fill(0);
+  xc8_perSender.clear();
+  x100_total = 0;
+  x104_deepestChain = 0;
+}
+
 void CStateManager::FreeScriptObjects(TAreaId aid) {
-  for (const auto& p : x890_scriptIdMap) {
+  x890_scriptIdMap.ForEach([&](const CScriptIdIndex::Entry& p) {
     if (p.first.AreaNum() == aid) {
       FreeScriptObject(p.second);
     }
-  }
+  });
 
-  std::set<TEditorId> freedObjects;
-  for (auto it = x8a4_loadedScriptObjects.begin(); it != x8a4_loadedScriptObjects.end();) {
-    if (it->first.AreaNum() == aid) {
-      freedObjects.emplace(it->first);
-      it = x8a4_loadedScriptObjects.erase(it);
-      continue;
+  std::vector<TEditorId> freedObjects;
+  std::erase_if(x8a4_loadedScriptObjects, [&](const std::pair<TEditorId, SScriptObjectStream>& p) {
+    if (p.first.AreaNum() == aid) {
+      freedObjects.push_back(p.first);
+      return true;
     }
-    ++it;
-  }
+    return false;
+  });
 
   const CGameArea* area = x850_world->GetGameAreas()[aid].get();
   if (area->IsPostConstructed()) {
@@ -1286,12 +1438,28 @@ void CStateManager::FreeScriptObjects(TAreaId aid) {
     }
   }
 
-  for (const auto& id : freedObjects) {
-    m_incomingConnections.erase(id);
+  size_t out = 0;
+  for (size_t i = 0; i < m_incomingTargets.size(); ++i) {
+    if (std::binary_search(freedObjects.cbegin(), freedObjects.cend(), m_incomingTargets[i])) {
+      continue;
+    }
+    m_incomingTargets[out] = m_incomingTargets[i];
+    m_incomingConns[out] = m_incomingConns[i];
+    ++out;
+  }
+  if (out != m_incomingTargets.size()) {
+    m_incomingTargets.resize(out);
+    m_incomingConns.resize(out);
+    LinkIncomingConnections();
   }
 }
 
 void CStateManager::FreeScriptObject(TUniqueId id) {
+  if (tl_thinkBatch != nullptr) {
+    tl_thinkBatch->x8_cmds.push_back({tl_thinkBatch->x0_issuer, SThinkFree{id}});
+    return;
+  }
+
   CEntity* ent = ObjectById(id);
   if (ent == nullptr || ent->IsInGraveyard()) {
     return;
@@ -1299,7 +1467,10 @@ void CStateManager::FreeScriptObject(TUniqueId id) {
 
   ent->SetIsInGraveyard(true);
   x854_objectGraveyard.push_back(id);
-  ent->AcceptScriptMsg(EScriptObjectMessage::Deleted, kInvalidUniqueId, *this);
+  {
+    CEntityProfiler::CScope scope(&m_entityProfiler, *ent, EEntityProfileEvent::AcceptScriptMsg);
+    ent->AcceptScriptMsg(EScriptObjectMessage::Deleted, kInvalidUniqueId, *this);
+  }
   ent->SetIsScriptingBlocked(true);
 
   if (const TCastToPtr<CActor> act = ent) {
@@ -1313,8 +1484,10 @@ void CStateManager::FreeScriptObject(TUniqueId id) {
 }
 
 std::pair<const SScriptObjectStream*, TEditorId> CStateManager::GetBuildForScript(TEditorId id) const {
-  const auto search = x8a4_loadedScriptObjects.find(id);
-  if (search == x8a4_loadedScriptObjects.cend()) {
+  const auto search =
+      std::lower_bound(x8a4_loadedScriptObjects.cbegin(), x8a4_loadedScriptObjects.cend(), id,
+                       [](const std::pair<TEditorId, SScriptObjectStream>& p, TEditorId id) { return p.first < id; });
+  if (search == x8a4_loadedScriptObjects.cend() || search->first != id) {
     return {nullptr, kInvalidEditorId};
   }
   return {&search->second, search->first};
@@ -1328,22 +1501,11 @@ TEditorId CStateManager::GetEditorIdForUniqueId(TUniqueId id) const {
   return kInvalidEditorId;
 }
 
-TUniqueId CStateManager::GetIdForScript(TEditorId id) const {
-  const auto search = x890_scriptIdMap.find(id);
-  if (search == x890_scriptIdMap.cend()) {
-    return kInvalidUniqueId;
-  }
-  return search->second;
-}
+TUniqueId CStateManager::GetIdForScript(TEditorId id) const { return x890_scriptIdMap.FindFirst(id); }
 
-std::pair<std::multimap<TEditorId, TUniqueId>::const_iterator, std::multimap<TEditorId, TUniqueId>::const_iterator>
+std::pair<CScriptIdIndex::const_iterator, CScriptIdIndex::const_iterator>
 CStateManager::GetIdListForScript(TEditorId id) const {
-  auto ret = x890_scriptIdMap.equal_range(id);
-  if (ret.first != x890_scriptIdMap.cend() && ret.first->first != id) {
-    ret.first = x890_scriptIdMap.cend();
-    ret.second = x890_scriptIdMap.cend();
-  }
-  return ret;
+  return x890_scriptIdMap.EqualRange(id);
 }
 
 void CStateManager::LoadScriptObjects(TAreaId aid, CInputStream& in, std::vector<TEditorId>& idsOut) {
@@ -1351,6 +1513,9 @@ void CStateManager::LoadScriptObjects(TAreaId aid, CInputStream& in, std::vector
 
   const u32 objCount = in.ReadLong();
   idsOut.reserve(idsOut.size() + objCount);
+  // Builds from this layer are appended unsorted and merged in once at the end
+  const size_t firstBuild = x8a4_loadedScriptObjects.size();
+  const size_t firstId = idsOut.size();
   for (u32 i = 0; i < objCount; ++i) {
     const auto objType = static_cast<EScriptObjectType>(in.ReadUint8());
     const u32 objSize = in.ReadLong();
@@ -1360,22 +1525,119 @@ void CStateManager::LoadScriptObjects(TAreaId aid, CInputStream& in, std::vector
       continue;
     }
 
-    const auto build = GetBuildForScript(id.first);
-    if (build.first) {
-      continue;
-    }
-
-    x8a4_loadedScriptObjects[id.first] = SScriptObjectStream{objType, pos, objSize};
+    x8a4_loadedScriptObjects.emplace_back(id.first, SScriptObjectStream{objType, pos, objSize});
     idsOut.push_back(id.first);
   }
 
-  for (const auto& pair : m_incomingConnections) {
-    if (auto* ent = ObjectById(GetIdForScript(pair.first))) {
-      ent->SetIncomingConnectionList(&pair.second);
+  MergeLoadedScriptObjects(firstBuild, idsOut, firstId);
+  CommitIncomingConnections();
+}
+
+void CStateManager::MergeLoadedScriptObjects(size_t firstBuild, std::vector<TEditorId>& idsOut, size_t firstId) {
+  const auto less = [](const std::pair<TEditorId, SScriptObjectStream>& a,
+                       const std::pair<TEditorId, SScriptObjectStream>& b) { return a.first < b.first; };
+  const auto first = x8a4_loadedScriptObjects.begin();
+  const auto mid = first + firstBuild;
+  const auto last = x8a4_loadedScriptObjects.end();
+  std::stable_sort(mid, last, less);
+
+  const auto known = [&](TEditorId id) {
+    const auto it = std::lower_bound(first, mid, std::make_pair(id, SScriptObjectStream{}), less);
+    return it != mid && it->first == id;
+  };
+  bool duplicates = false;
+  for (auto it = mid; it != last && !duplicates; ++it) {
+    duplicates = known(it->first) || (it != mid && (it - 1)->first == it->first);
+  }
+
+  if (duplicates) {
+    // Rare: the first build of an editor id wins and later copies are neither kept nor initialized, as before
+    std::vector<TEditorId> kept;
+    size_t out = firstId;
+    for (size_t i = firstId; i < idsOut.size(); ++i) {
+      const TEditorId id = idsOut[i];
+      if (known(id) || std::find(kept.cbegin(), kept.cend(), id) != kept.cend()) {
+        continue;
+      }
+      kept.push_back(id);
+      idsOut[out++] = id;
     }
+    idsOut.resize(out);
+  }
+
+  std::inplace_merge(first, mid, last, less);
+  if (duplicates) {
+    x8a4_loadedScriptObjects.erase(
+        std::unique(x8a4_loadedScriptObjects.begin(), x8a4_loadedScriptObjects.end(),
+                    [](const auto& a, const auto& b) { return a.first == b.first; }),
+        x8a4_loadedScriptObjects.end());
   }
 }
 
+void CStateManager::CommitIncomingConnections() {
+  if (m_pendingIncoming.empty()) {
+    return;
+  }
+
+  // Keyed by target and source editor id; like the std::set this replaces, the first connection recorded wins
+  const auto less = [](const std::pair<TEditorId, SConnection>& a, const std::pair<TEditorId, SConnection>& b) {
+    return a.first < b.first || (a.first == b.first && a.second < b.second);
+  };
+  std::stable_sort(m_pendingIncoming.begin(), m_pendingIncoming.end(), less);
+  const auto known = [&](const std::pair<TEditorId, SConnection>& p) {
+    const auto [first, last] = std::equal_range(m_incomingTargets.cbegin(), m_incomingTargets.cend(), p.first);
+    const auto conns = m_incomingConns.cbegin() + (first - m_incomingTargets.cbegin());
+    const auto connsEnd = m_incomingConns.cbegin() + (last - m_incomingTargets.cbegin());
+    return std::binary_search(conns, connsEnd, p.second);
+  };
+  size_t count = 0;
+  for (size_t i = 0; i < m_pendingIncoming.size(); ++i) {
+    const bool repeat = count != 0 && !less(m_pendingIncoming[count - 1], m_pendingIncoming[i]);
+    if (!repeat && !known(m_pendingIncoming[i])) {
+      m_pendingIncoming[count++] = m_pendingIncoming[i];
+    }
+  }
+  m_pendingIncoming.resize(count);
+  if (m_pendingIncoming.empty()) {
+    // Regenerated objects only repeat connections their area load already recorded, so nothing needs relinking
+    return;
+  }
+
+  std::vector<TEditorId> targets;
+  std::vector<SConnection> conns;
+  targets.reserve(m_incomingTargets.size() + m_pendingIncoming.size());
+  conns.reserve(targets.capacity());
+  size_t i = 0;
+  for (const auto& pending : m_pendingIncoming) {
+    for (; i < m_incomingTargets.size() && less({m_incomingTargets[i], m_incomingConns[i]}, pending); ++i) {
+      targets.push_back(m_incomingTargets[i]);
+      conns.push_back(m_incomingConns[i]);
+    }
+    targets.push_back(pending.first);
+    conns.push_back(pending.second);
+  }
+  targets.insert(targets.end(), m_incomingTargets.cbegin() + i, m_incomingTargets.cend());
+  conns.insert(conns.end(), m_incomingConns.cbegin() + i, m_incomingConns.cend());
+  m_incomingTargets = std::move(targets);
+  m_incomingConns = std::move(conns);
+  m_pendingIncoming.clear();
+  LinkIncomingConnections();
+}
+
+void CStateManager::LinkIncomingConnections() {
+  // Entities hold spans into m_incomingConns, so every reallocation or erase has to repoint all of them
+  x890_scriptIdMap.ForEach([&](const CScriptIdIndex::Entry& p) {
+    if (CEntity* ent = ObjectById(p.second)) {
+      ent->SetIncomingConnectionList(GetIncomingConnections(p.first));
+    }
+  });
+}
+
+std::span<const SConnection> CStateManager::GetIncomingConnections(TEditorId target) const {
+  const auto [first, last] = std::equal_range(m_incomingTargets.cbegin(), m_incomingTargets.cend(), target);
+  return {m_incomingConns.data() + (first - m_incomingTargets.cbegin()), size_t(last - first)};
+}
+
 std::pair<TEditorId, TUniqueId> CStateManager::LoadScriptObject(TAreaId aid, EScriptObjectType type, u32 length,
                                                                 CInputStream& in) {
   OPTICK_EVENT();
@@ -1389,11 +1651,7 @@ std::pair<TEditorId, TUniqueId> CStateManager::LoadScriptObject(TAreaId aid, ESc
     const auto msg = EScriptObjectMessage(in.ReadLong());
     const TEditorId target = in.ReadLong();
     // Metaforce Addition
-    if (m_incomingConnections.find(target) == m_incomingConnections.cend()) {
-      m_incomingConnections.emplace(target, std::set<SConnection>());
-    }
-    SConnection inConn{state, msg, id};
-    m_incomingConnections[target].emplace(inConn);
+    m_pendingIncoming.emplace_back(target, SConnection{state, msg, id});
     // End Metaforce Addition
     length -= 12;
     conns.push_back(SConnection{state, msg, target});
@@ -1455,10 +1713,9 @@ std::pair<TEditorId, TUniqueId> CStateManager::GenerateObject(TEditorId eid) {
       CMemoryInStream stream(buf.first + build.first->x4_position, build.first->x8_length);
       auto ret = LoadScriptObject(build.second.AreaNum(), build.first->x0_type, build.first->x8_length, stream);
       // Metaforce Addition
-      if (m_incomingConnections.find(eid) != m_incomingConnections.end()) {
-        if (auto ent = ObjectById(ret.second)) {
-          ent->SetIncomingConnectionList(&m_incomingConnections[eid]);
-        }
+      CommitIncomingConnections();
+      if (auto ent = ObjectById(ret.second)) {
+        ent->SetIncomingConnectionList(GetIncomingConnections(eid));
       }
       // End Metaforce Addition
       return ret;
@@ -1903,6 +2160,13 @@ bool CStateManager::ApplyLocalDamage(const zeus::CVector3f& pos, const zeus::CVe
 bool CStateManager::ApplyDamage(TUniqueId damagerId, TUniqueId damageeId, TUniqueId radiusSender,
                                 const CDamageInfo& info, const CMaterialFilter& filter,
                                 const zeus::CVector3f& knockbackVec) {
+  if (tl_thinkBatch != nullptr) {
+    tl_thinkBatch->x8_cmds.push_back(
+        {tl_thinkBatch->x0_issuer, SThinkDamage{damagerId, damageeId, radiusSender, info, filter, knockbackVec}});
+    // Same answer the immediate path gives below, which never reports anything but false
+    return false;
+  }
+
   CEntity* ent0 = ObjectById(damagerId);
   CEntity* ent1 = ObjectById(damageeId);
   const TCastToPtr<CActor> damager = ent0;
@@ -2036,6 +2300,19 @@ void CStateManager::UpdateGraphicsTiming(float dt) {
 }
 
 void CStateManager::Update(float dt) {
+  // Metaforce addition: an entity profiler frame runs from one update to the next, taking in the draw between them
+  m_entityProfiler.SetEnabled(m_entityProfile);
+  m_entityProfiler.EndFrame();
+
+  // Metaforce addition: wall-clock time per update phase, for profiling and replay benchmarks
+  m_phaseTimes.fill({});
+  auto phaseStart = std::chrono::steady_clock::now();
+  const auto endPhase = [&](EUpdatePhase phase) {
+    const auto now = std::chrono::steady_clock::now();
+    m_phaseTimes[size_t(phase)] += now - phaseStart;
+    phaseStart = now;
+  };
+
   MP1::CMain::UpdateDiscordPresence(GetWorld()->IGetStringTableAssetId());
 
   CElementGen::SetGlobalSeed(x8d8_updateFrameIdx);
@@ -2045,6 +2322,9 @@ void CStateManager::Update(float dt) {
 
   xf08_pauseHudMessage = {};
 
+  std::swap(m_scriptMsgStatsLast, m_scriptMsgStats);
+  m_scriptMsgStats.Reset();
+
   CScriptEffect::ResetParticleCounts();
   UpdateThermalVisor();
   UpdateGameState();
@@ -2063,28 +2343,35 @@ void CStateManager::Update(float dt) {
     }
   }
 
+  endPhase(EUpdatePhase::Other);
   if (x904_gameState != EGameState::Paused) {
     PreThinkObjects(dt);
     x87c_fluidPlaneManager->Update(dt);
   }
+  endPhase(EUpdatePhase::PreThink);
 
   if (x904_gameState == EGameState::Running) {
     if (!dying) {
       CDecalManager::Update(dt, *this);
     }
     UpdateSortedLists();
+    endPhase(EUpdatePhase::Other);
     if (!dying) {
       MovePlatforms(dt);
       MoveActors(dt);
     }
+    endPhase(EUpdatePhase::MoveActors);
     ProcessPlayerInput();
     if (x904_gameState != EGameState::SoftPaused) {
+      CEntityProfiler::CScope scope(&m_entityProfiler, *x84c_player, EEntityProfileEvent::Move);
       CGameCollision::Move(*this, *x84c_player, dt, nullptr);
     }
     UpdateSortedLists();
+    endPhase(EUpdatePhase::Collision);
     if (!dying) {
       CrossTouchActors();
     }
+    endPhase(EUpdatePhase::CrossTouchActors);
   } else {
     ProcessPlayerInput();
   }
@@ -2092,14 +2379,17 @@ void CStateManager::Update(float dt) {
   if (!dying && x904_gameState == EGameState::Running) {
     x884_actorModelParticles->Update(dt, *this);
   }
+  endPhase(EUpdatePhase::Other);
 
   if (x904_gameState == EGameState::Running || x904_gameState == EGameState::SoftPaused) {
     Think(dt);
   }
+  endPhase(EUpdatePhase::Think);
 
   if (x904_gameState != EGameState::SoftPaused) {
     x870_cameraManager->Update(dt, *this);
   }
+  endPhase(EUpdatePhase::Camera);
 
   while (xf76_lastRelay != kInvalidUniqueId) {
     if (CEntity* ent = ObjectById(xf76_lastRelay)) {
@@ -2123,6 +2413,7 @@ void CStateManager::Update(float dt) {
   if (!dying && x904_gameState == EGameState::Running && !x870_cameraManager->IsInCinematicCamera()) {
     UpdateEscapeSequenceTimer(dt);
   }
+  endPhase(EUpdatePhase::Other);
 
   x850_world->Update(dt);
   x88c_rumbleManager->Update(dt);
@@ -2132,6 +2423,7 @@ void CStateManager::Update(float dt) {
   }
 
   UpdateAreaSounds();
+  endPhase(EUpdatePhase::World);
 
   xf94_24_readyToRender = true;
 
@@ -2151,6 +2443,47 @@ void CStateManager::Update(float dt) {
 
   ClearGraveyard();
   ++x8d8_updateFrameIdx;
+  endPhase(EUpdatePhase::Other);
+}
+
+u32 CStateManager::ComputeStateHash() const {
+  // FNV-1a over what the simulation leaves behind each frame; bit patterns, so -0.f and NaN payloads count
+  u32 hash = 2166136261u;
+  const auto mix = [&hash](const auto& value) {
+    const auto* bytes = reinterpret_cast<const u8*>(&value);
+    for (size_t i = 0; i < sizeof(value); ++i) {
+      hash = (hash ^ bytes[i]) * 16777619u;
+    }
+  };
+  mix(x8d8_updateFrameIdx);
+  mix(x8fc_random.GetSeed());
+  for (const CEntity* ent : GetAllObjectList()) {
+    mix(ent->GetUniqueId().id);
+    mix(ent->GetActive());
+    if (const TCastToConstPtr<CActor> act = ent) {
+      const zeus::CTransform& xf = act->GetTransform();
+      for (size_t i = 0; i < 3; ++i) {
+        mix(xf.basis[i].x());
+        mix(xf.basis[i].y());
+        mix(xf.basis[i].z());
+      }
+      mix(xf.origin.x());
+      mix(xf.origin.y());
+      mix(xf.origin.z());
+    }
+    if (const TCastToConstPtr<CPhysicsActor> phys = ent) {
+      const zeus::CVector3f& vel = phys->GetVelocity();
+      mix(vel.x());
+      mix(vel.y());
+      mix(vel.z());
+    }
+  }
+  return hash;
+}
+
+void CStateManager::SetReplaySeeds(u32 updateFrameIdx, s32 randomSeed) {
+  x8d8_updateFrameIdx = updateFrameIdx;
+  x8fc_random.SetSeed(randomSeed);
 }
 
 void CStateManager::UpdateGameState() {
@@ -2188,21 +2521,133 @@ void CStateManager::UpdateHintState(float dt) {
   }
 }
 
+template <typename Commands>
+void CStateManager::ApplyDeferredCommands(Commands& cmds) {
+  for (SThinkCommand& cmd : cmds) {
+    if (const auto* msg = std::get_if<SThinkMessage>(&cmd.x8_cmd)) {
+      if (msg->x8_always) {
+        SendScriptMsgAlways(msg->x0_dest, msg->x2_src, msg->x4_msg);
+      } else {
+        SendScriptMsg(msg->x0_dest, msg->x2_src, msg->x4_msg);
+      }
+    } else if (const auto* dmg = std::get_if<SThinkDamage>(&cmd.x8_cmd)) {
+      ApplyDamage(dmg->x0_damager, dmg->x2_damagee, dmg->x4_radiusSender, dmg->x8_info, dmg->x28_filter,
+                  dmg->x40_knockbackVec);
+    } else if (const auto* free = std::get_if<SThinkFree>(&cmd.x8_cmd)) {
+      FreeScriptObject(free->x0_id);
+    } else if (const auto* count = std::get_if<SThinkCount>(&cmd.x8_cmd)) {
+      CountScriptMsg(count->x0_src, count->x2_msg);
+    } else if (auto* spawn = std::get_if<std::function<void(CStateManager&)>>(&cmd.x8_cmd)) {
+      (*spawn)(*this);
+    }
+  }
+}
+
+template <typename Fn>
+void CStateManager::RunAreaLocalThink(EEntityProfileEvent event, Fn&& fn) {
+  if (m_areaLocalThink.empty()) {
+    return;
+  }
+  if (m_areaLocalThink.size() == 1) {
+    CEntity& ent = *m_areaLocalThink.front();
+    m_areaLocalThink.clear();
+    CEntityProfiler::CScope scope(&m_entityProfiler, ent, event);
+    fn(ent);
+    return;
+  }
+
+  // Position of each entity in the run, by id, for the replay below
+  std::vector<std::pair<TUniqueId, u32>> positions;
+  positions.reserve(m_areaLocalThink.size());
+  for (u32 i = 0; i < m_areaLocalThink.size(); ++i) {
+    positions.emplace_back(m_areaLocalThink[i]->GetUniqueId(), i);
+  }
+  std::sort(positions.begin(), positions.end());
+
+  // One batch per area, keeping object list order inside it so an area updates in the same order as it would serially
+  std::stable_sort(m_areaLocalThink.begin(), m_areaLocalThink.end(), [](const CEntity* a, const CEntity* b) {
+    return a->GetAreaIdAlways() < b->GetAreaIdAlways();
+  });
+  std::vector<size_t> batchStarts;
+  for (size_t i = 0; i < m_areaLocalThink.size(); ++i) {
+    if (i == 0 || m_areaLocalThink[i]->GetAreaIdAlways() != m_areaLocalThink[i - 1]->GetAreaIdAlways()) {
+      batchStarts.push_back(i);
+    }
+  }
+  batchStarts.push_back(m_areaLocalThink.size());
+
+  // Merge pending script ids now so lookups from the jobs never write to the index
+  x890_scriptIdMap.Flush();
+  std::vector<SThinkBatch> batches(batchStarts.size() - 1);
+  {
+    CJobGroup group(CWorkerPool::GetShared());
+    const bool profile = m_entityProfiler.IsEnabled();
+    for (size_t b = 0; b < batches.size(); ++b) {
+      group.Submit([this, &fn, profile, &batch = batches[b], begin = batchStarts[b], end = batchStarts[b + 1]] {
+        tl_thinkBatch = &batch;
+        for (size_t i = begin; i < end; ++i) {
+          CEntity* ent = m_areaLocalThink[i];
+          batch.x0_issuer = ent->GetUniqueId();
+          if (profile) {
+            const auto start = std::chrono::steady_clock::now();
+            fn(*ent);
+            batch.x20_times.emplace_back(ent, std::chrono::steady_clock::now() - start);
+          } else {
+            fn(*ent);
+          }
+        }
+        tl_thinkBatch = nullptr;
+      });
+    }
+    group.Wait();
+  }
+  m_areaLocalThink.clear();
+  for (const SThinkBatch& batch : batches) {
+    for (const auto& [ent, time] : batch.x20_times) {
+      m_entityProfiler.Add(*ent, event, time);
+    }
+  }
+
+  // Replay in the order the run's entities would have updated serially, whatever order the batches were scheduled in
+  std::vector<SThinkCommand> cmds;
+  for (SThinkBatch& batch : batches) {
+    std::move(batch.x8_cmds.begin(), batch.x8_cmds.end(), std::back_inserter(cmds));
+  }
+  const auto position = [&positions](TUniqueId id) {
+    return std::lower_bound(positions.cbegin(), positions.cend(), std::pair(id, 0u))->second;
+  };
+  std::stable_sort(cmds.begin(), cmds.end(), [&position](const SThinkCommand& a, const SThinkCommand& b) {
+    return position(a.x0_issuer) < position(b.x0_issuer);
+  });
+  ApplyDeferredCommands(cmds);
+}
+
 void CStateManager::PreThinkObjects(float dt) {
   if (x84c_player->x9f4_deathTime > 0.f) {
+    CEntityProfiler::CScope scope(&m_entityProfiler, *x84c_player, EEntityProfileEvent::PreThink);
     x84c_player->DoPreThink(dt, *this);
   } else if (x904_gameState == EGameState::SoftPaused) {
-    for (CEntity* ent : GetAllObjectList()) {
+    for (CEntity* ent : GetAllObjectList().GetDenseView()) {
       if (const TCastToPtr<CScriptEffect> effect = ent) {
+        CEntityProfiler::CScope scope(&m_entityProfiler, *ent, EEntityProfileEvent::PreThink);
         effect->PreThink(dt, *this);
       }
     }
   } else {
-    for (CEntity* ent : GetAllObjectList()) {
-      if (ent != nullptr && !GetCameraObjectList().GetObjectById(ent->GetUniqueId())) {
-        ent->PreThink(dt, *this);
+    const auto preThink = [this, dt](CEntity& ent) { ent.PreThink(dt, *this); };
+    for (CEntity* ent : GetAllObjectList().GetDenseView()) {
+      if (!IsListedCamera(*ent)) {
+        if (m_parallelThink && ent->IsAreaLocal() && ent->GetAreaIdAlways() != kInvalidAreaId) {
+          m_areaLocalThink.push_back(ent);
+        } else {
+          // The area-local run before this entity updates first, keeping every entity at its place in the order
+          RunAreaLocalThink(EEntityProfileEvent::PreThink, preThink);
+          CEntityProfiler::CScope scope(&m_entityProfiler, *ent, EEntityProfileEvent::PreThink);
+          ent->PreThink(dt, *this);
+        }
       }
     }
+    RunAreaLocalThink(EEntityProfileEvent::PreThink, preThink);
   }
 }
 
@@ -2217,6 +2662,7 @@ void CStateManager::MovePlatforms(float dt) {
       continue;
     }
 
+    CEntityProfiler::CScope scope(&m_entityProfiler, plat, EEntityProfileEvent::Move);
     CGameCollision::Move(*this, plat, dt, nullptr);
   }
 }
@@ -2252,78 +2698,376 @@ void CStateManager::MoveActors(float dt) {
 
     if (x84c_player.get() != ent) {
       if (!GetPlatformAndDoorObjectList().IsPlatform(*ent)) {
-        CGameCollision::Move(*this, physActor, dt, nullptr);
+        if (m_parallelMove) {
+          m_moveActors.push_back(&physActor);
+        } else {
+          CEntityProfiler::CScope scope(&m_entityProfiler, physActor, EEntityProfileEvent::Move);
+          CGameCollision::Move(*this, physActor, dt, nullptr);
+        }
       }
     }
   }
+  RunParallelMove(dt);
 }
 
-void CStateManager::CrossTouchActors() {
-  std::array<bool, kMaxEntities> visits{};
+zeus::CAABox CStateManager::CalculateMoveReach(CPhysicsActor& actor, float dt) {
+  zeus::CAABox reach = actor.GetMotionVolume(dt);
+  if (const std::optional<zeus::CAABox> bounds = CalculateObjectBounds(actor)) {
+    reach.accumulateBounds(*bounds);
+    if (actor.IsAngularEnabled()) {
+      // Turning sweeps the list bounds around the origin, out to their farthest corner
+      const zeus::CVector3f origin = actor.GetTranslation();
+      const zeus::CVector3f toMin = bounds->min - origin;
+      const zeus::CVector3f toMax = bounds->max - origin;
+      const float radius = zeus::CVector3f(std::max(std::fabs(toMin.x()), std::fabs(toMax.x())),
+                                           std::max(std::fabs(toMin.y()), std::fabs(toMax.y())),
+                                           std::max(std::fabs(toMin.z()), std::fabs(toMax.z())))
+                               .magnitude();
+      reach.accumulateBounds(zeus::CAABox(origin - radius, origin + radius));
+    }
+  }
+  // Collision turns the step rather than lengthening it, so one more step length in any direction covers where the
+  // actor can end up; the unit on top matches the margin the collider list queries add. Ground colliders can also
+  // step up onto a ledge and back down off one after the step.
+  const float margin = (dt * actor.CalculateNewVelocityWR_UsingImpulses()).magnitude() + 1.f;
+  const float stepZ = std::max(actor.GetStepUpHeight(), 0.f) + std::max(actor.GetStepDownHeight(), 0.f);
+  const zeus::CVector3f extent(margin, margin, margin + stepZ);
+  return {reach.min - extent, reach.max + extent};
+}
+
+void CStateManager::RunParallelMove(float dt) {
+  if (m_moveActors.empty()) {
+    return;
+  }
+
+  const u32 count = u32(m_moveActors.size());
+  std::vector<zeus::CAABox> ownReaches(count);
+  std::vector<zeus::CAABox> reaches(count);
+  std::vector<float> steps(count);
+  std::vector<u32> parent(count);
+  std::iota(parent.begin(), parent.end(), 0u);
+  const auto find = [&parent](u32 i) {
+    while (parent[i] != i) {
+      parent[i] = parent[parent[i]];
+      i = parent[i];
+    }
+    return i;
+  };
+  // The lower index stays the root, so an island is named after its first actor in list order
+  const auto unite = [&](u32 a, u32 b) {
+    a = find(a);
+    b = find(b);
+    if (a != b) {
+      parent[std::max(a, b)] = std::min(a, b);
+    }
+    return a != b;
+  };
+  // Owner entries set this frame, reset once the move is done
+  std::vector<TUniqueId> touched;
+  touched.reserve(count);
+  const auto setOwner = [this, &touched](TUniqueId id, s32 owner) {
+    const size_t idx = id.Value();
+    if (idx >= m_moveOwners.size()) {
+      m_moveOwners.resize(idx + 1, -1);
+    }
+    m_moveOwners[idx] = owner;
+    touched.push_back(id);
+  };
+
+  for (u32 i = 0; i < count; ++i) {
+    CPhysicsActor& actor = *m_moveActors[i];
+    ownReaches[i] = CalculateMoveReach(actor, dt);
+    steps[i] = (dt * actor.CalculateNewVelocityWR_UsingImpulses()).magnitude();
+    setOwner(actor.GetUniqueId(), s32(i));
+  }
+
+  // Movers whose reaches overlap can collide with each other. A collision trades momentum, so a mover can leave one
+  // with up to three times its own step plus twice the other's; widening every reach by four times the fastest step in
+  // its island covers that, and can merge more islands, so repeat until they settle.
+  std::vector<float> islandSteps(count);
+  std::vector<u32> byMinX(count);
+  for (bool merged = true; merged;) {
+    std::fill(islandSteps.begin(), islandSteps.end(), 0.f);
+    for (u32 i = 0; i < count; ++i) {
+      float& islandStep = islandSteps[find(i)];
+      islandStep = std::max(islandStep, steps[i]);
+    }
+    for (u32 i = 0; i < count; ++i) {
+      const float widen = 4.f * islandSteps[find(i)];
+      reaches[i] = {ownReaches[i].min - widen, ownReaches[i].max + widen};
+    }
+
+    merged = false;
+    std::iota(byMinX.begin(), byMinX.end(), 0u);
+    std::sort(byMinX.begin(), byMinX.end(), [&](u32 a, u32 b) { return reaches[a].min.x() < reaches[b].min.x(); });
+    for (u32 a = 0; a < count; ++a) {
+      const zeus::CAABox& reach = reaches[byMinX[a]];
+      for (u32 b = a + 1; b < count && reaches[byMinX[b]].min.x() <= reach.max.x(); ++b) {
+        if (reach.intersects(reaches[byMinX[b]]) && unite(byMinX[a], byMinX[b])) {
+          merged = true;
+        }
+      }
+    }
+  }
+
+  // Physics actors staying put join the island of every mover that can reach them. An island holding an actor whose
+  // collision handling reaches past itself is moved on this thread, at its place in list order.
+  std::vector<bool> unsafe(count);
+  std::vector<std::pair<TUniqueId, u32>> stationary;
   EntityList nearList;
+  for (u32 i = 0; i < count; ++i) {
+    unsafe[i] = !m_moveActors[i]->IsCollisionLocal() || IsSerialMover(m_moveActors[i]->GetUniqueId());
+    nearList.clear();
+    x874_sortedListManager->BuildNearList(nearList, reaches[i], CMaterialFilter::skPassEverything, nullptr);
+    for (const TUniqueId id : nearList) {
+      const TCastToConstPtr<CPhysicsActor> phys = GetObjectById(id);
+      if (!phys) {
+        continue;
+      }
+      if (const s32 owner = GetMoveOwner(id); owner >= 0) {
+        unite(u32(owner), i);
+      } else {
+        setOwner(id, s32(i));
+        stationary.emplace_back(id, i);
+        unsafe[i] = unsafe[i] || !phys->IsCollisionLocal() || IsSerialMover(id);
+      }
+    }
+  }
+  std::vector<bool> unsafeIsland(count);
+  for (u32 i = 0; i < count; ++i) {
+    if (unsafe[i]) {
+      unsafeIsland[find(i)] = true;
+    }
+  }
+
+  // One batch per safe island, holding its movers in list order
+  std::vector<s32> batchIdx(count, -1);
+  std::vector<SThinkBatch> batches;
+  std::vector<std::vector<CPhysicsActor*>> batchMovers;
+  for (u32 i = 0; i < count; ++i) {
+    const u32 root = find(i);
+    if (unsafeIsland[root]) {
+      continue;
+    }
+    if (batchIdx[root] < 0) {
+      batchIdx[root] = s32(batches.size());
+      batches.emplace_back();
+      batchMovers.emplace_back();
+    }
+    batches[batchIdx[root]].x38_members.push_back(m_moveActors[i]->GetUniqueId());
+    batchMovers[batchIdx[root]].push_back(m_moveActors[i]);
+  }
+  for (const auto& [id, mover] : stationary) {
+    if (const s32 b = batchIdx[find(mover)]; b >= 0) {
+      batches[b].x38_members.push_back(id);
+    }
+  }
+  for (SThinkBatch& batch : batches) {
+    std::sort(batch.x38_members.begin(), batch.x38_members.end());
+  }
+
+  x890_scriptIdMap.Flush();
+  {
+    CJobGroup group(CWorkerPool::GetShared());
+    const bool profile = m_entityProfiler.IsEnabled();
+    for (size_t b = 0; b < batches.size(); ++b) {
+      group.Submit([this, dt, profile, &batch = batches[b], &movers = batchMovers[b]] {
+        tl_thinkBatch = &batch;
+        for (CPhysicsActor* actor : movers) {
+          batch.x0_issuer = actor->GetUniqueId();
+          if (profile) {
+            const auto start = std::chrono::steady_clock::now();
+            CGameCollision::Move(*this, *actor, dt, nullptr);
+            batch.x20_times.emplace_back(actor, std::chrono::steady_clock::now() - start);
+          } else {
+            CGameCollision::Move(*this, *actor, dt, nullptr);
+          }
+        }
+        tl_thinkBatch = nullptr;
+      });
+    }
+    group.Wait();
+  }
+  for (const SThinkBatch& batch : batches) {
+    for (const auto& [ent, time] : batch.x20_times) {
+      m_entityProfiler.Add(*ent, EEntityProfileEvent::Move, time);
+    }
+  }
+  // A mover that ended outside its reach could have met another island's actors. Unless it landed clear of every
+  // other island this frame still matches a serial move; either way it moves serially from now on.
+  for (const std::vector<CPhysicsActor*>& movers : batchMovers) {
+    for (CPhysicsActor* actor : movers) {
+      const u32 own = u32(GetMoveOwner(actor->GetUniqueId()));
+      const std::optional<zeus::CAABox> bounds = CalculateObjectBounds(*actor);
+      if (!bounds || bounds->inside(reaches[own])) {
+        continue;
+      }
+      bool diverged = false;
+      for (u32 i = 0; i < count && !diverged; ++i) {
+        diverged = find(i) != find(own) && bounds->intersects(reaches[i]);
+      }
+      LogModule.report(diverged ? logvisor::Error : logvisor::Warning,
+                       FMT_STRING("{} left its reach during a parallel move{}; moving it serially from now on"),
+                       actor->GetName(), diverged ? " into another island" : "");
+      AddSerialMover(actor->GetUniqueId());
+    }
+  }
 
+  // Walk the movers in list order: replay what a parallel mover issued, or move an actor from an unsafe island, so
+  // both land where a serial pass would have put them. Skip actors the replay freed. The audited classes only leave
+  // list updates behind; anything else reached past the island, so its issuer moves serially from now on.
+  std::vector<SThinkCommand> cmds;
+  for (SThinkBatch& batch : batches) {
+    std::move(batch.x8_cmds.begin(), batch.x8_cmds.end(), std::back_inserter(cmds));
+  }
+  std::stable_sort(cmds.begin(), cmds.end(), [this](const SThinkCommand& a, const SThinkCommand& b) {
+    return GetMoveOwner(a.x0_issuer) < GetMoveOwner(b.x0_issuer);
+  });
+  auto cmdIt = cmds.begin();
+  for (u32 i = 0; i < count; ++i) {
+    CPhysicsActor& actor = *m_moveActors[i];
+    if (!unsafeIsland[find(i)]) {
+      const auto cmdEnd = std::find_if(cmdIt, cmds.end(), [this, i](const SThinkCommand& cmd) {
+        return GetMoveOwner(cmd.x0_issuer) != s32(i);
+      });
+      std::span<SThinkCommand> issued(cmdIt, cmdEnd);
+      for (const SThinkCommand& cmd : issued) {
+        if (!std::holds_alternative<std::function<void(CStateManager&)>>(cmd.x8_cmd)) {
+          LogModule.report(logvisor::Error, FMT_STRING("{} reached past its island during a parallel move"),
+                           actor.GetName());
+          AddSerialMover(actor.GetUniqueId());
+          break;
+        }
+      }
+      ApplyDeferredCommands(issued);
+      cmdIt = cmdEnd;
+    } else if (!actor.IsInGraveyard()) {
+      CEntityProfiler::CScope scope(&m_entityProfiler, actor, EEntityProfileEvent::Move);
+      CGameCollision::Move(*this, actor, dt, nullptr);
+    }
+  }
+
+  for (const TUniqueId id : touched) {
+    m_moveOwners[id.Value()] = -1;
+  }
+  m_moveActors.clear();
+}
+
+void CStateManager::AddSerialMover(TUniqueId id) {
+  // Drop actors freed since, so the list only ever holds live ones
+  std::erase_if(m_serialMovers,
+                [this](TUniqueId serial) { return GetAllObjectList().GetValidObjectById(serial) == nullptr; });
+  const auto it = std::lower_bound(m_serialMovers.begin(), m_serialMovers.end(), id);
+  if (it == m_serialMovers.end() || *it != id) {
+    m_serialMovers.insert(it, id);
+  }
+}
+
+void CStateManager::CrossTouchActors() {
+  // Fetch every actor's touch bounds once. Actors outside the broadphase never show up in its pairs, so the ones that
+  // call Touch still query for their neighbours below.
+  EntityList unlistedTouchers;
   for (CEntity* ent : GetActorObjectList()) {
     if (ent == nullptr) {
       continue;
     }
 
     auto& actor = static_cast<CActor&>(*ent);
-    if (!actor.GetActive() || !actor.GetCallTouch()) {
+    if (actor.GetUniqueId().Value() >= m_touchBounds.size()) {
+      m_touchBounds.resize(actor.GetUniqueId().Value() + 1);
+    }
+    std::optional<zeus::CAABox>& touchAABB = m_touchBounds[actor.GetUniqueId().Value()];
+    touchAABB = actor.GetActive() ? actor.GetTouchBounds() : std::nullopt;
+    if (touchAABB && actor.GetCallTouch() && !x874_sortedListManager->ActorInLists(&actor)) {
+      unlistedTouchers.push_back(actor.GetUniqueId());
+    }
+  }
+
+  // Broadphase bounds enclose the touch bounds, so every touching pair is among its overlaps, which come in id order.
+  // Activity is re-checked per pair since an earlier Touch may change it.
+  m_touchPairs.clear();
+  x874_sortedListManager->BuildOverlappingPairs(m_touchPairs);
+  for (const auto& [idA, idB] : m_touchPairs) {
+    const std::optional<zeus::CAABox>& touchAABBA = m_touchBounds[idA.Value()];
+    const std::optional<zeus::CAABox>& touchAABBB = m_touchBounds[idB.Value()];
+    if (!touchAABBA || !touchAABBB || !touchAABBA->intersects(*touchAABBB)) {
+      continue;
+    }
+
+    auto* actA = static_cast<CActor*>(ObjectById(idA));
+    auto* actB = static_cast<CActor*>(ObjectById(idB));
+    if (actA == nullptr || actB == nullptr || !actA->GetActive() || !actB->GetActive()) {
       continue;
     }
 
-    const std::optional<zeus::CAABox> touchAABB = actor.GetTouchBounds();
-    if (!touchAABB) {
+    // The actor that asked for touches goes first; triggers do not touch each other
+    CActor* toucher = actA->GetCallTouch() ? actA : actB;
+    CActor* other = toucher == actA ? actB : actA;
+    if (!toucher->GetCallTouch() || (toucher->GetMaterialList().HasMaterial(EMaterialTypes::Trigger) &&
+                                     other->GetMaterialList().HasMaterial(EMaterialTypes::Trigger))) {
       continue;
     }
 
+    {
+      CEntityProfiler::CScope scope(&m_entityProfiler, *toucher, EEntityProfileEvent::Touch);
+      toucher->Touch(*other, *this);
+    }
+    CEntityProfiler::CScope scope(&m_entityProfiler, *other, EEntityProfileEvent::Touch);
+    other->Touch(*toucher, *this);
+  }
+
+  EntityList nearList;
+  for (const TUniqueId id : unlistedTouchers) {
+    auto* actor = static_cast<CActor*>(ObjectById(id));
+    if (actor == nullptr || !actor->GetActive()) {
+      continue;
+    }
+
+    const zeus::CAABox& touchAABB = *m_touchBounds[id.Value()];
     CMaterialFilter filter = CMaterialFilter::skPassEverything;
-    if (actor.GetMaterialList().HasMaterial(EMaterialTypes::Trigger)) {
+    if (actor->GetMaterialList().HasMaterial(EMaterialTypes::Trigger)) {
       filter = CMaterialFilter::MakeExclude(EMaterialTypes::Trigger);
     }
 
     nearList.clear();
-    BuildNearList(nearList, *touchAABB, filter, &actor);
-
-    for (const auto& id : nearList) {
-      auto* ent2 = static_cast<CActor*>(ObjectById(id));
-      if (!ent2) {
-        continue;
-      }
-
-      const std::optional<zeus::CAABox> touchAABB2 = ent2->GetTouchBounds();
-      if (!ent2->GetActive() || !touchAABB2) {
-        continue;
-      }
+    BuildNearList(nearList, touchAABB, filter, actor);
 
-      if (visits[ent2->GetUniqueId().Value()]) {
+    for (const auto& id2 : nearList) {
+      auto* ent2 = static_cast<CActor*>(ObjectById(id2));
+      const std::optional<zeus::CAABox>& touchAABB2 = m_touchBounds[id2.Value()];
+      if (ent2 == nullptr || !ent2->GetActive() || !touchAABB2) {
         continue;
       }
 
-      if (touchAABB->intersects(*touchAABB2)) {
-        actor.Touch(*ent2, *this);
-        ent2->Touch(actor, *this);
+      if (touchAABB.intersects(*touchAABB2)) {
+        {
+          CEntityProfiler::CScope scope(&m_entityProfiler, *actor, EEntityProfileEvent::Touch);
+          actor->Touch(*ent2, *this);
+        }
+        CEntityProfiler::CScope scope(&m_entityProfiler, *ent2, EEntityProfileEvent::Touch);
+        ent2->Touch(*actor, *this);
       }
-
-      visits[actor.GetUniqueId().Value()] = true;
     }
   }
 }
 
 void CStateManager::Think(float dt) {
   if (x84c_player->x9f4_deathTime > 0.f) {
+    CEntityProfiler::CScope scope(&m_entityProfiler, *x84c_player, EEntityProfileEvent::Think);
     x84c_player->DoThink(dt, *this);
     return;
   }
 
   if (x904_gameState == EGameState::SoftPaused) {
-    for (CEntity* ent : GetAllObjectList()) {
+    for (CEntity* ent : GetAllObjectList().GetDenseView()) {
       if (const TCastToPtr<CScriptEffect> effect = ent) {
+        CEntityProfiler::CScope scope(&m_entityProfiler, *ent, EEntityProfileEvent::Think);
         effect->Think(dt, *this);
       }
     }
   } else {
-    for (CEntity* ent : GetAllObjectList()) {
+    const auto think = [this, dt](CEntity& ent) { ent.Think(dt, *this); };
+    for (CEntity* ent : GetAllObjectList().GetDenseView()) {
       if (const TCastToPtr<CPatterned> ai = ent) {
         bool doThink = !xf94_29_cinematicPause;
         if (doThink && ai->GetAreaIdAlways() != kInvalidAreaId) {
@@ -2340,10 +3084,18 @@ void CStateManager::Think(float dt) {
           continue;
         }
       }
-      if (!GetCameraObjectList().GetObjectById(ent->GetUniqueId())) {
-        ent->Think(dt, *this);
+      if (!IsListedCamera(*ent)) {
+        if (m_parallelThink && ent->IsAreaLocal() && ent->GetAreaIdAlways() != kInvalidAreaId) {
+          m_areaLocalThink.push_back(ent);
+        } else {
+          // The area-local run before this entity updates first, keeping every entity at its place in the order
+          RunAreaLocalThink(EEntityProfileEvent::Think, think);
+          CEntityProfiler::CScope scope(&m_entityProfiler, *ent, EEntityProfileEvent::Think);
+          ent->Think(dt, *this);
+        }
       }
     }
+    RunAreaLocalThink(EEntityProfileEvent::Think, think);
   }
 }
 
@@ -2487,14 +3239,7 @@ const CObjectList* CStateManager::GetObjectListById(EGameObjectList type) const
 void CStateManager::RemoveObject(TUniqueId uid) {
   if (CEntity* ent = GetAllObjectList().GetValidObjectById(uid)) {
     if (ent->GetEditorId() != kInvalidEditorId) {
-      const auto search = x890_scriptIdMap.equal_range(ent->GetEditorId());
-      for (auto it = search.first; it != search.second;) {
-        if (it->second == uid) {
-          it = x890_scriptIdMap.erase(it);
-          continue;
-        }
-        ++it;
-      }
+      x890_scriptIdMap.Remove(ent->GetEditorId(), uid);
     }
     if (ent->GetAreaIdAlways() != kInvalidAreaId) {
       CGameArea* area = x850_world->GetArea(ent->GetAreaIdAlways());
@@ -2574,15 +3319,18 @@ void CStateManager::AreaLoaded(TAreaId aid) {
 
 void CStateManager::BuildNearList(EntityList& listOut, const zeus::CVector3f& v1, const zeus::CVector3f& v2, float f1,
                                   const CMaterialFilter& filter, const CActor* actor) const {
+  const auto lock = LockListsShared(m_parallelListMutex);
   x874_sortedListManager->BuildNearList(listOut, v1, v2, f1, filter, actor);
 }
 
 void CStateManager::BuildColliderList(EntityList& listOut, const CActor& actor, const zeus::CAABox& aabb) const {
+  const auto lock = LockListsShared(m_parallelListMutex);
   x874_sortedListManager->BuildNearList(listOut, actor, aabb);
 }
 
 void CStateManager::BuildNearList(EntityList& listOut, const zeus::CAABox& aabb, const CMaterialFilter& filter,
                                   const CActor* actor) const {
+  const auto lock = LockListsShared(m_parallelListMutex);
   x874_sortedListManager->BuildNearList(listOut, aabb, filter, actor);
 }
 
@@ -2592,6 +3340,7 @@ void CStateManager::UpdateActorInSortedLists(CActor& act) {
   }
 
   const std::optional<zeus::CAABox> aabb = CalculateObjectBounds(act);
+  const auto lock = LockListsUnique(m_parallelListMutex);
   const bool actorInLists = x874_sortedListManager->ActorInLists(&act);
   if (actorInLists || aabb) {
     act.xe4_27_notInSortedLists = false;
@@ -2639,7 +3388,7 @@ std::optional<zeus::CAABox> CStateManager::CalculateObjectBounds(const CActor& a
 
 void CStateManager::AddObject(CEntity& ent) {
   if (ent.GetEditorId() != kInvalidEditorId) {
-    x890_scriptIdMap.insert(std::make_pair(ent.GetEditorId(), ent.GetUniqueId()));
+    x890_scriptIdMap.Insert(ent);
   }
   for (auto& list : x808_objLists) {
     list->AddObject(ent);
@@ -2659,7 +3408,10 @@ void CStateManager::AddObject(CEntity& ent) {
     UpdateActorInSortedLists(*act.GetPtr());
   }
 
-  ent.AcceptScriptMsg(EScriptObjectMessage::Registered, kInvalidUniqueId, *this);
+  {
+    CEntityProfiler::CScope scope(&m_entityProfiler, ent, EEntityProfileEvent::AcceptScriptMsg);
+    ent.AcceptScriptMsg(EScriptObjectMessage::Registered, kInvalidUniqueId, *this);
+  }
 
   if (ent.GetAreaIdAlways() != kInvalidAreaId && x850_world) {
     CGameArea* area = x850_world->GetArea(ent.GetAreaIdAlways());
@@ -2702,6 +3454,16 @@ zeus::CVector3f CStateManager::Random2f(float scaleMin, float scaleMax) {
 }
 
 void CStateManager::UpdateObjectInLists(CEntity& ent) {
+  // A parallel phase changes list membership when its issuer replays, so lists keep the order a serial pass gives them
+  if (tl_thinkBatch != nullptr) {
+    tl_thinkBatch->x8_cmds.push_back({tl_thinkBatch->x0_issuer, [id = ent.GetUniqueId()](CStateManager& mgr) {
+                                        if (CEntity* listed = mgr.GetAllObjectList().GetValidObjectById(id)) {
+                                          mgr.UpdateObjectInLists(*listed);
+                                        }
+                                      }});
+    return;
+  }
+
   for (auto& list : x808_objLists) {
     if (list->GetValidObjectById(ent.GetUniqueId())) {
       if (!list->IsQualified(ent)) {
@@ -2714,18 +3476,42 @@ void CStateManager::UpdateObjectInLists(CEntity& ent) {
   }
 }
 
+void CStateManager::QueueSpawn(std::function<void(CStateManager&)>&& spawn) {
+  if (tl_thinkBatch != nullptr) {
+    tl_thinkBatch->x8_cmds.push_back({tl_thinkBatch->x0_issuer, std::move(spawn)});
+    return;
+  }
+  spawn(*this);
+}
+
 TUniqueId CStateManager::AllocateUniqueId() {
+  if (tl_thinkBatch != nullptr) {
+    LogModule.report(logvisor::Fatal,
+                     FMT_STRING("AllocateUniqueId called from a parallel think batch; spawn through QueueSpawn"));
+  }
+
+  // Metaforce addition: cycle through the retail 1024 indices, or every index handed out so far if more, and only
+  // reach past them once all are live, so tables indexed by id value stay sized to what the content needs
+  const s16 window = s16(std::max<size_t>(x4_idxArr.size(), 1024));
   const s16 lastIndex = x0_nextFreeIndex;
   s16 ourIndex;
   do {
     ourIndex = x0_nextFreeIndex;
-    x0_nextFreeIndex = (ourIndex + 1) & 0x3ff;
-    if (x0_nextFreeIndex == lastIndex) {
-      LogModule.report(logvisor::Fatal, FMT_STRING("Object list full!"));
+    x0_nextFreeIndex = (ourIndex + 1) % window;
+    if (x0_nextFreeIndex == lastIndex && GetAllObjectList().GetObjectByIndex(ourIndex) != nullptr) {
+      if (window == kMaxEntities) {
+        LogModule.report(logvisor::Fatal, FMT_STRING("Object list full!"));
+      }
+      ourIndex = window;
+      x0_nextFreeIndex = 0;
+      break;
     }
   } while (GetAllObjectList().GetObjectByIndex(ourIndex) != nullptr);
 
-  x4_idxArr[ourIndex] = (x4_idxArr[ourIndex] + 1) & 0x3f;
+  if (size_t(ourIndex) >= x4_idxArr.size()) {
+    x4_idxArr.resize(ourIndex + 1);
+  }
+  x4_idxArr[ourIndex] = (x4_idxArr[ourIndex] + 1) & kUniqueIdVersionMask;
   if (TUniqueId(ourIndex, x4_idxArr[ourIndex]) == kInvalidUniqueId) {
     x4_idxArr[ourIndex] = 0;
   }
@@ -1,16 +1,26 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <functional>
 #include <list>
 #include <map>
 #include <memory>
 #include <optional>
 #include <set>
+#include <shared_mutex>
+#include <span>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "Runtime/CBasics.hpp"
+#include "Runtime/CEntityProfiler.hpp"
 #include "Runtime/CRandom16.hpp"
+#include "Runtime/CScriptIdIndex.hpp"
 #include "Runtime/CSortedLists.hpp"
 #include "Runtime/CToken.hpp"
 #include "Runtime/rstl.hpp"
@@ -67,6 +77,23 @@ struct SScriptObjectStream {
   u32 x8_length;
 };
 
+/* Metaforce addition: script message counts for one frame */
+struct SScriptMsgStats {
+  /* Indexed by message + 1 so EScriptObjectMessage::None has a slot */
+  std::array<u32, size_t(EScriptObjectMessage::SuspendedMove) + 2> x0_perMessage{};
+  /* By sender ImGuiType; only filled while sender stats are requested */
+  std::unordered_map<std::string_view, u32> xc8_perSender;
+  u32 x100_total = 0;
+  /* Most deliveries nested inside one another, as in a relay -> trigger -> relay chain */
+  u32 x104_deepestChain = 0;
+
+  void Reset();
+};
+
+/* Metaforce addition: the parts of CStateManager::Update timed in GetUpdatePhaseTimes; Other is everything between */
+enum class EUpdatePhase { PreThink, MoveActors, Collision, CrossTouchActors, Think, Camera, World, Other, MAX };
+using UpdatePhaseTimes = std::array<std::chrono::nanoseconds, size_t(EUpdatePhase::MAX)>;
+
 struct SOnScreenTex {
   CAssetId x0_id;
   zeus::CVector2i x4_origin;
@@ -85,7 +112,8 @@ public:
 
 private:
   s16 x0_nextFreeIndex = 0;
-  std::array<u16, kMaxEntities> x4_idxArr{};
+  // Metaforce addition: grows to the highest index handed out rather than holding kMaxEntities versions
+  std::vector<u16> x4_idxArr;
 
   /*
   std::unique_ptr<CObjectList> x80c_allObjs;
@@ -135,8 +163,9 @@ private:
   CActorModelParticles* x884_actorModelParticles = nullptr;
   CRumbleManager* x88c_rumbleManager = nullptr;
 
-  std::multimap<TEditorId, TUniqueId> x890_scriptIdMap;
-  std::map<TEditorId, SScriptObjectStream> x8a4_loadedScriptObjects;
+  CScriptIdIndex x890_scriptIdMap;
+  // Metaforce addition: sorted by editor id; each area load appends its layers and merges them in once
+  std::vector<std::pair<TEditorId, SScriptObjectStream>> x8a4_loadedScriptObjects;
 
   std::shared_ptr<CPlayerState> x8b8_playerState;
   std::shared_ptr<CScriptMailbox> x8bc_mailbox;
@@ -208,10 +237,69 @@ private:
   bool xf94_30_fullThreat : 1 = false;
 
   bool m_warping = false;
-  std::map<TEditorId, std::set<SConnection>> m_incomingConnections;
+  // Metaforce addition: incoming connections sorted by target then source, m_incomingConns parallel to
+  // m_incomingTargets. LoadScriptObject collects into m_pendingIncoming until CommitIncomingConnections.
+  std::vector<TEditorId> m_incomingTargets;
+  std::vector<SConnection> m_incomingConns;
+  std::vector<std::pair<TEditorId, SConnection>> m_pendingIncoming;
+  void MergeLoadedScriptObjects(size_t firstBuild, std::vector<TEditorId>& idsOut, size_t firstId);
+  void CommitIncomingConnections();
+  void LinkIncomingConnections();
+  std::span<const SConnection> GetIncomingConnections(TEditorId target) const;
 
   bool m_logScripting = false;
   std::optional<CVarValueReference<bool>> m_logScriptingReference;
+
+  // Metaforce addition: run area-local entities' PreThink/Think in per-area batches on the shared worker pool. Each
+  // run of them between two other entities updates there, so the update order stays the serial one.
+  bool m_parallelThink = false;
+  std::optional<CVarValueReference<bool>> m_parallelThinkReference;
+  std::vector<CEntity*> m_areaLocalThink; // the current run
+  template <typename Fn>
+  void RunAreaLocalThink(EEntityProfileEvent event, Fn&& fn);
+  template <typename Commands>
+  void ApplyDeferredCommands(Commands& cmds);
+
+  // Metaforce addition: move physics actors whose reach does not overlap in islands on the shared worker pool. Only
+  // list updates leave an island, replayed at their issuer's place in list order, so the result matches a serial move.
+  bool m_parallelMove = false;
+  std::optional<CVarValueReference<bool>> m_parallelMoveReference;
+  std::vector<CPhysicsActor*> m_moveActors;
+  // Per unique id: the mover's index, or for a physics actor staying put the first mover that can reach it; else -1
+  std::vector<s32> m_moveOwners;
+  s32 GetMoveOwner(TUniqueId id) const { return id.Value() < m_moveOwners.size() ? m_moveOwners[id.Value()] : -1; }
+  // Actors that left their reach or their island during a parallel move, sorted; they move serially while they live
+  std::vector<TUniqueId> m_serialMovers;
+  bool IsSerialMover(TUniqueId id) const {
+    return std::binary_search(m_serialMovers.cbegin(), m_serialMovers.cend(), id);
+  }
+  void AddSerialMover(TUniqueId id);
+  void RunParallelMove(float dt);
+  zeus::CAABox CalculateMoveReach(CPhysicsActor& actor, float dt);
+
+  // Metaforce addition: guards the sorted and object lists while jobs of a parallel phase run; taken only by them
+  mutable std::shared_mutex m_parallelListMutex;
+
+  // Metaforce addition: per-frame script message counters for the Script Messages window
+  u32 m_scriptMsgNesting = 0;
+  SScriptMsgStats m_scriptMsgStats;
+  SScriptMsgStats m_scriptMsgStatsLast;
+  UpdatePhaseTimes m_phaseTimes{};
+  bool m_scriptMsgSenderStats = false;
+  void CountScriptMsg(TUniqueId src, EScriptObjectMessage msg);
+
+  // Metaforce addition: with stateManager.entityProfiler on, entity calls are timed per class
+  bool m_entityProfile = false;
+  std::optional<CVarValueReference<bool>> m_entityProfileReference;
+  CEntityProfiler m_entityProfiler;
+
+  // Metaforce addition: CrossTouchActors scratch, indexed by unique id value, grown to the highest actor's and
+  // refreshed every frame
+  std::vector<std::optional<zeus::CAABox>> m_touchBounds;
+  std::vector<CSortedListManager::OverlapPair> m_touchPairs;
+  // Metaforce addition: DrawWorld scratch, sized to the visible thermal actors rather than kMaxEntities
+  std::vector<CActor*> m_thermalActors;
+
   void UpdateThermalVisor();
   static void RendererDrawCallback(void*, void*, int);
 
@@ -274,9 +362,8 @@ public:
   std::pair<const SScriptObjectStream*, TEditorId> GetBuildForScript(TEditorId) const;
   TEditorId GetEditorIdForUniqueId(TUniqueId) const;
   TUniqueId GetIdForScript(TEditorId) const;
-  std::pair<std::multimap<TEditorId, TUniqueId>::const_iterator, std::multimap<TEditorId, TUniqueId>::const_iterator>
-      GetIdListForScript(TEditorId) const;
-  std::multimap<TEditorId, TUniqueId>::const_iterator GetIdListEnd() const { return x890_scriptIdMap.cend(); }
+  std::pair<CScriptIdIndex::const_iterator, CScriptIdIndex::const_iterator> GetIdListForScript(TEditorId) const;
+  CScriptIdIndex::const_iterator GetIdListEnd() const { return x890_scriptIdMap.end(); }
   void LoadScriptObjects(TAreaId, CInputStream& in, std::vector<TEditorId>& idsOut);
   void InitializeScriptObjects(const std::vector<TEditorId>& objIds);
   std::pair<TEditorId, TUniqueId> LoadScriptObject(TAreaId, EScriptObjectType, u32, CInputStream& in);
@@ -350,6 +437,9 @@ public:
                                       float length, const CMaterialFilter& filter, const EntityList& list) const;
   void UpdateObjectInLists(CEntity&);
   TUniqueId AllocateUniqueId();
+  /* Metaforce addition: runs spawn (which allocates ids and calls AddObject) right away, or, when called from an
+   * area-local batch of a parallel think phase, once the phase commits on the game thread */
+  void QueueSpawn(std::function<void(CStateManager&)>&& spawn);
   void DeferStateTransition(EStateManagerTransition t);
   EStateManagerTransition GetDeferredStateTransition() const { return xf90_deferredTransition; }
   bool CanShowMapScreen() const;
@@ -387,6 +477,9 @@ public:
   const CWorld* GetWorld() const { return x850_world.get(); }
   CScriptMailbox* GetMailbox() { return x8bc_mailbox.get(); }
   const CScriptMailbox* GetRelayTracker() const { return x8bc_mailbox.get(); }
+  const SScriptMsgStats& GetScriptMsgStats() const { return m_scriptMsgStatsLast; }
+  void SetScriptMsgSenderStats(bool enable) { m_scriptMsgSenderStats = enable; }
+  const CEntityProfiler& GetEntityProfiler() const { return m_entityProfiler; }
   CCameraManager* GetCameraManager() const { return x870_cameraManager; }
   CFluidPlaneManager* GetFluidPlaneManager() const { return x87c_fluidPlaneManager; }
   CActorModelParticles* GetActorModelParticles() const { return x884_actorModelParticles; }
@@ -438,6 +531,11 @@ public:
   void SetThermalColdScale2(float s) { xf28_thermColdScale2 = s; }
   float IntegrateVisorFog(float f) const;
   u32 GetUpdateFrameIndex() const { return x8d8_updateFrameIdx; }
+  // Metaforce addition: hooks for gameplay record/replay
+  s32 GetDefaultRandomSeed() const { return x8fc_random.GetSeed(); }
+  void SetReplaySeeds(u32 updateFrameIdx, s32 randomSeed);
+  u32 ComputeStateHash() const;
+  const UpdatePhaseTimes& GetUpdatePhaseTimes() const { return m_phaseTimes; }
   void SetCinematicPause(bool p) { xf94_29_cinematicPause = p; }
   void QueueMessage(u32 frameCount, CAssetId msg, float f1) {
     xf84_ = frameCount;
@@ -0,0 +1,147 @@
+#include "Runtime/CWorkerPool.hpp"
+
+#include <algorithm>
+#include <memory>
+
+#include <logvisor/logvisor.hpp>
+#include <optick.h>
+
+namespace metaforce {
+
+CWorkerPool::CWorkerPool(std::string_view name, u32 threadCount) : m_name(name) {
+#ifdef HAS_WORKER_THREADS
+  m_threads.reserve(threadCount);
+  for (u32 i = 0; i < threadCount; ++i) {
+    m_threads.emplace_back([this]() { WorkerProc(); });
+  }
+#endif
+}
+
+CWorkerPool::~CWorkerPool() {
+#ifdef HAS_WORKER_THREADS
+  {
+    std::unique_lock lk{m_mutex};
+    m_running = false;
+  }
+  m_cv.notify_all();
+  for (std::thread& thread : m_threads) {
+    if (thread.joinable()) {
+      thread.join();
+    }
+  }
+#endif
+}
+
+void CWorkerPool::WorkerProc() {
+#ifdef HAS_WORKER_THREADS
+  logvisor::RegisterThreadName(m_name.c_str());
+  OPTICK_THREAD(m_name.c_str());
+
+  std::unique_lock lk{m_mutex};
+  while (true) {
+    m_cv.wait(lk, [this]() { return !m_running || !m_jobs.empty(); });
+    if (m_jobs.empty()) {
+      // Only reachable once m_running has been cleared
+      break;
+    }
+    Job job = std::move(m_jobs.front());
+    m_jobs.pop_front();
+    lk.unlock();
+    job();
+    lk.lock();
+  }
+#endif
+}
+
+void CWorkerPool::Submit(Job&& job) {
+#ifdef HAS_WORKER_THREADS
+  if (!m_threads.empty()) {
+    {
+      std::unique_lock lk{m_mutex};
+      m_jobs.push_back(std::move(job));
+    }
+    m_cv.notify_one();
+    return;
+  }
+#endif
+  job();
+}
+
+bool CWorkerPool::TryRunJob() {
+#ifdef HAS_WORKER_THREADS
+  Job job;
+  {
+    std::unique_lock lk{m_mutex};
+    if (m_jobs.empty()) {
+      return false;
+    }
+    job = std::move(m_jobs.front());
+    m_jobs.pop_front();
+  }
+  job();
+  return true;
+#else
+  return false;
+#endif
+}
+
+u32 CWorkerPool::GetThreadCount() const {
+#ifdef HAS_WORKER_THREADS
+  return u32(m_threads.size());
+#else
+  return 0;
+#endif
+}
+
+u32 CWorkerPool::DefaultThreadCount() {
+#ifdef HAS_WORKER_THREADS
+  // Leave the game thread, the DVD thread and the audio pump some room
+  return std::clamp(std::thread::hardware_concurrency() / 2, 1u, 4u);
+#else
+  return 0;
+#endif
+}
+
+CWorkerPool* CWorkerPool::GetShared() {
+  static const std::unique_ptr<CWorkerPool> pool = []() -> std::unique_ptr<CWorkerPool> {
+    if (const u32 threadCount = DefaultThreadCount()) {
+      return std::make_unique<CWorkerPool>("Metaforce Jobs", threadCount);
+    }
+    return nullptr;
+  }();
+  return pool.get();
+}
+
+void CJobGroup::Submit(CWorkerPool::Job&& job) {
+  if (m_pool == nullptr || m_pool->GetThreadCount() == 0) {
+    job();
+    return;
+  }
+  {
+    std::unique_lock lk{m_mutex};
+    ++m_pending;
+  }
+  m_pool->Submit([this, job = std::move(job)]() {
+    job();
+    // Notify under the lock so the group cannot be destroyed between the decrement and the notify
+    std::unique_lock lk{m_mutex};
+    if (--m_pending == 0) {
+      m_cv.notify_all();
+    }
+  });
+}
+
+void CJobGroup::Wait() {
+  OPTICK_EVENT();
+  std::unique_lock lk{m_mutex};
+  while (m_pending != 0) {
+    lk.unlock();
+    const bool ranJob = m_pool != nullptr && m_pool->TryRunJob();
+    lk.lock();
+    if (!ranJob) {
+      m_cv.wait(lk, [this]() { return m_pending == 0; });
+    }
+  }
+}
+
+} // namespace metaforce
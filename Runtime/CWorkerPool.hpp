@@ -0,0 +1,74 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "Runtime/GCNTypes.hpp"
+
+#ifndef EMSCRIPTEN
+#define HAS_WORKER_THREADS
+#endif
+
+namespace metaforce {
+
+/* Small fixed-size thread pool for offloading self-contained work (decompression, parsing) from the game thread.
+ * Jobs must not touch game state; results are handed back through state owned by the submitter.
+ * Without thread support (or with a thread count of 0), jobs execute inline on Submit. */
+class CWorkerPool {
+public:
+  using Job = std::function<void()>;
+
+private:
+  std::string m_name;
+#ifdef HAS_WORKER_THREADS
+  std::vector<std::thread> m_threads;
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::deque<Job> m_jobs;
+  bool m_running = true;
+#endif
+
+  void WorkerProc();
+
+public:
+  CWorkerPool(std::string_view name, u32 threadCount);
+  ~CWorkerPool();
+  CWorkerPool(const CWorkerPool&) = delete;
+  CWorkerPool& operator=(const CWorkerPool&) = delete;
+
+  void Submit(Job&& job);
+  /* Runs one queued job on the calling thread, if there is one; lets a waiting thread help instead of idling */
+  bool TryRunJob();
+  u32 GetThreadCount() const;
+
+  static u32 DefaultThreadCount();
+  /* General-purpose pool for splitting game-thread work into parallel tasks; nullptr without thread support */
+  static CWorkerPool* GetShared();
+};
+
+/* Batch of jobs on a pool that the submitter can join. Without a pool, jobs execute inline on Submit. */
+class CJobGroup {
+  CWorkerPool* m_pool;
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  u32 m_pending = 0;
+
+public:
+  explicit CJobGroup(CWorkerPool* pool) : m_pool(pool) {}
+  ~CJobGroup() { Wait(); }
+  CJobGroup(const CJobGroup&) = delete;
+  CJobGroup& operator=(const CJobGroup&) = delete;
+
+  void Submit(CWorkerPool::Job&& job);
+  /* Blocks until every submitted job has finished, running queued pool jobs in the meantime */
+  void Wait();
+};
+
+} // namespace metaforce
@@ -4,6 +4,7 @@
 #include "Runtime/Collision/CMaterialFilter.hpp"
 #include "Runtime/Streams/IOStreams.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cfloat>
 #include <cmath>
@@ -87,6 +88,111 @@ constexpr std::array<std::pair<int, std::array<int, 3>>, 16> SubdivIndex{{
     {3, {1, 2, 0}},
 }};
 
+namespace {
+using PacketLanes = std::array<float, CAreaOctTree::kRayPacketSize>;
+
+// A ray packet in struct-of-arrays form, so the per-lane loops below compile to vector code
+struct SRayPacketLanes {
+  std::array<PacketLanes, 3> origin{};
+  std::array<PacketLanes, 3> dir{};
+  std::array<PacketLanes, 3> dirRecip{};
+  // Hits are accepted from low up to, but excluding, best; empty for lanes without a ray
+  PacketLanes low{};
+  PacketLanes best{};
+  u32 activeMask = 0;
+};
+
+// Lanes whose remaining span meets aabb. Conservative, the triangle tests decide the actual hits.
+u32 PacketBoxMask(const zeus::CAABox& aabb, const SRayPacketLanes& packet) {
+  const zeus::simd_floats aabbMin(aabb.min.mSimd);
+  const zeus::simd_floats aabbMax(aabb.max.mSimd);
+  PacketLanes lo = packet.low;
+  PacketLanes hi = packet.best;
+  for (size_t a = 0; a < 3; ++a) {
+    // Grown a little so rays grazing a face still reach the triangles lying on it
+    const float boxMin = aabbMin[a] - 0.001f;
+    const float boxMax = aabbMax[a] + 0.001f;
+    for (size_t l = 0; l < CAreaOctTree::kRayPacketSize; ++l) {
+      const float t0 = (boxMin - packet.origin[a][l]) * packet.dirRecip[a][l];
+      const float t1 = (boxMax - packet.origin[a][l]) * packet.dirRecip[a][l];
+      lo[l] = std::max(lo[l], std::min(t0, t1));
+      hi[l] = std::min(hi[l], std::max(t0, t1));
+    }
+  }
+
+  u32 mask = 0;
+  for (size_t l = 0; l < CAreaOctTree::kRayPacketSize; ++l)
+    mask |= u32(lo[l] <= hi[l]) << l;
+  return mask & packet.activeMask;
+}
+
+void PacketTestLeaf(const CAreaOctTree::Node& node, const CMaterialFilter& filter, SRayPacketLanes& packet,
+                    CAreaOctTree::SRayResult* results) {
+  const CAreaOctTree::TriListReference triList = node.GetTriangleArray();
+  for (u16 i = 0; i < triList.GetSize(); ++i) {
+    const CCollisionSurface triangle = node.GetOwner().GetMasterListTriangle(triList.GetAt(i));
+    if (!filter.Passes(CMaterialList(triangle.GetSurfaceFlags())))
+      continue;
+
+    // Möller–Trumbore as in LineTestExInternal, with the vector math spelled out per lane
+    const zeus::simd_floats v0(triangle.GetVert(0).mSimd);
+    const zeus::simd_floats e0((triangle.GetVert(1) - triangle.GetVert(0)).mSimd);
+    const zeus::simd_floats e1((triangle.GetVert(2) - triangle.GetVert(0)).mSimd);
+    PacketLanes t;
+    u32 hitMask = 0;
+    for (size_t l = 0; l < CAreaOctTree::kRayPacketSize; ++l) {
+      const float dx = packet.dir[0][l];
+      const float dy = packet.dir[1][l];
+      const float dz = packet.dir[2][l];
+      const float px = dy * e1[2] - dz * e1[1];
+      const float py = dz * e1[0] - dx * e1[2];
+      const float pz = dx * e1[1] - dy * e1[0];
+      const float det = px * e0[0] + py * e0[1] + pz * e0[2];
+      const float invDet = 1.f / det;
+      const float tx = packet.origin[0][l] - v0[0];
+      const float ty = packet.origin[1][l] - v0[1];
+      const float tz = packet.origin[2][l] - v0[2];
+      const float u = invDet * (tx * px + ty * py + tz * pz);
+      const float qx = ty * e0[2] - tz * e0[1];
+      const float qy = tz * e0[0] - tx * e0[2];
+      const float qz = tx * e0[1] - ty * e0[0];
+      const float v = invDet * (qx * dx + qy * dy + qz * dz);
+      t[l] = invDet * (qx * e1[0] + qy * e1[1] + qz * e1[2]);
+      const bool hit = std::fabs(det) >= FLT_EPSILON * 10.f && u >= 0.f && u <= 1.f && v >= 0.f && u + v <= 1.f &&
+                       t[l] >= packet.low[l] && t[l] < packet.best[l];
+      hitMask |= u32(hit) << l;
+    }
+
+    hitMask &= packet.activeMask;
+    for (size_t l = 0; hitMask != 0; ++l, hitMask >>= 1) {
+      if ((hitMask & 1) == 0)
+        continue;
+      packet.best[l] = t[l];
+      results[l].x10_surface.emplace(triangle);
+      results[l].x3c_t = t[l];
+    }
+  }
+}
+
+// childOrder flips the child index bits of the axes the rays run down, so near children come first
+void PacketTestNode(const CAreaOctTree::Node& node, const CMaterialFilter& filter, SRayPacketLanes& packet,
+                    CAreaOctTree::SRayResult* results, int childOrder) {
+  if (node.GetTreeType() == CAreaOctTree::Node::ETreeType::Leaf) {
+    PacketTestLeaf(node, filter, packet, results);
+    return;
+  }
+
+  for (int i = 0; i < 8; ++i) {
+    const int idx = i ^ childOrder;
+    if (node.GetChildType(idx) == CAreaOctTree::Node::ETreeType::Invalid)
+      continue;
+    const CAreaOctTree::Node child = node.GetChild(idx);
+    if (PacketBoxMask(child.GetBoundingBox(), packet) != 0)
+      PacketTestNode(child, filter, packet, results, childOrder);
+  }
+}
+} // namespace
+
 bool CAreaOctTree::Node::LineTestInternal(const zeus::CLine& line, const CMaterialFilter& filter, float lT, float hT,
                                           float maxT, const zeus::CVector3f& vec) const {
   float lowT = (1.f - FLT_EPSILON * 100.f) * lT;
@@ -426,6 +532,54 @@ void CAreaOctTree::Node::LineTestEx(const zeus::CLine& line, const CMaterialFilt
   LineTestExInternal(line, filter, res, lT - 0.000099999997f, hT + 0.000099999997f, length, recip);
 }
 
+void CAreaOctTree::Node::LineTestExPacket(const SPacketRay* rays, size_t count, const CMaterialFilter& filter,
+                                          SRayResult* results) const {
+  SRayPacketLanes packet;
+  // Lanes without a ray keep an empty span
+  packet.low.fill(1.f);
+  packet.best.fill(0.f);
+  int childOrder = -1;
+  for (size_t l = 0; l < count; ++l) {
+    results[l] = SRayResult();
+    const zeus::CLine& line = rays[l].x0_line;
+    float lT = 0.f;
+    float hT = 0.f;
+    if (x20_nodeType == ETreeType::Invalid || !BoxLineTest(x0_aabb, line, lT, hT))
+      continue;
+
+    // The span LineTestEx hands the root, clamped the way LineTestExInternal does
+    float lowT = (1.f - FLT_EPSILON * 100.f) * (lT - 0.000099999997f);
+    float highT = (1.f + FLT_EPSILON * 100.f) * (hT + 0.000099999997f);
+    if (rays[l].x20_length != 0.f) {
+      lowT = std::max(lowT, 0.f);
+      highT = std::min(highT, rays[l].x20_length);
+      if (lowT > highT)
+        continue;
+    }
+
+    for (size_t a = 0; a < 3; ++a) {
+      const float d = line.dir[a];
+      packet.origin[a][l] = line.origin[a];
+      packet.dir[a][l] = d;
+      // Finite even for axis-parallel rays so the slab tests never produce NaN
+      packet.dirRecip[a][l] = std::fabs(d) > 1e-30f ? 1.f / d : 1e30f;
+    }
+    packet.low[l] = lowT;
+    packet.best[l] = highT;
+    packet.activeMask |= 1u << l;
+    if (childOrder == -1)
+      childOrder = (line.dir.x() < 0.f ? 1 : 0) | (line.dir.y() < 0.f ? 2 : 0) | (line.dir.z() < 0.f ? 4 : 0);
+  }
+
+  if (packet.activeMask == 0)
+    return;
+  PacketTestNode(*this, filter, packet, results, childOrder);
+  for (size_t l = 0; l < count; ++l) {
+    if (results[l].x10_surface)
+      results[l].x0_plane = results[l].x10_surface->GetPlane();
+  }
+}
+
 CAreaOctTree::Node CAreaOctTree::Node::GetChild(int idx) const {
   u16 flags = *reinterpret_cast<const u16*>(x18_ptr);
   const u32* offsets = reinterpret_cast<const u32*>(x18_ptr + 4);
@@ -589,6 +743,9 @@ std::unique_ptr<CAreaOctTree> CAreaOctTree::MakeFromMemory(const u8* buf, unsign
 }
 
 CCollisionSurface CAreaOctTree::GetMasterListTriangle(u16 idx) const {
+  if (!m_triangleCache.empty())
+    return m_triangleCache[idx].x0_surface;
+
   const CCollisionEdge& e0 = x3c_edges[x44_polyEdges[idx * 3]];
   const CCollisionEdge& e1 = x3c_edges[x44_polyEdges[idx * 3 + 1]];
   u16 vert2 = e1.GetVertIndex2();
@@ -604,6 +761,14 @@ CCollisionSurface CAreaOctTree::GetMasterListTriangle(u16 idx) const {
 }
 
 void CAreaOctTree::GetTriangleVertexIndices(u16 idx, u16 indicesOut[3]) const {
+  if (!m_triangleCache.empty()) {
+    const std::array<u16, 3>& indices = m_triangleCache[idx].x70_vertIndices;
+    indicesOut[0] = indices[0];
+    indicesOut[1] = indices[1];
+    indicesOut[2] = indices[2];
+    return;
+  }
+
   const CCollisionEdge& e0 = x3c_edges[x44_polyEdges[idx * 3]];
   const CCollisionEdge& e1 = x3c_edges[x44_polyEdges[idx * 3 + 1]];
   indicesOut[2] = (e1.GetVertIndex1() != e0.GetVertIndex1() && e1.GetVertIndex1() != e0.GetVertIndex2())
@@ -620,4 +785,21 @@ void CAreaOctTree::GetTriangleVertexIndices(u16 idx, u16 indicesOut[3]) const {
   }
 }
 
+void CAreaOctTree::BuildTriangleCache() {
+  // x40_polyCount counts the triangles' edge indices, three per triangle
+  std::vector<SCachedTriangle> cache;
+  cache.reserve(x40_polyCount / 3);
+  for (u32 i = 0; i < x40_polyCount / 3; ++i) {
+    CCollisionSurface surf = GetMasterListTriangle(u16(i));
+    zeus::CAABox aabb;
+    aabb.accumulateBounds(surf.GetVert(0));
+    aabb.accumulateBounds(surf.GetVert(1));
+    aabb.accumulateBounds(surf.GetVert(2));
+    std::array<u16, 3> vertIndices;
+    GetTriangleVertexIndices(u16(i), vertIndices.data());
+    cache.push_back({surf, surf.GetPlane(), aabb, vertIndices});
+  }
+  m_triangleCache = std::move(cache);
+}
+
 } // namespace metaforce
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <array>
 #include <optional>
+#include <vector>
 
 #include "Runtime/RetroTypes.hpp"
 #include "Runtime/Collision/CCollisionEdge.hpp"
@@ -23,6 +25,13 @@ public:
     float x3c_t;
   };
 
+  /* Metaforce addition: one ray of a Node::LineTestExPacket query; a length of 0 is unbounded as in LineTestEx */
+  struct SPacketRay {
+    zeus::CLine x0_line;
+    float x20_length;
+  };
+  static constexpr size_t kRayPacketSize = 4;
+
   class TriListReference {
     const u16* m_ptr;
 
@@ -53,6 +62,12 @@ public:
 
     bool LineTest(const zeus::CLine& line, const CMaterialFilter& filter, float length) const;
     void LineTestEx(const zeus::CLine& line, const CMaterialFilter& filter, SRayResult& res, float length) const;
+    /* Metaforce addition: LineTestEx for up to kRayPacketSize rays at once. The rays walk the tree together, each
+     * node is culled against all of them with one lane per ray and every leaf triangle is decoded once for the
+     * packet. results[i] is the nearest hit of rays[i], as LineTestEx finds it up to float rounding. Any rays are
+     * accepted, but only rays heading the same way share enough nodes to beat separate LineTestEx calls. */
+    void LineTestExPacket(const SPacketRay* rays, size_t count, const CMaterialFilter& filter,
+                          SRayResult* results) const;
 
     const CAreaOctTree& GetOwner() const { return x1c_owner; }
 
@@ -88,6 +103,15 @@ public:
   u32 x48_vertCount;
   const float* x4c_verts;
 
+  /* Metaforce addition: triangles decoded once by BuildTriangleCache, indexed like the master list */
+  struct SCachedTriangle {
+    CCollisionSurface x0_surface;
+    zeus::CPlane x40_plane;
+    zeus::CAABox x50_aabb;
+    std::array<u16, 3> x70_vertIndices;
+  };
+  std::vector<SCachedTriangle> m_triangleCache;
+
   void SwapTreeNode(u8* ptr, Node::ETreeType type);
 
 public:
@@ -111,6 +135,13 @@ public:
   u32 GetNumTriangles() const { return x40_polyCount; }
   CCollisionSurface GetMasterListTriangle(u16 idx) const;
   void GetTriangleVertexIndices(u16 idx, u16 indicesOut[3]) const;
+  /* Metaforce addition: decodes every triangle's vertices, winding, plane and bounds up front so the colliders can
+   * skip the edge list. Costs 128 bytes per triangle; GetCachedTriangle returns null until it has run. */
+  void BuildTriangleCache();
+  const SCachedTriangle* GetCachedTriangle(u16 idx) const {
+    return m_triangleCache.empty() ? nullptr : &m_triangleCache[idx];
+  }
+  size_t GetTriangleCacheSize() const { return m_triangleCache.size() * sizeof(SCachedTriangle); }
   const u16* GetTriangleEdgeIndices(u16 idx) const { return &x44_polyEdges[idx * 3]; }
 
   static std::unique_ptr<CAreaOctTree> MakeFromMemory(const u8* buf, unsigned int size);
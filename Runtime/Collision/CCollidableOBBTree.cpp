@@ -1,6 +1,8 @@
 #include "Runtime/Collision/CCollidableOBBTree.hpp"
 
 #include <array>
+#include <utility>
+#include <vector>
 
 #include "Runtime/Collision/CCollisionInfoList.hpp"
 #include "Runtime/Collision/CInternalRayCastStructure.hpp"
@@ -8,15 +10,65 @@
 #include "Runtime/Collision/CollisionUtil.hpp"
 
 namespace metaforce {
+namespace {
+/* Pending nodes of an iterative tree walk. Sized from the tree depth up front, so only trees deeper than the inline
+ * storage touch the heap. */
+template <typename T>
+class TNodeStack {
+  std::array<T, 32> m_inline;
+  std::vector<T> m_heap;
+  T* m_data = m_inline.data();
+  size_t m_size = 0;
+
+public:
+  explicit TNodeStack(size_t capacity) {
+    if (capacity > m_inline.size()) {
+      m_heap.resize(capacity);
+      m_data = m_heap.data();
+    }
+  }
+  bool Empty() const { return m_size == 0; }
+  void Push(const T& value) { m_data[m_size++] = value; }
+  T Pop() { return m_data[--m_size]; }
+};
+} // Anonymous namespace
 
 CCollidableOBBTree::CCollidableOBBTree(const COBBTree* tree, const metaforce::CMaterialList& material)
 : CCollisionPrimitive(material), x10_tree(tree) {}
 
-bool CCollidableOBBTree::LineIntersectsLeaf(const COBBTree::CLeafData& leaf, CRayCastInfo& info) const {
+template <bool StopOnHit, typename VisitLeaf>
+bool CCollidableOBBTree::WalkTree(const COBBTree::CNode& root, const zeus::COBBox& obb, VisitLeaf&& visitLeaf) const {
+  auto& self = const_cast<CCollidableOBBTree&>(*this);
+  bool ret = false;
+  TNodeStack<const COBBTree::CNode*> stack(x10_tree->GetDepth());
+  const COBBTree::CNode* node = &root;
+  while (node != nullptr) {
+    self.x14_tries += 1;
+    if (obb.OBBIntersectsBox(node->GetOBB())) {
+      if (!node->IsLeaf()) {
+        stack.Push(&node->GetRight());
+        node = &node->GetLeft();
+        continue;
+      }
+      if (visitLeaf(*node)) {
+        if constexpr (StopOnHit) {
+          return true;
+        }
+        ret = true;
+      }
+    } else {
+      self.x18_misses += 1;
+    }
+    node = stack.Empty() ? nullptr : stack.Pop();
+  }
+
+  return ret;
+}
+
+bool CCollidableOBBTree::LineIntersectsLeaf(const COBBTree::CNode& leaf, CRayCastInfo& info) const {
   bool ret = false;
   u16 intersectIdx = 0;
-  for (size_t i = 0; i < leaf.GetSurfaceVector().size(); ++i) {
-    u16 surfIdx = leaf.GetSurfaceVector()[i];
+  for (u16 surfIdx : x10_tree->GetLeafSurfaces(leaf)) {
     CCollisionSurface surface = x10_tree->GetSurface(surfIdx);
     CMaterialList matList = GetMaterial();
     matList.Add(surface.GetSurfaceFlags());
@@ -38,73 +90,48 @@ bool CCollidableOBBTree::LineIntersectsLeaf(const COBBTree::CLeafData& leaf, CRa
   return ret;
 }
 
-bool CCollidableOBBTree::LineIntersectsOBBTree(const COBBTree::CNode& n0, const COBBTree::CNode& n1,
-                                               CRayCastInfo& info) const {
+bool CCollidableOBBTree::LineIntersectsOBBTree(const COBBTree::CNode& root, CRayCastInfo& info) const {
+  auto& self = const_cast<CCollidableOBBTree&>(*this);
+  float t;
+  if (!CollisionUtil::LineIntersectsOBBox(root.GetOBB(), info.GetRay(), t) || t >= info.GetMagnitude()) {
+    self.x18_misses += 1;
+    return false;
+  }
+
+  // Nearer child first, boxes entered beyond the closest hit so far are dropped when popped
   bool ret = false;
-  float t0, t1;
-  bool intersects0 = false;
-  bool intersects1 = false;
-  if (CollisionUtil::LineIntersectsOBBox(n0.GetOBB(), info.GetRay(), t0) && t0 < info.GetMagnitude())
-    intersects0 = true;
-  if (CollisionUtil::LineIntersectsOBBox(n1.GetOBB(), info.GetRay(), t1) && t1 < info.GetMagnitude())
-    intersects1 = true;
-
-  if (intersects0 && intersects1) {
-    if (t0 < t1) {
-      if (n0.IsLeaf() ? LineIntersectsLeaf(n0.GetLeafData(), info)
-                      : LineIntersectsOBBTree(n0.GetLeft(), n0.GetRight(), info)) {
-        if (info.GetMagnitude() < t1)
-          return true;
-        ret = true;
-      }
-      if (n1.IsLeaf()) {
-        if (LineIntersectsLeaf(n1.GetLeafData(), info))
-          return true;
-      } else {
-        if (LineIntersectsOBBTree(n1.GetLeft(), n1.GetRight(), info))
-          return true;
-      }
-    } else {
-      if (n1.IsLeaf() ? LineIntersectsLeaf(n1.GetLeafData(), info)
-                      : LineIntersectsOBBTree(n1.GetLeft(), n1.GetRight(), info)) {
-        if (info.GetMagnitude() < t0)
-          return true;
+  TNodeStack<std::pair<const COBBTree::CNode*, float>> stack(x10_tree->GetDepth() + 1);
+  stack.Push({&root, t});
+  while (!stack.Empty()) {
+    const auto [node, tEnter] = stack.Pop();
+    if (tEnter >= info.GetMagnitude()) {
+      continue;
+    }
+    if (node->IsLeaf()) {
+      if (LineIntersectsLeaf(*node, info)) {
         ret = true;
       }
-      if (n0.IsLeaf()) {
-        if (LineIntersectsLeaf(n0.GetLeafData(), info))
-          return true;
-      } else {
-        if (LineIntersectsOBBTree(n0.GetLeft(), n0.GetRight(), info))
-          return true;
-      }
+      continue;
     }
-  } else if (intersects0) {
-    return n0.IsLeaf() ? LineIntersectsLeaf(n0.GetLeafData(), info)
-                       : LineIntersectsOBBTree(n0.GetLeft(), n0.GetRight(), info);
-  } else if (intersects1) {
-    return n1.IsLeaf() ? LineIntersectsLeaf(n1.GetLeafData(), info)
-                       : LineIntersectsOBBTree(n1.GetLeft(), n1.GetRight(), info);
-  }
-
-  return ret;
-}
-
-bool CCollidableOBBTree::LineIntersectsOBBTree(const COBBTree::CNode& node, CRayCastInfo& info) const {
-  float t;
-  bool ret = false;
 
-  if (CollisionUtil::LineIntersectsOBBox(node.GetOBB(), info.GetRay(), t) && t < info.GetMagnitude()) {
-    if (node.IsLeaf()) {
-      if (LineIntersectsLeaf(node.GetLeafData(), info))
-        ret = true;
-    } else {
-      if (LineIntersectsOBBTree(node.GetLeft(), node.GetRight(), info))
-        ret = true;
+    std::array<std::pair<const COBBTree::CNode*, float>, 2> children{
+        {{&node->GetLeft(), 0.f}, {&node->GetRight(), 0.f}}};
+    std::array<bool, 2> intersects{};
+    for (size_t i = 0; i < children.size(); ++i) {
+      auto& [child, tChild] = children[i];
+      intersects[i] = CollisionUtil::LineIntersectsOBBox(child->GetOBB(), info.GetRay(), tChild) &&
+                      tChild < info.GetMagnitude();
+      if (!intersects[i]) {
+        self.x18_misses += 1;
+      }
+    }
+    const size_t nearIdx = intersects[1] && (!intersects[0] || children[1].second < children[0].second) ? 1 : 0;
+    if (intersects[nearIdx ^ 1]) {
+      stack.Push(children[nearIdx ^ 1]);
+    }
+    if (intersects[nearIdx]) {
+      stack.Push(children[nearIdx]);
     }
-    const_cast<COBBTree::CNode&>(node).SetHit(true);
-  } else {
-    const_cast<CCollidableOBBTree&>(*this).x18_misses += 1;
   }
 
   return ret;
@@ -127,10 +154,12 @@ zeus::CPlane CCollidableOBBTree::TransformPlane(const zeus::CPlane& pl, const ze
   return zeus::CPlane(normal, (xf * (pl.normal() * pl.d())).dot(normal));
 }
 
-bool CCollidableOBBTree::SphereCollideWithLeafMoving(const COBBTree::CLeafData& leaf, const zeus::CTransform& xf,
+bool CCollidableOBBTree::SphereCollideWithLeafMoving(const COBBTree::CNode& leaf, const zeus::CTransform& xf,
                                                      const zeus::CSphere& sphere, const CMaterialList& matList,
                                                      const CMaterialFilter& filter, const zeus::CVector3f& dir,
                                                      double& dOut, CCollisionInfo& infoOut) const {
+  // Shares the duplicate lists with the area queries, CCollidableOBBTreeGroup resets them per tree
+  CAreaColliderContext& ctx = CMetroidAreaCollider::GetDefaultContext();
   bool ret = false;
 
   zeus::CAABox aabb(sphere.position - sphere.radius, sphere.position + sphere.radius);
@@ -142,7 +171,7 @@ bool CCollidableOBBTree::SphereCollideWithLeafMoving(const COBBTree::CLeafData&
   zeus::CVector3f center = moveAABB.center();
   zeus::CVector3f extent = moveAABB.extents();
 
-  for (u16 triIdx : leaf.GetSurfaceVector()) {
+  for (u16 triIdx : x10_tree->GetLeafSurfaces(leaf)) {
     CCollisionSurface surf = x10_tree->GetTransformedSurface(triIdx, xf);
     CMaterialList triMat = GetMaterial();
     triMat.Add(CMaterialList(surf.GetSurfaceFlags()));
@@ -173,8 +202,8 @@ bool CCollidableOBBTree::SphereCollideWithLeafMoving(const COBBTree::CLeafData&
           for (int k = 0; k < 3; ++k) {
             if (intersects || outsideEdges[k]) {
               u16 edgeIdx = edgeIndices[k];
-              if (CMetroidAreaCollider::g_DupPrimitiveCheckCount != CMetroidAreaCollider::g_DupEdgeList[edgeIdx]) {
-                CMetroidAreaCollider::g_DupEdgeList[edgeIdx] = CMetroidAreaCollider::g_DupPrimitiveCheckCount;
+              if (ctx.m_dupPrimitiveCheckCount != ctx.m_dupEdgeList[edgeIdx]) {
+                ctx.m_dupEdgeList[edgeIdx] = ctx.m_dupPrimitiveCheckCount;
                 CMaterialList edgeMat(x10_tree->GetEdgeMaterial(edgeIdx));
                 if (!edgeMat.HasMaterial(EMaterialTypes::NoEdgeCollision)) {
                   int nextIdx = (k + 1) % 3;
@@ -223,8 +252,8 @@ bool CCollidableOBBTree::SphereCollideWithLeafMoving(const COBBTree::CLeafData&
           for (int k = 0; k < 3; ++k) {
             const u16 vertIdx = vertIndices[k];
             if (testVert[k]) {
-              if (CMetroidAreaCollider::g_DupPrimitiveCheckCount != CMetroidAreaCollider::g_DupVertexList[vertIdx]) {
-                CMetroidAreaCollider::g_DupVertexList[vertIdx] = CMetroidAreaCollider::g_DupPrimitiveCheckCount;
+              if (ctx.m_dupPrimitiveCheckCount != ctx.m_dupVertexList[vertIdx]) {
+                ctx.m_dupVertexList[vertIdx] = ctx.m_dupPrimitiveCheckCount;
                 double d = dOut;
                 if (CollisionUtil::RaySphereIntersection_Double(zeus::CSphere(surf.GetVert(k), sphere.radius),
                                                                 sphere.position, dir, d) &&
@@ -236,20 +265,20 @@ bool CCollidableOBBTree::SphereCollideWithLeafMoving(const COBBTree::CLeafData&
                 }
               }
             } else {
-              CMetroidAreaCollider::g_DupVertexList[vertIdx] = CMetroidAreaCollider::g_DupPrimitiveCheckCount;
+              ctx.m_dupVertexList[vertIdx] = ctx.m_dupPrimitiveCheckCount;
             }
           }
         }
       } else {
         const u16* edgeIndices = x10_tree->GetTriangleEdgeIndices(triIdx);
-        CMetroidAreaCollider::g_DupEdgeList[edgeIndices[0]] = CMetroidAreaCollider::g_DupPrimitiveCheckCount;
-        CMetroidAreaCollider::g_DupEdgeList[edgeIndices[1]] = CMetroidAreaCollider::g_DupPrimitiveCheckCount;
-        CMetroidAreaCollider::g_DupEdgeList[edgeIndices[2]] = CMetroidAreaCollider::g_DupPrimitiveCheckCount;
+        ctx.m_dupEdgeList[edgeIndices[0]] = ctx.m_dupPrimitiveCheckCount;
+        ctx.m_dupEdgeList[edgeIndices[1]] = ctx.m_dupPrimitiveCheckCount;
+        ctx.m_dupEdgeList[edgeIndices[2]] = ctx.m_dupPrimitiveCheckCount;
 
         const auto vertIndices = x10_tree->GetTriangleVertexIndices(triIdx);
-        CMetroidAreaCollider::g_DupVertexList[vertIndices[0]] = CMetroidAreaCollider::g_DupPrimitiveCheckCount;
-        CMetroidAreaCollider::g_DupVertexList[vertIndices[1]] = CMetroidAreaCollider::g_DupPrimitiveCheckCount;
-        CMetroidAreaCollider::g_DupVertexList[vertIndices[2]] = CMetroidAreaCollider::g_DupPrimitiveCheckCount;
+        ctx.m_dupVertexList[vertIndices[0]] = ctx.m_dupPrimitiveCheckCount;
+        ctx.m_dupVertexList[vertIndices[1]] = ctx.m_dupPrimitiveCheckCount;
+        ctx.m_dupVertexList[vertIndices[2]] = ctx.m_dupPrimitiveCheckCount;
       }
     }
   }
@@ -261,33 +290,18 @@ bool CCollidableOBBTree::SphereCollisionMoving(const COBBTree::CNode& node, cons
                                                const zeus::CSphere& sphere, const zeus::COBBox& obb,
                                                const CMaterialList& material, const CMaterialFilter& filter,
                                                const zeus::CVector3f& dir, double& dOut, CCollisionInfo& info) const {
-  bool ret = false;
-
-  const_cast<CCollidableOBBTree&>(*this).x14_tries += 1;
-  if (obb.OBBIntersectsBox(node.GetOBB())) {
-    const_cast<COBBTree::CNode&>(node).SetHit(true);
-    if (node.IsLeaf()) {
-      if (SphereCollideWithLeafMoving(node.GetLeafData(), xf, sphere, material, filter, dir, dOut, info))
-        ret = true;
-    } else {
-      if (SphereCollisionMoving(node.GetLeft(), xf, sphere, obb, material, filter, dir, dOut, info))
-        ret = true;
-      if (SphereCollisionMoving(node.GetRight(), xf, sphere, obb, material, filter, dir, dOut, info))
-        ret = true;
-    }
-  } else {
-    const_cast<CCollidableOBBTree&>(*this).x18_misses += 1;
-  }
-
-  return ret;
+  return WalkTree<false>(node, obb, [&](const COBBTree::CNode& leaf) {
+    return SphereCollideWithLeafMoving(leaf, xf, sphere, material, filter, dir, dOut, info);
+  });
 }
 
-bool CCollidableOBBTree::AABoxCollideWithLeafMoving(const COBBTree::CLeafData& leaf, const zeus::CTransform& xf,
+bool CCollidableOBBTree::AABoxCollideWithLeafMoving(const COBBTree::CNode& leaf, const zeus::CTransform& xf,
                                                     const zeus::CAABox& aabb, const CMaterialList& matList,
                                                     const CMaterialFilter& filter,
                                                     const CMovingAABoxComponents& components,
                                                     const zeus::CVector3f& dir, double& dOut,
                                                     CCollisionInfo& infoOut) const {
+  CAreaColliderContext& ctx = CMetroidAreaCollider::GetDefaultContext();
   bool ret = false;
 
   zeus::CAABox movedAABB = components.x6e8_aabb;
@@ -300,7 +314,7 @@ bool CCollidableOBBTree::AABoxCollideWithLeafMoving(const COBBTree::CLeafData& l
 
   zeus::CVector3f normal, point;
 
-  for (u16 triIdx : leaf.GetSurfaceVector()) {
+  for (u16 triIdx : x10_tree->GetLeafSurfaces(leaf)) {
     CCollisionSurface surf = x10_tree->GetTransformedSurface(triIdx, xf);
     CMaterialList triMat = GetMaterial();
     triMat.Add(CMaterialList(surf.GetSurfaceFlags()));
@@ -322,8 +336,8 @@ bool CCollidableOBBTree::AABoxCollideWithLeafMoving(const COBBTree::CLeafData& l
         for (int k = 0; k < 3; ++k) {
           u16 vertIdx = vertIndices[k];
           const zeus::CVector3f& vtx = surf.GetVert(k);
-          if (CMetroidAreaCollider::g_DupPrimitiveCheckCount != CMetroidAreaCollider::g_DupVertexList[vertIdx]) {
-            CMetroidAreaCollider::g_DupVertexList[vertIdx] = CMetroidAreaCollider::g_DupPrimitiveCheckCount;
+          if (ctx.m_dupPrimitiveCheckCount != ctx.m_dupVertexList[vertIdx]) {
+            ctx.m_dupVertexList[vertIdx] = ctx.m_dupPrimitiveCheckCount;
             if (movedAABB.pointInside(vtx)) {
               d = dOut;
               if (CMetroidAreaCollider::MovingAABoxCollisionCheck_TriVertexBox(vtx, aabb, dir, d, normal, point) &&
@@ -340,8 +354,8 @@ bool CCollidableOBBTree::AABoxCollideWithLeafMoving(const COBBTree::CLeafData& l
         const u16* edgeIndices = x10_tree->GetTriangleEdgeIndices(triIdx);
         for (int k = 0; k < 3; ++k) {
           u16 edgeIdx = edgeIndices[k];
-          if (CMetroidAreaCollider::g_DupPrimitiveCheckCount != CMetroidAreaCollider::g_DupEdgeList[edgeIdx]) {
-            CMetroidAreaCollider::g_DupEdgeList[edgeIdx] = CMetroidAreaCollider::g_DupPrimitiveCheckCount;
+          if (ctx.m_dupPrimitiveCheckCount != ctx.m_dupEdgeList[edgeIdx]) {
+            ctx.m_dupEdgeList[edgeIdx] = ctx.m_dupPrimitiveCheckCount;
             CMaterialList edgeMat(x10_tree->GetEdgeMaterial(edgeIdx));
             if (!edgeMat.HasMaterial(EMaterialTypes::NoEdgeCollision)) {
               d = dOut;
@@ -357,14 +371,14 @@ bool CCollidableOBBTree::AABoxCollideWithLeafMoving(const COBBTree::CLeafData& l
         }
       } else {
         const u16* edgeIndices = x10_tree->GetTriangleEdgeIndices(triIdx);
-        CMetroidAreaCollider::g_DupEdgeList[edgeIndices[0]] = CMetroidAreaCollider::g_DupPrimitiveCheckCount;
-        CMetroidAreaCollider::g_DupEdgeList[edgeIndices[1]] = CMetroidAreaCollider::g_DupPrimitiveCheckCount;
-        CMetroidAreaCollider::g_DupEdgeList[edgeIndices[2]] = CMetroidAreaCollider::g_DupPrimitiveCheckCount;
+        ctx.m_dupEdgeList[edgeIndices[0]] = ctx.m_dupPrimitiveCheckCount;
+        ctx.m_dupEdgeList[edgeIndices[1]] = ctx.m_dupPrimitiveCheckCount;
+        ctx.m_dupEdgeList[edgeIndices[2]] = ctx.m_dupPrimitiveCheckCount;
 
         const auto vertIndices = x10_tree->GetTriangleVertexIndices(triIdx);
-        CMetroidAreaCollider::g_DupVertexList[vertIndices[0]] = CMetroidAreaCollider::g_DupPrimitiveCheckCount;
-        CMetroidAreaCollider::g_DupVertexList[vertIndices[1]] = CMetroidAreaCollider::g_DupPrimitiveCheckCount;
-        CMetroidAreaCollider::g_DupVertexList[vertIndices[2]] = CMetroidAreaCollider::g_DupPrimitiveCheckCount;
+        ctx.m_dupVertexList[vertIndices[0]] = ctx.m_dupPrimitiveCheckCount;
+        ctx.m_dupVertexList[vertIndices[1]] = ctx.m_dupPrimitiveCheckCount;
+        ctx.m_dupVertexList[vertIndices[2]] = ctx.m_dupPrimitiveCheckCount;
       }
     }
   }
@@ -377,53 +391,25 @@ bool CCollidableOBBTree::AABoxCollisionMoving(const COBBTree::CNode& node, const
                                               const CMaterialList& material, const CMaterialFilter& filter,
                                               const CMovingAABoxComponents& components, const zeus::CVector3f& dir,
                                               double& dOut, CCollisionInfo& info) const {
-  bool ret = false;
-
-  const_cast<CCollidableOBBTree&>(*this).x14_tries += 1;
-  if (obb.OBBIntersectsBox(node.GetOBB())) {
-    const_cast<COBBTree::CNode&>(node).SetHit(true);
-    if (node.IsLeaf()) {
-      if (AABoxCollideWithLeafMoving(node.GetLeafData(), xf, aabb, material, filter, components, dir, dOut, info))
-        ret = true;
-    } else {
-      if (AABoxCollisionMoving(node.GetLeft(), xf, aabb, obb, material, filter, components, dir, dOut, info))
-        ret = true;
-      if (AABoxCollisionMoving(node.GetRight(), xf, aabb, obb, material, filter, components, dir, dOut, info))
-        ret = true;
-    }
-  } else {
-    const_cast<CCollidableOBBTree&>(*this).x18_misses += 1;
-  }
-
-  return ret;
+  return WalkTree<false>(node, obb, [&](const COBBTree::CNode& leaf) {
+    return AABoxCollideWithLeafMoving(leaf, xf, aabb, material, filter, components, dir, dOut, info);
+  });
 }
 
 bool CCollidableOBBTree::SphereCollisionBoolean(const COBBTree::CNode& node, const zeus::CTransform& xf,
                                                 const zeus::CSphere& sphere, const zeus::COBBox& obb,
                                                 const CMaterialFilter& filter) const {
-  const_cast<CCollidableOBBTree&>(*this).x14_tries += 1;
-  if (obb.OBBIntersectsBox(node.GetOBB())) {
-    const_cast<COBBTree::CNode&>(node).SetHit(true);
-    if (node.IsLeaf()) {
-      for (u16 surfIdx : node.GetLeafData().GetSurfaceVector()) {
-        CCollisionSurface surf = x10_tree->GetTransformedSurface(surfIdx, xf);
-        CMaterialList triMat = GetMaterial();
-        triMat.Add(CMaterialList(surf.GetSurfaceFlags()));
-        if (filter.Passes(triMat) &&
-            CollisionUtil::TriSphereOverlap(sphere, surf.GetVert(0), surf.GetVert(1), surf.GetVert(2)))
-          return true;
-      }
-    } else {
-      if (SphereCollisionBoolean(node.GetLeft(), xf, sphere, obb, filter))
-        return true;
-      if (SphereCollisionBoolean(node.GetRight(), xf, sphere, obb, filter))
+  return WalkTree<true>(node, obb, [&](const COBBTree::CNode& leaf) {
+    for (u16 surfIdx : x10_tree->GetLeafSurfaces(leaf)) {
+      CCollisionSurface surf = x10_tree->GetTransformedSurface(surfIdx, xf);
+      CMaterialList triMat = GetMaterial();
+      triMat.Add(CMaterialList(surf.GetSurfaceFlags()));
+      if (filter.Passes(triMat) &&
+          CollisionUtil::TriSphereOverlap(sphere, surf.GetVert(0), surf.GetVert(1), surf.GetVert(2)))
         return true;
     }
-  } else {
-    const_cast<CCollidableOBBTree&>(*this).x18_misses += 1;
-  }
-
-  return false;
+    return false;
+  });
 }
 
 bool CCollidableOBBTree::AABoxCollisionBoolean(const COBBTree::CNode& node, const zeus::CTransform& xf,
@@ -432,38 +418,26 @@ bool CCollidableOBBTree::AABoxCollisionBoolean(const COBBTree::CNode& node, cons
   zeus::CVector3f center = aabb.center();
   zeus::CVector3f extent = aabb.extents();
 
-  const_cast<CCollidableOBBTree&>(*this).x14_tries += 1;
-  if (obb.OBBIntersectsBox(node.GetOBB())) {
-    const_cast<COBBTree::CNode&>(node).SetHit(true);
-    if (node.IsLeaf()) {
-      for (u16 surfIdx : node.GetLeafData().GetSurfaceVector()) {
-        CCollisionSurface surf = x10_tree->GetTransformedSurface(surfIdx, xf);
-        CMaterialList triMat = GetMaterial();
-        triMat.Add(CMaterialList(surf.GetSurfaceFlags()));
-        if (filter.Passes(triMat) &&
-            CollisionUtil::TriBoxOverlap(center, extent, surf.GetVert(0), surf.GetVert(1), surf.GetVert(2)))
-          return true;
-      }
-    } else {
-      if (AABoxCollisionBoolean(node.GetLeft(), xf, aabb, obb, filter))
-        return true;
-      if (AABoxCollisionBoolean(node.GetRight(), xf, aabb, obb, filter))
+  return WalkTree<true>(node, obb, [&](const COBBTree::CNode& leaf) {
+    for (u16 surfIdx : x10_tree->GetLeafSurfaces(leaf)) {
+      CCollisionSurface surf = x10_tree->GetTransformedSurface(surfIdx, xf);
+      CMaterialList triMat = GetMaterial();
+      triMat.Add(CMaterialList(surf.GetSurfaceFlags()));
+      if (filter.Passes(triMat) &&
+          CollisionUtil::TriBoxOverlap(center, extent, surf.GetVert(0), surf.GetVert(1), surf.GetVert(2)))
         return true;
     }
-  } else {
-    const_cast<CCollidableOBBTree&>(*this).x18_misses += 1;
-  }
-
-  return false;
+    return false;
+  });
 }
 
-bool CCollidableOBBTree::SphereCollideWithLeaf(const COBBTree::CLeafData& leaf, const zeus::CTransform& xf,
+bool CCollidableOBBTree::SphereCollideWithLeaf(const COBBTree::CNode& leaf, const zeus::CTransform& xf,
                                                const zeus::CSphere& sphere, const CMaterialList& material,
                                                const CMaterialFilter& filter, CCollisionInfoList& infoList) const {
   bool ret = false;
   zeus::CVector3f point, normal;
 
-  for (u16 surfIdx : leaf.GetSurfaceVector()) {
+  for (u16 surfIdx : x10_tree->GetLeafSurfaces(leaf)) {
     CCollisionSurface surf = x10_tree->GetTransformedSurface(surfIdx, xf);
     CMaterialList triMat = GetMaterial();
     triMat.Add(CMaterialList(surf.GetSurfaceFlags()));
@@ -485,28 +459,12 @@ bool CCollidableOBBTree::SphereCollision(const COBBTree::CNode& node, const zeus
                                          const zeus::CSphere& sphere, const zeus::COBBox& obb,
                                          const CMaterialList& material, const CMaterialFilter& filter,
                                          CCollisionInfoList& infoList) const {
-  bool ret = false;
-
-  const_cast<CCollidableOBBTree&>(*this).x14_tries += 1;
-  if (obb.OBBIntersectsBox(node.GetOBB())) {
-    const_cast<COBBTree::CNode&>(node).SetHit(true);
-    if (node.IsLeaf()) {
-      if (SphereCollideWithLeaf(node.GetLeafData(), xf, sphere, material, filter, infoList))
-        ret = true;
-    } else {
-      if (SphereCollision(node.GetLeft(), xf, sphere, obb, material, filter, infoList))
-        ret = true;
-      if (SphereCollision(node.GetRight(), xf, sphere, obb, material, filter, infoList))
-        ret = true;
-    }
-  } else {
-    const_cast<CCollidableOBBTree&>(*this).x18_misses += 1;
-  }
-
-  return ret;
+  return WalkTree<false>(node, obb, [&](const COBBTree::CNode& leaf) {
+    return SphereCollideWithLeaf(leaf, xf, sphere, material, filter, infoList);
+  });
 }
 
-bool CCollidableOBBTree::AABoxCollideWithLeaf(const COBBTree::CLeafData& leaf, const zeus::CTransform& xf,
+bool CCollidableOBBTree::AABoxCollideWithLeaf(const COBBTree::CNode& leaf, const zeus::CTransform& xf,
                                               const zeus::CAABox& aabb, const CMaterialList& material,
                                               const CMaterialFilter& filter, const std::array<zeus::CPlane, 6>& planes,
                                               CCollisionInfoList& infoList) const {
@@ -514,7 +472,7 @@ bool CCollidableOBBTree::AABoxCollideWithLeaf(const COBBTree::CLeafData& leaf, c
   zeus::CVector3f center = aabb.center();
   zeus::CVector3f extent = aabb.extents();
 
-  for (u16 surfIdx : leaf.GetSurfaceVector()) {
+  for (u16 surfIdx : x10_tree->GetLeafSurfaces(leaf)) {
     CCollisionSurface surf = x10_tree->GetTransformedSurface(surfIdx, xf);
     CMaterialList triMat = GetMaterial();
     triMat.Add(CMaterialList(surf.GetSurfaceFlags()));
@@ -538,25 +496,9 @@ bool CCollidableOBBTree::AABoxCollision(const COBBTree::CNode& node, const zeus:
                                         const zeus::CAABox& aabb, const zeus::COBBox& obb,
                                         const CMaterialList& material, const CMaterialFilter& filter,
                                         const std::array<zeus::CPlane, 6>& planes, CCollisionInfoList& infoList) const {
-  bool ret = false;
-
-  const_cast<CCollidableOBBTree&>(*this).x14_tries += 1;
-  if (obb.OBBIntersectsBox(node.GetOBB())) {
-    const_cast<COBBTree::CNode&>(node).SetHit(true);
-    if (node.IsLeaf()) {
-      if (AABoxCollideWithLeaf(node.GetLeafData(), xf, aabb, material, filter, planes, infoList))
-        ret = true;
-    } else {
-      if (AABoxCollision(node.GetLeft(), xf, aabb, obb, material, filter, planes, infoList))
-        ret = true;
-      if (AABoxCollision(node.GetRight(), xf, aabb, obb, material, filter, planes, infoList))
-        ret = true;
-    }
-  } else {
-    const_cast<CCollidableOBBTree&>(*this).x18_misses += 1;
-  }
-
-  return ret;
+  return WalkTree<false>(node, obb, [&](const COBBTree::CNode& leaf) {
+    return AABoxCollideWithLeaf(leaf, xf, aabb, material, filter, planes, infoList);
+  });
 }
 
 FourCC CCollidableOBBTree::GetPrimType() const { return SBIG('OBBT'); }
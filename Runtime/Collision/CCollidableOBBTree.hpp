@@ -36,20 +36,23 @@ class CCollidableOBBTree : public CCollisionPrimitive {
   u32 x18_misses = 0;
   u32 x1c_hits = 0;
   static inline u32 sTableIndex = 0;
-  bool LineIntersectsLeaf(const COBBTree::CLeafData& leaf, CRayCastInfo& info) const;
-  bool LineIntersectsOBBTree(const COBBTree::CNode& n0, const COBBTree::CNode& n1, CRayCastInfo& info) const;
+  /* Metaforce addition: iterative depth-first walk of the nodes whose OBB intersects obb, left child first, calling
+   * visitLeaf on each leaf reached. Returns whether any visit did; StopOnHit ends the walk at the first one. */
+  template <bool StopOnHit, typename VisitLeaf>
+  bool WalkTree(const COBBTree::CNode& root, const zeus::COBBox& obb, VisitLeaf&& visitLeaf) const;
+  bool LineIntersectsLeaf(const COBBTree::CNode& leaf, CRayCastInfo& info) const;
   bool LineIntersectsOBBTree(const COBBTree::CNode& node, CRayCastInfo& info) const;
   CRayCastResult LineIntersectsTree(const zeus::CMRay& ray, const CMaterialFilter& filter, float maxTime,
                                     const zeus::CTransform& xf) const;
   static zeus::CPlane TransformPlane(const zeus::CPlane& pl, const zeus::CTransform& xf);
-  bool SphereCollideWithLeafMoving(const COBBTree::CLeafData& leaf, const zeus::CTransform& xf,
+  bool SphereCollideWithLeafMoving(const COBBTree::CNode& leaf, const zeus::CTransform& xf,
                                    const zeus::CSphere& sphere, const CMaterialList& material,
                                    const CMaterialFilter& filter, const zeus::CVector3f& dir, double& dOut,
                                    CCollisionInfo& info) const;
   bool SphereCollisionMoving(const COBBTree::CNode& node, const zeus::CTransform& xf, const zeus::CSphere& sphere,
                              const zeus::COBBox& obb, const CMaterialList& material, const CMaterialFilter& filter,
                              const zeus::CVector3f& dir, double& dOut, CCollisionInfo& info) const;
-  bool AABoxCollideWithLeafMoving(const COBBTree::CLeafData& leaf, const zeus::CTransform& xf, const zeus::CAABox& aabb,
+  bool AABoxCollideWithLeafMoving(const COBBTree::CNode& leaf, const zeus::CTransform& xf, const zeus::CAABox& aabb,
                                   const CMaterialList& material, const CMaterialFilter& filter,
                                   const CMovingAABoxComponents& components, const zeus::CVector3f& dir, double& dOut,
                                   CCollisionInfo& info) const;
@@ -61,13 +64,13 @@ class CCollidableOBBTree : public CCollisionPrimitive {
                               const zeus::COBBox& obb, const CMaterialFilter& filter) const;
   bool AABoxCollisionBoolean(const COBBTree::CNode& node, const zeus::CTransform& xf, const zeus::CAABox& aabb,
                              const zeus::COBBox& obb, const CMaterialFilter& filter) const;
-  bool SphereCollideWithLeaf(const COBBTree::CLeafData& leaf, const zeus::CTransform& xf, const zeus::CSphere& sphere,
+  bool SphereCollideWithLeaf(const COBBTree::CNode& leaf, const zeus::CTransform& xf, const zeus::CSphere& sphere,
                              const CMaterialList& material, const CMaterialFilter& filter,
                              CCollisionInfoList& infoList) const;
   bool SphereCollision(const COBBTree::CNode& node, const zeus::CTransform& xf, const zeus::CSphere& sphere,
                        const zeus::COBBox& obb, const CMaterialList& material, const CMaterialFilter& filter,
                        CCollisionInfoList& infoList) const;
-  bool AABoxCollideWithLeaf(const COBBTree::CLeafData& leaf, const zeus::CTransform& xf, const zeus::CAABox& aabb,
+  bool AABoxCollideWithLeaf(const COBBTree::CNode& leaf, const zeus::CTransform& xf, const zeus::CAABox& aabb,
                             const CMaterialList& material, const CMaterialFilter& filter,
                             const std::array<zeus::CPlane, 6>& planes, CCollisionInfoList& infoList) const;
   bool AABoxCollision(const COBBTree::CNode& node, const zeus::CTransform& xf, const zeus::CAABox& aabb,
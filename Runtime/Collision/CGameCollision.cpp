@@ -1,5 +1,10 @@
 #include "Runtime/Collision/CGameCollision.hpp"
 
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <vector>
+
 #include "Runtime/CStateManager.hpp"
 #include "Runtime/Character/CGroundMovement.hpp"
 #include "Runtime/Collision/CAABoxFilter.hpp"
@@ -292,6 +297,61 @@ bool CGameCollision::RayStaticIntersectionBool(const CStateManager& mgr, const z
   return true;
 }
 
+void CGameCollision::RayStaticIntersectionBatch(const CStateManager& mgr,
+                                                std::span<const CAreaOctTree::SPacketRay> rays,
+                                                const CMaterialFilter& filter, std::span<CRayCastResult> results) {
+  constexpr size_t PacketSize = CAreaOctTree::kRayPacketSize;
+  const auto octant = [&rays](u32 idx) {
+    const zeus::CVector3f& dir = rays[idx].x0_line.dir;
+    return (dir.x() < 0.f ? 1 : 0) | (dir.y() < 0.f ? 2 : 0) | (dir.z() < 0.f ? 4 : 0);
+  };
+  std::vector<u32> order(rays.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&octant](u32 a, u32 b) { return octant(a) < octant(b); });
+
+  std::array<u32, PacketSize> packetIdxs;
+  std::array<CAreaOctTree::SPacketRay, PacketSize> packet;
+  std::array<CAreaOctTree::SRayResult, PacketSize> rayRes;
+  std::array<float, PacketSize> bestT;
+  for (size_t i = 0; i < order.size();) {
+    // Gather the rays following order[i] that head roughly the same way
+    const CAreaOctTree::SPacketRay& first = rays[order[i]];
+    size_t count = 0;
+    packetIdxs[count++] = order[i++];
+    while (count < PacketSize && i < order.size() && octant(order[i]) == octant(packetIdxs[0]) &&
+           rays[order[i]].x0_line.dir.dot(first.x0_line.dir) >= 0.9f) {
+      packetIdxs[count++] = order[i++];
+    }
+
+    if (count == 1) {
+      results[packetIdxs[0]] =
+          RayStaticIntersection(mgr, first.x0_line.origin, first.x0_line.dir, first.x20_length, filter);
+      continue;
+    }
+
+    // Same per-area merge as RayStaticIntersection, one lane per ray
+    for (size_t l = 0; l < count; ++l) {
+      packet[l] = rays[packetIdxs[l]];
+      results[packetIdxs[l]] = CRayCastResult();
+      bestT[l] = packet[l].x20_length <= 0.f ? 100000.f : packet[l].x20_length;
+    }
+    for (const CGameArea& area : *mgr.GetWorld()) {
+      const CAreaOctTree& collision = *area.GetPostConstructed()->x0_collision;
+      collision.GetRootNode().LineTestExPacket(packet.data(), count, filter, rayRes.data());
+      for (size_t l = 0; l < count; ++l) {
+        const float length = packet[l].x20_length;
+        if (!rayRes[l].x10_surface || (length != 0.f && length < rayRes[l].x3c_t) || rayRes[l].x3c_t >= bestT[l]) {
+          continue;
+        }
+        const zeus::CLine& line = packet[l].x0_line;
+        results[packetIdxs[l]] = CRayCastResult(rayRes[l].x3c_t, line.dir * rayRes[l].x3c_t + line.origin,
+                                                rayRes[l].x0_plane, rayRes[l].x10_surface->GetSurfaceFlags());
+        bestT[l] = rayRes[l].x3c_t;
+      }
+    }
+  }
+}
+
 CRayCastResult CGameCollision::RayDynamicIntersection(const CStateManager& mgr, TUniqueId& idOut,
                                                       const zeus::CVector3f& pos, const zeus::CVector3f& dir,
                                                       float length, const CMaterialFilter& filter,
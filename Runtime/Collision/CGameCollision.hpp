@@ -1,6 +1,7 @@
 #pragma once
 
 #include <optional>
+#include <span>
 
 #include "Runtime/RetroTypes.hpp"
 #include "Runtime/rstl.hpp"
@@ -46,6 +47,11 @@ public:
                                               const zeus::CVector3f& dir, float mag, const CMaterialFilter& filter);
   static bool RayStaticIntersectionBool(const CStateManager& mgr, const zeus::CVector3f& start,
                                         const zeus::CVector3f& dir, float length, const CMaterialFilter& filter);
+  /* Metaforce addition: RayStaticIntersection for many rays, results[i] answering rays[i]. Rays in the same
+   * direction octant and within about 25 degrees of each other are cast through the area octrees in packets of
+   * CAreaOctTree::kRayPacketSize; the rest are cast one at a time. */
+  static void RayStaticIntersectionBatch(const CStateManager& mgr, std::span<const CAreaOctTree::SPacketRay> rays,
+                                         const CMaterialFilter& filter, std::span<CRayCastResult> results);
   static CRayCastResult RayDynamicIntersection(const CStateManager& mgr, TUniqueId& idOut, const zeus::CVector3f& pos,
                                                const zeus::CVector3f& dir, float mag, const CMaterialFilter& filter,
                                                const EntityList& nearList);
@@ -1,19 +1,34 @@
 #include "Runtime/Collision/CMetroidAreaCollider.hpp"
 
+#include <memory>
+
 #include "Runtime/Collision/CCollisionInfoList.hpp"
 #include "Runtime/Collision/CMaterialFilter.hpp"
 #include "Runtime/Collision/CollisionUtil.hpp"
 
 namespace metaforce {
 
-u32 CMetroidAreaCollider::g_CalledClip = 0;
-u32 CMetroidAreaCollider::g_RejectedByClip = 0;
-u32 CMetroidAreaCollider::g_TrianglesProcessed = 0;
-u32 CMetroidAreaCollider::g_DupTrianglesProcessed = 0;
-u16 CMetroidAreaCollider::g_DupPrimitiveCheckCount = 0;
-std::array<u16, 0x2800> CMetroidAreaCollider::g_DupVertexList{};
-std::array<u16, 0x6000> CMetroidAreaCollider::g_DupEdgeList{};
-std::array<u16, 0x4000> CMetroidAreaCollider::g_DupTriangleList{};
+namespace {
+// False when the area's triangle cache shows the triangle's bounds missing aabb, which TriBoxOverlap would reject
+bool TriangleBoundsOverlap(const CAreaOctTree& tree, u16 triIdx, const zeus::CAABox& aabb) {
+  const CAreaOctTree::SCachedTriangle* tri = tree.GetCachedTriangle(triIdx);
+  return tri == nullptr || aabb.intersects(tri->x50_aabb);
+}
+
+zeus::CPlane TrianglePlane(const CAreaOctTree& tree, u16 triIdx, const CCollisionSurface& surf) {
+  const CAreaOctTree::SCachedTriangle* tri = tree.GetCachedTriangle(triIdx);
+  return tri != nullptr ? tri->x40_plane : surf.GetPlane();
+}
+
+CCollisionSurface DecodeTriangle(const CAreaOctTree& tree, u16 triIdx, u32 material, std::array<u16, 3>& vertIndices) {
+  if (const CAreaOctTree::SCachedTriangle* tri = tree.GetCachedTriangle(triIdx)) {
+    vertIndices = tri->x70_vertIndices;
+    return tri->x0_surface;
+  }
+  tree.GetTriangleVertexIndices(triIdx, vertIndices.data());
+  return {tree.GetVert(vertIndices[0]), tree.GetVert(vertIndices[1]), tree.GetVert(vertIndices[2]), material};
+}
+} // namespace
 
 CAABoxAreaCache::CAABoxAreaCache(const zeus::CAABox& aabb, const std::array<zeus::CPlane, 6>& pl,
                                  const CMaterialFilter& filter, const CMaterialList& material,
@@ -197,12 +212,12 @@ static zeus::CVector3f ClipRayToPlane(const zeus::CVector3f& a, const zeus::CVec
   return (1.f - -plane.pointToPlaneDist(a) / (b - a).dot(plane.normal())) * (a - b) + b;
 }
 
-bool CMetroidAreaCollider::ConvexPolyCollision(const std::array<zeus::CPlane, 6>& planes,
+bool CMetroidAreaCollider::ConvexPolyCollision(CAreaColliderContext& ctx, const std::array<zeus::CPlane, 6>& planes,
                                                const std::array<zeus::CVector3f, 3>& verts, zeus::CAABox& aabb) {
   std::array<rstl::reserved_vector<zeus::CVector3f, 20>, 2> vecs;
 
-  g_CalledClip += 1;
-  g_RejectedByClip -= 1;
+  ctx.m_calledClip += 1;
+  ctx.m_rejectedByClip -= 1;
 
   vecs[0].push_back(verts[0]);
   vecs[0].push_back(verts[1]);
@@ -237,11 +252,12 @@ bool CMetroidAreaCollider::ConvexPolyCollision(const std::array<zeus::CPlane, 6>
   for (const zeus::CVector3f& point : accumVec)
     aabb.accumulateBounds(point);
 
-  g_RejectedByClip -= 1;
+  ctx.m_rejectedByClip -= 1;
   return true;
 }
 
-bool CMetroidAreaCollider::AABoxCollisionCheckBoolean_Cached(const COctreeLeafCache& leafCache,
+bool CMetroidAreaCollider::AABoxCollisionCheckBoolean_Cached(CAreaColliderContext& ctx,
+                                                             const COctreeLeafCache& leafCache,
                                                              const zeus::CAABox& aabb, const CMaterialFilter& filter) {
   CBooleanAABoxAreaCache cache(aabb, filter);
 
@@ -249,8 +265,11 @@ bool CMetroidAreaCollider::AABoxCollisionCheckBoolean_Cached(const COctreeLeafCa
     if (cache.x0_aabb.intersects(node.GetBoundingBox())) {
       CAreaOctTree::TriListReference list = node.GetTriangleArray();
       for (int j = 0; j < list.GetSize(); ++j) {
-        ++g_TrianglesProcessed;
-        CCollisionSurface surf = node.GetOwner().GetMasterListTriangle(list.GetAt(j));
+        ++ctx.m_trianglesProcessed;
+        const u16 triIdx = list.GetAt(j);
+        if (!TriangleBoundsOverlap(node.GetOwner(), triIdx, cache.x0_aabb))
+          continue;
+        CCollisionSurface surf = node.GetOwner().GetMasterListTriangle(triIdx);
         if (cache.x4_filter.Passes(CMaterialList(surf.GetSurfaceFlags()))) {
           if (CollisionUtil::TriBoxOverlap(cache.x8_center, cache.x14_halfExtent, surf.GetVert(0), surf.GetVert(1),
                                            surf.GetVert(2)))
@@ -263,7 +282,8 @@ bool CMetroidAreaCollider::AABoxCollisionCheckBoolean_Cached(const COctreeLeafCa
   return false;
 }
 
-bool CMetroidAreaCollider::AABoxCollisionCheckBoolean_Internal(const CAreaOctTree::Node& node,
+bool CMetroidAreaCollider::AABoxCollisionCheckBoolean_Internal(CAreaColliderContext& ctx,
+                                                               const CAreaOctTree::Node& node,
                                                                const CBooleanAABoxAreaCache& cache) {
   for (int i = 0; i < 8; ++i) {
     CAreaOctTree::Node::ETreeType type = node.GetChildType(i);
@@ -273,8 +293,11 @@ bool CMetroidAreaCollider::AABoxCollisionCheckBoolean_Internal(const CAreaOctTre
         if (type == CAreaOctTree::Node::ETreeType::Leaf) {
           CAreaOctTree::TriListReference list = ch.GetTriangleArray();
           for (int j = 0; j < list.GetSize(); ++j) {
-            ++g_TrianglesProcessed;
-            CCollisionSurface surf = ch.GetOwner().GetMasterListTriangle(list.GetAt(j));
+            ++ctx.m_trianglesProcessed;
+            const u16 triIdx = list.GetAt(j);
+            if (!TriangleBoundsOverlap(ch.GetOwner(), triIdx, cache.x0_aabb))
+              continue;
+            CCollisionSurface surf = ch.GetOwner().GetMasterListTriangle(triIdx);
             if (cache.x4_filter.Passes(CMaterialList(surf.GetSurfaceFlags()))) {
               if (CollisionUtil::TriBoxOverlap(cache.x8_center, cache.x14_halfExtent, surf.GetVert(0), surf.GetVert(1),
                                                surf.GetVert(2)))
@@ -282,7 +305,7 @@ bool CMetroidAreaCollider::AABoxCollisionCheckBoolean_Internal(const CAreaOctTre
             }
           }
         } else {
-          if (AABoxCollisionCheckBoolean_Internal(ch, cache))
+          if (AABoxCollisionCheckBoolean_Internal(ctx, ch, cache))
             return true;
         }
       }
@@ -291,13 +314,14 @@ bool CMetroidAreaCollider::AABoxCollisionCheckBoolean_Internal(const CAreaOctTre
   return false;
 }
 
-bool CMetroidAreaCollider::AABoxCollisionCheckBoolean(const CAreaOctTree& octTree, const zeus::CAABox& aabb,
-                                                      const CMaterialFilter& filter) {
+bool CMetroidAreaCollider::AABoxCollisionCheckBoolean(CAreaColliderContext& ctx, const CAreaOctTree& octTree,
+                                                      const zeus::CAABox& aabb, const CMaterialFilter& filter) {
   CBooleanAABoxAreaCache cache(aabb, filter);
-  return AABoxCollisionCheckBoolean_Internal(octTree.GetRootNode(), cache);
+  return AABoxCollisionCheckBoolean_Internal(ctx, octTree.GetRootNode(), cache);
 }
 
-bool CMetroidAreaCollider::SphereCollisionCheckBoolean_Cached(const COctreeLeafCache& leafCache,
+bool CMetroidAreaCollider::SphereCollisionCheckBoolean_Cached(CAreaColliderContext& ctx,
+                                                              const COctreeLeafCache& leafCache,
                                                               const zeus::CAABox& aabb, const zeus::CSphere& sphere,
                                                               const CMaterialFilter& filter) {
   CBooleanSphereAreaCache cache(aabb, sphere, filter);
@@ -306,7 +330,7 @@ bool CMetroidAreaCollider::SphereCollisionCheckBoolean_Cached(const COctreeLeafC
     if (cache.x0_aabb.intersects(node.GetBoundingBox())) {
       CAreaOctTree::TriListReference list = node.GetTriangleArray();
       for (int j = 0; j < list.GetSize(); ++j) {
-        ++g_TrianglesProcessed;
+        ++ctx.m_trianglesProcessed;
         CCollisionSurface surf = node.GetOwner().GetMasterListTriangle(list.GetAt(j));
         if (cache.x8_filter.Passes(CMaterialList(surf.GetSurfaceFlags()))) {
           if (CollisionUtil::TriSphereOverlap(cache.x4_sphere, surf.GetVert(0), surf.GetVert(1), surf.GetVert(2)))
@@ -319,7 +343,8 @@ bool CMetroidAreaCollider::SphereCollisionCheckBoolean_Cached(const COctreeLeafC
   return false;
 }
 
-bool CMetroidAreaCollider::SphereCollisionCheckBoolean_Internal(const CAreaOctTree::Node& node,
+bool CMetroidAreaCollider::SphereCollisionCheckBoolean_Internal(CAreaColliderContext& ctx,
+                                                                const CAreaOctTree::Node& node,
                                                                 const CBooleanSphereAreaCache& cache) {
   for (int i = 0; i < 8; ++i) {
     CAreaOctTree::Node::ETreeType type = node.GetChildType(i);
@@ -329,7 +354,7 @@ bool CMetroidAreaCollider::SphereCollisionCheckBoolean_Internal(const CAreaOctTr
         if (type == CAreaOctTree::Node::ETreeType::Leaf) {
           CAreaOctTree::TriListReference list = ch.GetTriangleArray();
           for (int j = 0; j < list.GetSize(); ++j) {
-            ++g_TrianglesProcessed;
+            ++ctx.m_trianglesProcessed;
             CCollisionSurface surf = ch.GetOwner().GetMasterListTriangle(list.GetAt(j));
             if (cache.x8_filter.Passes(CMaterialList(surf.GetSurfaceFlags()))) {
               if (CollisionUtil::TriSphereOverlap(cache.x4_sphere, surf.GetVert(0), surf.GetVert(1), surf.GetVert(2)))
@@ -337,7 +362,7 @@ bool CMetroidAreaCollider::SphereCollisionCheckBoolean_Internal(const CAreaOctTr
             }
           }
         } else {
-          if (SphereCollisionCheckBoolean_Internal(ch, cache))
+          if (SphereCollisionCheckBoolean_Internal(ctx, ch, cache))
             return true;
         }
       }
@@ -346,16 +371,17 @@ bool CMetroidAreaCollider::SphereCollisionCheckBoolean_Internal(const CAreaOctTr
   return false;
 }
 
-bool CMetroidAreaCollider::SphereCollisionCheckBoolean(const CAreaOctTree& octTree, const zeus::CAABox& aabb,
-                                                       const zeus::CSphere& sphere, const CMaterialFilter& filter) {
+bool CMetroidAreaCollider::SphereCollisionCheckBoolean(CAreaColliderContext& ctx, const CAreaOctTree& octTree,
+                                                       const zeus::CAABox& aabb, const zeus::CSphere& sphere,
+                                                       const CMaterialFilter& filter) {
   CAreaOctTree::Node node = octTree.GetRootNode();
   CBooleanSphereAreaCache cache(aabb, sphere, filter);
-  return SphereCollisionCheckBoolean_Internal(node, cache);
+  return SphereCollisionCheckBoolean_Internal(ctx, node, cache);
 }
 
-bool CMetroidAreaCollider::AABoxCollisionCheck_Cached(const COctreeLeafCache& leafCache, const zeus::CAABox& aabb,
-                                                      const CMaterialFilter& filter, const CMaterialList& matList,
-                                                      CCollisionInfoList& list) {
+bool CMetroidAreaCollider::AABoxCollisionCheck_Cached(CAreaColliderContext& ctx, const COctreeLeafCache& leafCache,
+                                                      const zeus::CAABox& aabb, const CMaterialFilter& filter,
+                                                      const CMaterialList& matList, CCollisionInfoList& list) {
   bool ret = false;
   const std::array<zeus::CPlane, 6> planes{{
       {zeus::skRight, aabb.min.dot(zeus::skRight)},
@@ -367,26 +393,28 @@ bool CMetroidAreaCollider::AABoxCollisionCheck_Cached(const COctreeLeafCache& le
   }};
   CAABoxAreaCache cache(aabb, planes, filter, matList, list);
 
-  ResetInternalCounters();
+  ctx.ResetCounters();
 
   for (const CAreaOctTree::Node& node : leafCache.x4_nodeCache) {
     if (aabb.intersects(node.GetBoundingBox())) {
       CAreaOctTree::TriListReference listRef = node.GetTriangleArray();
       for (int j = 0; j < listRef.GetSize(); ++j) {
-        ++g_TrianglesProcessed;
+        ++ctx.m_trianglesProcessed;
         u16 triIdx = listRef.GetAt(j);
-        if (g_DupPrimitiveCheckCount == g_DupTriangleList[triIdx]) {
-          g_DupTrianglesProcessed += 1;
+        if (ctx.m_dupPrimitiveCheckCount == ctx.m_dupTriangleList[triIdx]) {
+          ctx.m_dupTrianglesProcessed += 1;
         } else {
-          g_DupTriangleList[triIdx] = g_DupPrimitiveCheckCount;
+          ctx.m_dupTriangleList[triIdx] = ctx.m_dupPrimitiveCheckCount;
+          if (!TriangleBoundsOverlap(node.GetOwner(), triIdx, aabb))
+            continue;
           CCollisionSurface surf = node.GetOwner().GetMasterListTriangle(triIdx);
           CMaterialList material(surf.GetSurfaceFlags());
           if (cache.x8_filter.Passes(material)) {
             if (CollisionUtil::TriBoxOverlap(cache.x14_center, cache.x20_halfExtent, surf.GetVert(0), surf.GetVert(1),
                                              surf.GetVert(2))) {
               zeus::CAABox aabb2 = zeus::CAABox();
-              if (ConvexPolyCollision(cache.x4_planes, surf.GetVerts(), aabb2)) {
-                zeus::CPlane plane = surf.GetPlane();
+              if (ConvexPolyCollision(ctx, cache.x4_planes, surf.GetVerts(), aabb2)) {
+                zeus::CPlane plane = TrianglePlane(node.GetOwner(), triIdx, surf);
                 CCollisionInfo collision(aabb2, cache.xc_material, material, plane.normal(), -plane.normal());
                 cache.x10_collisionList.Add(collision, false);
                 ret = true;
@@ -401,7 +429,8 @@ bool CMetroidAreaCollider::AABoxCollisionCheck_Cached(const COctreeLeafCache& le
   return ret;
 }
 
-bool CMetroidAreaCollider::AABoxCollisionCheck_Internal(const CAreaOctTree::Node& node, const CAABoxAreaCache& cache) {
+bool CMetroidAreaCollider::AABoxCollisionCheck_Internal(CAreaColliderContext& ctx, const CAreaOctTree::Node& node,
+                                                        const CAABoxAreaCache& cache) {
   bool ret = false;
 
   switch (node.GetTreeType()) {
@@ -411,7 +440,7 @@ bool CMetroidAreaCollider::AABoxCollisionCheck_Internal(const CAreaOctTree::Node
     for (int i = 0; i < 8; ++i) {
       CAreaOctTree::Node ch = node.GetChild(i);
       if (ch.GetBoundingBox().intersects(cache.x0_aabb))
-        if (AABoxCollisionCheck_Internal(ch, cache))
+        if (AABoxCollisionCheck_Internal(ctx, ch, cache))
           ret = true;
     }
     break;
@@ -419,20 +448,22 @@ bool CMetroidAreaCollider::AABoxCollisionCheck_Internal(const CAreaOctTree::Node
   case CAreaOctTree::Node::ETreeType::Leaf: {
     CAreaOctTree::TriListReference list = node.GetTriangleArray();
     for (int j = 0; j < list.GetSize(); ++j) {
-      ++g_TrianglesProcessed;
+      ++ctx.m_trianglesProcessed;
       u16 triIdx = list.GetAt(j);
-      if (g_DupPrimitiveCheckCount == g_DupTriangleList[triIdx]) {
-        g_DupTrianglesProcessed += 1;
+      if (ctx.m_dupPrimitiveCheckCount == ctx.m_dupTriangleList[triIdx]) {
+        ctx.m_dupTrianglesProcessed += 1;
       } else {
-        g_DupTriangleList[triIdx] = g_DupPrimitiveCheckCount;
+        ctx.m_dupTriangleList[triIdx] = ctx.m_dupPrimitiveCheckCount;
+        if (!TriangleBoundsOverlap(node.GetOwner(), triIdx, cache.x0_aabb))
+          continue;
         CCollisionSurface surf = node.GetOwner().GetMasterListTriangle(triIdx);
         CMaterialList material(surf.GetSurfaceFlags());
         if (cache.x8_filter.Passes(material)) {
           if (CollisionUtil::TriBoxOverlap(cache.x14_center, cache.x20_halfExtent, surf.GetVert(0), surf.GetVert(1),
                                            surf.GetVert(2))) {
             zeus::CAABox aabb = zeus::CAABox();
-            if (ConvexPolyCollision(cache.x4_planes, surf.GetVerts(), aabb)) {
-              zeus::CPlane plane = surf.GetPlane();
+            if (ConvexPolyCollision(ctx, cache.x4_planes, surf.GetVerts(), aabb)) {
+              zeus::CPlane plane = TrianglePlane(node.GetOwner(), triIdx, surf);
               CCollisionInfo collision(aabb, cache.xc_material, material, plane.normal(), -plane.normal());
               cache.x10_collisionList.Add(collision, false);
               ret = true;
@@ -450,9 +481,9 @@ bool CMetroidAreaCollider::AABoxCollisionCheck_Internal(const CAreaOctTree::Node
   return ret;
 }
 
-bool CMetroidAreaCollider::AABoxCollisionCheck(const CAreaOctTree& octTree, const zeus::CAABox& aabb,
-                                               const CMaterialFilter& filter, const CMaterialList& matList,
-                                               CCollisionInfoList& list) {
+bool CMetroidAreaCollider::AABoxCollisionCheck(CAreaColliderContext& ctx, const CAreaOctTree& octTree,
+                                               const zeus::CAABox& aabb, const CMaterialFilter& filter,
+                                               const CMaterialList& matList, CCollisionInfoList& list) {
   const std::array<zeus::CPlane, 6> planes{{
       {zeus::skRight, aabb.min.dot(zeus::skRight)},
       {zeus::skLeft, aabb.max.dot(zeus::skLeft)},
@@ -463,16 +494,17 @@ bool CMetroidAreaCollider::AABoxCollisionCheck(const CAreaOctTree& octTree, cons
   }};
   const CAABoxAreaCache cache(aabb, planes, filter, matList, list);
 
-  ResetInternalCounters();
+  ctx.ResetCounters();
 
   const CAreaOctTree::Node node = octTree.GetRootNode();
-  return AABoxCollisionCheck_Internal(node, cache);
+  return AABoxCollisionCheck_Internal(ctx, node, cache);
 }
 
-bool CMetroidAreaCollider::SphereCollisionCheck_Cached(const COctreeLeafCache& leafCache, const zeus::CAABox& aabb,
-                                                       const zeus::CSphere& sphere, const CMaterialList& matList,
-                                                       const CMaterialFilter& filter, CCollisionInfoList& clist) {
-  ResetInternalCounters();
+bool CMetroidAreaCollider::SphereCollisionCheck_Cached(CAreaColliderContext& ctx, const COctreeLeafCache& leafCache,
+                                                       const zeus::CAABox& aabb, const zeus::CSphere& sphere,
+                                                       const CMaterialList& matList, const CMaterialFilter& filter,
+                                                       CCollisionInfoList& clist) {
+  ctx.ResetCounters();
 
   bool ret = false;
   zeus::CVector3f point, normal;
@@ -481,12 +513,12 @@ bool CMetroidAreaCollider::SphereCollisionCheck_Cached(const COctreeLeafCache& l
     if (aabb.intersects(node.GetBoundingBox())) {
       CAreaOctTree::TriListReference list = node.GetTriangleArray();
       for (int j = 0; j < list.GetSize(); ++j) {
-        ++g_TrianglesProcessed;
+        ++ctx.m_trianglesProcessed;
         u16 triIdx = list.GetAt(j);
-        if (g_DupPrimitiveCheckCount == g_DupTriangleList[triIdx]) {
-          g_DupTrianglesProcessed += 1;
+        if (ctx.m_dupPrimitiveCheckCount == ctx.m_dupTriangleList[triIdx]) {
+          ctx.m_dupTrianglesProcessed += 1;
         } else {
-          g_DupTriangleList[triIdx] = g_DupPrimitiveCheckCount;
+          ctx.m_dupTriangleList[triIdx] = ctx.m_dupPrimitiveCheckCount;
           CCollisionSurface surf = node.GetOwner().GetMasterListTriangle(triIdx);
           CMaterialList material(surf.GetSurfaceFlags());
           if (filter.Passes(material)) {
@@ -505,7 +537,7 @@ bool CMetroidAreaCollider::SphereCollisionCheck_Cached(const COctreeLeafCache& l
   return ret;
 }
 
-bool CMetroidAreaCollider::SphereCollisionCheck_Internal(const CAreaOctTree::Node& node,
+bool CMetroidAreaCollider::SphereCollisionCheck_Internal(CAreaColliderContext& ctx, const CAreaOctTree::Node& node,
                                                          const CSphereAreaCache& cache) {
   bool ret = false;
   zeus::CVector3f point, normal;
@@ -518,12 +550,12 @@ bool CMetroidAreaCollider::SphereCollisionCheck_Internal(const CAreaOctTree::Nod
         if (chTp == CAreaOctTree::Node::ETreeType::Leaf) {
           CAreaOctTree::TriListReference list = ch.GetTriangleArray();
           for (int j = 0; j < list.GetSize(); ++j) {
-            ++g_TrianglesProcessed;
+            ++ctx.m_trianglesProcessed;
             u16 triIdx = list.GetAt(j);
-            if (g_DupPrimitiveCheckCount == g_DupTriangleList[triIdx]) {
-              g_DupTrianglesProcessed += 1;
+            if (ctx.m_dupPrimitiveCheckCount == ctx.m_dupTriangleList[triIdx]) {
+              ctx.m_dupTrianglesProcessed += 1;
             } else {
-              g_DupTriangleList[triIdx] = g_DupPrimitiveCheckCount;
+              ctx.m_dupTriangleList[triIdx] = ctx.m_dupPrimitiveCheckCount;
               CCollisionSurface surf = ch.GetOwner().GetMasterListTriangle(triIdx);
               CMaterialList material(surf.GetSurfaceFlags());
               if (cache.x8_filter.Passes(material)) {
@@ -537,7 +569,7 @@ bool CMetroidAreaCollider::SphereCollisionCheck_Internal(const CAreaOctTree::Nod
             }
           }
         } else {
-          if (SphereCollisionCheck_Internal(ch, cache))
+          if (SphereCollisionCheck_Internal(ctx, ch, cache))
             ret = true;
         }
       }
@@ -547,13 +579,14 @@ bool CMetroidAreaCollider::SphereCollisionCheck_Internal(const CAreaOctTree::Nod
   return ret;
 }
 
-bool CMetroidAreaCollider::SphereCollisionCheck(const CAreaOctTree& octTree, const zeus::CAABox& aabb,
-                                                const zeus::CSphere& sphere, const CMaterialList& matList,
-                                                const CMaterialFilter& filter, CCollisionInfoList& list) {
+bool CMetroidAreaCollider::SphereCollisionCheck(CAreaColliderContext& ctx, const CAreaOctTree& octTree,
+                                                const zeus::CAABox& aabb, const zeus::CSphere& sphere,
+                                                const CMaterialList& matList, const CMaterialFilter& filter,
+                                                CCollisionInfoList& list) {
   CSphereAreaCache cache(aabb, sphere, filter, matList, list);
-  ResetInternalCounters();
+  ctx.ResetCounters();
   CAreaOctTree::Node node = octTree.GetRootNode();
-  return SphereCollisionCheck_Internal(node, cache);
+  return SphereCollisionCheck_Internal(ctx, node, cache);
 }
 
 bool CMetroidAreaCollider::MovingAABoxCollisionCheck_BoxVertexTri(
@@ -651,12 +684,13 @@ bool CMetroidAreaCollider::MovingAABoxCollisionCheck_Edge(const zeus::CVector3f&
   return ret;
 }
 
-bool CMetroidAreaCollider::MovingAABoxCollisionCheck_Cached(const COctreeLeafCache& leafCache, const zeus::CAABox& aabb,
+bool CMetroidAreaCollider::MovingAABoxCollisionCheck_Cached(CAreaColliderContext& ctx,
+                                                            const COctreeLeafCache& leafCache, const zeus::CAABox& aabb,
                                                             const CMaterialFilter& filter, const CMaterialList& matList,
                                                             const zeus::CVector3f& dir, float mag,
                                                             CCollisionInfo& infoOut, double& dOut) {
   bool ret = false;
-  ResetInternalCounters();
+  ctx.ResetCounters();
   dOut = mag;
 
   CMovingAABoxComponents components(aabb, dir);
@@ -676,15 +710,13 @@ bool CMetroidAreaCollider::MovingAABoxCollisionCheck_Cached(const COctreeLeafCac
       CAreaOctTree::TriListReference list = node.GetTriangleArray();
       for (int j = 0; j < list.GetSize(); ++j) {
         u16 triIdx = list.GetAt(j);
-        if (g_DupPrimitiveCheckCount != g_DupTriangleList[triIdx]) {
-          g_TrianglesProcessed += 1;
-          g_DupTriangleList[triIdx] = g_DupPrimitiveCheckCount;
+        if (ctx.m_dupPrimitiveCheckCount != ctx.m_dupTriangleList[triIdx]) {
+          ctx.m_trianglesProcessed += 1;
+          ctx.m_dupTriangleList[triIdx] = ctx.m_dupPrimitiveCheckCount;
           CMaterialList triMat(node.GetOwner().GetTriangleMaterial(triIdx));
           if (filter.Passes(triMat)) {
             std::array<u16, 3> vertIndices;
-            node.GetOwner().GetTriangleVertexIndices(triIdx, vertIndices.data());
-            CCollisionSurface surf(node.GetOwner().GetVert(vertIndices[0]), node.GetOwner().GetVert(vertIndices[1]),
-                                   node.GetOwner().GetVert(vertIndices[2]), triMat.GetValue());
+            const CCollisionSurface surf = DecodeTriangle(node.GetOwner(), triIdx, triMat.GetValue(), vertIndices);
 
             if (CollisionUtil::TriBoxOverlap(center, extent, surf.GetVert(0), surf.GetVert(1), surf.GetVert(2))) {
               bool triRet = false;
@@ -699,8 +731,8 @@ bool CMetroidAreaCollider::MovingAABoxCollisionCheck_Cached(const COctreeLeafCac
 
               for (const u16 vertIdx : vertIndices) {
                 zeus::CVector3f vtx = node.GetOwner().GetVert(vertIdx);
-                if (g_DupPrimitiveCheckCount != g_DupVertexList[vertIdx]) {
-                  g_DupVertexList[vertIdx] = g_DupPrimitiveCheckCount;
+                if (ctx.m_dupPrimitiveCheckCount != ctx.m_dupVertexList[vertIdx]) {
+                  ctx.m_dupVertexList[vertIdx] = ctx.m_dupPrimitiveCheckCount;
                   if (movedAABB.pointInside(vtx)) {
                     d = dOut;
                     if (MovingAABoxCollisionCheck_TriVertexBox(vtx, aabb, dir, d, normal, point) && d < dOut) {
@@ -717,8 +749,8 @@ bool CMetroidAreaCollider::MovingAABoxCollisionCheck_Cached(const COctreeLeafCac
               const u16* edgeIndices = node.GetOwner().GetTriangleEdgeIndices(triIdx);
               for (int k = 0; k < 3; ++k) {
                 u16 edgeIdx = edgeIndices[k];
-                if (g_DupPrimitiveCheckCount != g_DupEdgeList[edgeIdx]) {
-                  g_DupEdgeList[edgeIdx] = g_DupPrimitiveCheckCount;
+                if (ctx.m_dupPrimitiveCheckCount != ctx.m_dupEdgeList[edgeIdx]) {
+                  ctx.m_dupEdgeList[edgeIdx] = ctx.m_dupPrimitiveCheckCount;
                   CMaterialList edgeMat(node.GetOwner().GetEdgeMaterial(edgeIdx));
                   if (!edgeMat.HasMaterial(EMaterialTypes::NoEdgeCollision)) {
                     d = dOut;
@@ -746,12 +778,12 @@ bool CMetroidAreaCollider::MovingAABoxCollisionCheck_Cached(const COctreeLeafCac
               }
             } else {
               const u16* edgeIndices = node.GetOwner().GetTriangleEdgeIndices(triIdx);
-              g_DupEdgeList[edgeIndices[0]] = g_DupPrimitiveCheckCount;
-              g_DupEdgeList[edgeIndices[1]] = g_DupPrimitiveCheckCount;
-              g_DupEdgeList[edgeIndices[2]] = g_DupPrimitiveCheckCount;
-              g_DupVertexList[vertIndices[0]] = g_DupPrimitiveCheckCount;
-              g_DupVertexList[vertIndices[1]] = g_DupPrimitiveCheckCount;
-              g_DupVertexList[vertIndices[2]] = g_DupPrimitiveCheckCount;
+              ctx.m_dupEdgeList[edgeIndices[0]] = ctx.m_dupPrimitiveCheckCount;
+              ctx.m_dupEdgeList[edgeIndices[1]] = ctx.m_dupPrimitiveCheckCount;
+              ctx.m_dupEdgeList[edgeIndices[2]] = ctx.m_dupPrimitiveCheckCount;
+              ctx.m_dupVertexList[vertIndices[0]] = ctx.m_dupPrimitiveCheckCount;
+              ctx.m_dupVertexList[vertIndices[1]] = ctx.m_dupPrimitiveCheckCount;
+              ctx.m_dupVertexList[vertIndices[2]] = ctx.m_dupPrimitiveCheckCount;
             }
           }
         }
@@ -762,13 +794,14 @@ bool CMetroidAreaCollider::MovingAABoxCollisionCheck_Cached(const COctreeLeafCac
   return ret;
 }
 
-bool CMetroidAreaCollider::MovingSphereCollisionCheck_Cached(const COctreeLeafCache& leafCache,
+bool CMetroidAreaCollider::MovingSphereCollisionCheck_Cached(CAreaColliderContext& ctx,
+                                                             const COctreeLeafCache& leafCache,
                                                              const zeus::CAABox& aabb, const zeus::CSphere& sphere,
                                                              const CMaterialFilter& filter,
                                                              const CMaterialList& matList, const zeus::CVector3f& dir,
                                                              float mag, CCollisionInfo& infoOut, double& dOut) {
   bool ret = false;
-  ResetInternalCounters();
+  ctx.ResetCounters();
   dOut = mag;
 
   zeus::CAABox movedAABB = aabb;
@@ -784,15 +817,13 @@ bool CMetroidAreaCollider::MovingSphereCollisionCheck_Cached(const COctreeLeafCa
       CAreaOctTree::TriListReference list = node.GetTriangleArray();
       for (int j = 0; j < list.GetSize(); ++j) {
         u16 triIdx = list.GetAt(j);
-        if (g_DupPrimitiveCheckCount != g_DupTriangleList[triIdx]) {
-          g_TrianglesProcessed += 1;
-          g_DupTriangleList[triIdx] = g_DupPrimitiveCheckCount;
+        if (ctx.m_dupPrimitiveCheckCount != ctx.m_dupTriangleList[triIdx]) {
+          ctx.m_trianglesProcessed += 1;
+          ctx.m_dupTriangleList[triIdx] = ctx.m_dupPrimitiveCheckCount;
           CMaterialList triMat(node.GetOwner().GetTriangleMaterial(triIdx));
           if (filter.Passes(triMat)) {
             std::array<u16, 3> vertIndices;
-            node.GetOwner().GetTriangleVertexIndices(triIdx, vertIndices.data());
-            CCollisionSurface surf(node.GetOwner().GetVert(vertIndices[0]), node.GetOwner().GetVert(vertIndices[1]),
-                                   node.GetOwner().GetVert(vertIndices[2]), triMat.GetValue());
+            const CCollisionSurface surf = DecodeTriangle(node.GetOwner(), triIdx, triMat.GetValue(), vertIndices);
 
             if (CollisionUtil::TriBoxOverlap(center, extent, surf.GetVert(0), surf.GetVert(1), surf.GetVert(2))) {
               zeus::CVector3f surfNormal = surf.GetNormal();
@@ -821,8 +852,8 @@ bool CMetroidAreaCollider::MovingSphereCollisionCheck_Cached(const COctreeLeafCa
                 for (int k = 0; k < 3; ++k) {
                   if (intersects || outsideEdges[k]) {
                     u16 edgeIdx = edgeIndices[k];
-                    if (g_DupPrimitiveCheckCount != g_DupEdgeList[edgeIdx]) {
-                      g_DupEdgeList[edgeIdx] = g_DupPrimitiveCheckCount;
+                    if (ctx.m_dupPrimitiveCheckCount != ctx.m_dupEdgeList[edgeIdx]) {
+                      ctx.m_dupEdgeList[edgeIdx] = ctx.m_dupPrimitiveCheckCount;
                       CMaterialList edgeMat(node.GetOwner().GetEdgeMaterial(edgeIdx));
                       if (!edgeMat.HasMaterial(EMaterialTypes::NoEdgeCollision)) {
                         int nextIdx = (k + 1) % 3;
@@ -871,8 +902,8 @@ bool CMetroidAreaCollider::MovingSphereCollisionCheck_Cached(const COctreeLeafCa
                 for (int k = 0; k < 3; ++k) {
                   u16 vertIdx = vertIndices[k];
                   if (testVert[k]) {
-                    if (g_DupPrimitiveCheckCount != g_DupVertexList[vertIdx]) {
-                      g_DupVertexList[vertIdx] = g_DupPrimitiveCheckCount;
+                    if (ctx.m_dupPrimitiveCheckCount != ctx.m_dupVertexList[vertIdx]) {
+                      ctx.m_dupVertexList[vertIdx] = ctx.m_dupPrimitiveCheckCount;
                       double d = dOut;
                       if (CollisionUtil::RaySphereIntersection_Double(zeus::CSphere(surf.GetVert(k), sphere.radius),
                                                                       sphere.position, dir, d) &&
@@ -885,7 +916,7 @@ bool CMetroidAreaCollider::MovingSphereCollisionCheck_Cached(const COctreeLeafCa
                       }
                     }
                   } else {
-                    g_DupVertexList[vertIdx] = g_DupPrimitiveCheckCount;
+                    ctx.m_dupVertexList[vertIdx] = ctx.m_dupPrimitiveCheckCount;
                   }
                 }
 
@@ -900,12 +931,12 @@ bool CMetroidAreaCollider::MovingSphereCollisionCheck_Cached(const COctreeLeafCa
               }
             } else {
               const u16* edgeIndices = node.GetOwner().GetTriangleEdgeIndices(triIdx);
-              g_DupEdgeList[edgeIndices[0]] = g_DupPrimitiveCheckCount;
-              g_DupEdgeList[edgeIndices[1]] = g_DupPrimitiveCheckCount;
-              g_DupEdgeList[edgeIndices[2]] = g_DupPrimitiveCheckCount;
-              g_DupVertexList[vertIndices[0]] = g_DupPrimitiveCheckCount;
-              g_DupVertexList[vertIndices[1]] = g_DupPrimitiveCheckCount;
-              g_DupVertexList[vertIndices[2]] = g_DupPrimitiveCheckCount;
+              ctx.m_dupEdgeList[edgeIndices[0]] = ctx.m_dupPrimitiveCheckCount;
+              ctx.m_dupEdgeList[edgeIndices[1]] = ctx.m_dupPrimitiveCheckCount;
+              ctx.m_dupEdgeList[edgeIndices[2]] = ctx.m_dupPrimitiveCheckCount;
+              ctx.m_dupVertexList[vertIndices[0]] = ctx.m_dupPrimitiveCheckCount;
+              ctx.m_dupVertexList[vertIndices[1]] = ctx.m_dupPrimitiveCheckCount;
+              ctx.m_dupVertexList[vertIndices[2]] = ctx.m_dupPrimitiveCheckCount;
             }
           }
         }
@@ -916,18 +947,24 @@ bool CMetroidAreaCollider::MovingSphereCollisionCheck_Cached(const COctreeLeafCa
   return ret;
 }
 
-void CMetroidAreaCollider::ResetInternalCounters() {
-  g_CalledClip = 0;
-  g_RejectedByClip = 0;
-  g_TrianglesProcessed = 0;
-  g_DupTrianglesProcessed = 0;
-  if (g_DupPrimitiveCheckCount == 0xffff) {
-    g_DupVertexList.fill(0);
-    g_DupEdgeList.fill(0);
-    g_DupTriangleList.fill(0);
-    g_DupPrimitiveCheckCount += 1;
+void CAreaColliderContext::ResetCounters() {
+  m_calledClip = 0;
+  m_rejectedByClip = 0;
+  m_trianglesProcessed = 0;
+  m_dupTrianglesProcessed = 0;
+  if (m_dupPrimitiveCheckCount == 0xffff) {
+    m_dupVertexList.fill(0);
+    m_dupEdgeList.fill(0);
+    m_dupTriangleList.fill(0);
+    m_dupPrimitiveCheckCount += 1;
   }
-  g_DupPrimitiveCheckCount += 1;
+  m_dupPrimitiveCheckCount += 1;
+}
+
+CAreaColliderContext& CMetroidAreaCollider::GetDefaultContext() {
+  // Parallel move jobs query static collision through the overloads that use this, so each thread gets its own
+  thread_local const auto context = std::make_unique<CAreaColliderContext>();
+  return *context;
 }
 
 void CAreaCollisionCache::ClearCache() {
@@ -86,22 +86,43 @@ public:
   CMovingAABoxComponents(const zeus::CAABox& aabb, const zeus::CVector3f& dir);
 };
 
+/* Metaforce addition: scratch state of static collision queries, formerly process-wide statics of
+ * CMetroidAreaCollider. Each query bumps the check count and stamps the triangles, edges and vertices it tests with
+ * it, so primitives shared by several octree leaves are only tested once. A context serves one query at a time;
+ * queries running concurrently need one context each. At about 100KB it belongs on the heap or in a long-lived
+ * object rather than on a job's stack. */
+class CAreaColliderContext {
+  friend class CMetroidAreaCollider;
+  friend class CCollidableOBBTree;
+  u32 m_calledClip = 0;
+  u32 m_rejectedByClip = 0;
+  u32 m_trianglesProcessed = 0;
+  u32 m_dupTrianglesProcessed = 0;
+  u16 m_dupPrimitiveCheckCount = 0;
+  std::array<u16, 0x2800> m_dupVertexList{};
+  std::array<u16, 0x6000> m_dupEdgeList{};
+  std::array<u16, 0x4000> m_dupTriangleList{};
+
+public:
+  /* Starts a new query: zeroes the counters and moves to a fresh check count */
+  void ResetCounters();
+  u32 GetTrianglesProcessed() const { return m_trianglesProcessed; }
+  u32 GetDupTrianglesProcessed() const { return m_dupTrianglesProcessed; }
+  std::array<u16, 0x4000>& GetTriangleList() { return m_dupTriangleList; }
+  u16 GetPrimitiveCheckCount() const { return m_dupPrimitiveCheckCount; }
+};
+
 class CMetroidAreaCollider {
   friend class CCollidableOBBTree;
-  static u32 g_CalledClip;
-  static u32 g_RejectedByClip;
-  static u32 g_TrianglesProcessed;
-  static u32 g_DupTrianglesProcessed;
-  static u16 g_DupPrimitiveCheckCount;
-  static std::array<u16, 0x2800> g_DupVertexList;
-  static std::array<u16, 0x6000> g_DupEdgeList;
-  static std::array<u16, 0x4000> g_DupTriangleList;
-  static bool AABoxCollisionCheckBoolean_Internal(const CAreaOctTree::Node& node, const CBooleanAABoxAreaCache& cache);
-  static bool AABoxCollisionCheck_Internal(const CAreaOctTree::Node& node, const CAABoxAreaCache& cache);
-
-  static bool SphereCollisionCheckBoolean_Internal(const CAreaOctTree::Node& node,
+  static bool AABoxCollisionCheckBoolean_Internal(CAreaColliderContext& ctx, const CAreaOctTree::Node& node,
+                                                  const CBooleanAABoxAreaCache& cache);
+  static bool AABoxCollisionCheck_Internal(CAreaColliderContext& ctx, const CAreaOctTree::Node& node,
+                                           const CAABoxAreaCache& cache);
+
+  static bool SphereCollisionCheckBoolean_Internal(CAreaColliderContext& ctx, const CAreaOctTree::Node& node,
                                                    const CBooleanSphereAreaCache& cache);
-  static bool SphereCollisionCheck_Internal(const CAreaOctTree::Node& node, const CSphereAreaCache& cache);
+  static bool SphereCollisionCheck_Internal(CAreaColliderContext& ctx, const CAreaOctTree::Node& node,
+                                            const CSphereAreaCache& cache);
 
   static bool MovingAABoxCollisionCheck_BoxVertexTri(const CCollisionSurface& surf, const zeus::CAABox& aabb,
                                                      const rstl::reserved_vector<u32, 8>& vertIndices,
@@ -133,43 +154,110 @@ public:
   };
   static void BuildOctreeLeafCache(const CAreaOctTree::Node& root, const zeus::CAABox& aabb,
                                    CMetroidAreaCollider::COctreeLeafCache& cache);
-  static bool ConvexPolyCollision(const std::array<zeus::CPlane, 6>& planes,
+  static bool ConvexPolyCollision(CAreaColliderContext& ctx, const std::array<zeus::CPlane, 6>& planes,
                                   const std::array<zeus::CVector3f, 3>& verts, zeus::CAABox& aabb);
 
+  static bool AABoxCollisionCheckBoolean_Cached(CAreaColliderContext& ctx, const COctreeLeafCache& leafCache,
+                                                const zeus::CAABox& aabb, const CMaterialFilter& filter);
+  static bool AABoxCollisionCheckBoolean(CAreaColliderContext& ctx, const CAreaOctTree& octTree,
+                                         const zeus::CAABox& aabb, const CMaterialFilter& filter);
+
+  static bool SphereCollisionCheckBoolean_Cached(CAreaColliderContext& ctx, const COctreeLeafCache& leafCache,
+                                                 const zeus::CAABox& aabb, const zeus::CSphere& sphere,
+                                                 const CMaterialFilter& filter);
+  static bool SphereCollisionCheckBoolean(CAreaColliderContext& ctx, const CAreaOctTree& octTree,
+                                          const zeus::CAABox& aabb, const zeus::CSphere& sphere,
+                                          const CMaterialFilter& filter);
+
+  static bool AABoxCollisionCheck_Cached(CAreaColliderContext& ctx, const COctreeLeafCache& leafCache,
+                                         const zeus::CAABox& aabb, const CMaterialFilter& filter,
+                                         const CMaterialList& matList, CCollisionInfoList& list);
+  static bool AABoxCollisionCheck(CAreaColliderContext& ctx, const CAreaOctTree& octTree, const zeus::CAABox& aabb,
+                                  const CMaterialFilter& filter, const CMaterialList& matList,
+                                  CCollisionInfoList& list);
+
+  static bool SphereCollisionCheck_Cached(CAreaColliderContext& ctx, const COctreeLeafCache& leafCache,
+                                          const zeus::CAABox& aabb, const zeus::CSphere& sphere,
+                                          const CMaterialList& matList, const CMaterialFilter& filter,
+                                          CCollisionInfoList& list);
+  static bool SphereCollisionCheck(CAreaColliderContext& ctx, const CAreaOctTree& octTree, const zeus::CAABox& aabb,
+                                   const zeus::CSphere& sphere, const CMaterialList& matList,
+                                   const CMaterialFilter& filter, CCollisionInfoList& list);
+
+  static bool MovingAABoxCollisionCheck_Cached(CAreaColliderContext& ctx, const COctreeLeafCache& leafCache,
+                                               const zeus::CAABox& aabb, const CMaterialFilter& filter,
+                                               const CMaterialList& matList, const zeus::CVector3f& dir, float mag,
+                                               CCollisionInfo& infoOut, double& dOut);
+  static bool MovingSphereCollisionCheck_Cached(CAreaColliderContext& ctx, const COctreeLeafCache& leafCache,
+                                                const zeus::CAABox& aabb, const zeus::CSphere& sphere,
+                                                const CMaterialFilter& filter, const CMaterialList& matList,
+                                                const zeus::CVector3f& dir, float mag, CCollisionInfo& infoOut,
+                                                double& dOut);
+
+  /* Context used by the overloads below, one per thread */
+  static CAreaColliderContext& GetDefaultContext();
+
+  static bool ConvexPolyCollision(const std::array<zeus::CPlane, 6>& planes,
+                                  const std::array<zeus::CVector3f, 3>& verts, zeus::CAABox& aabb) {
+    return ConvexPolyCollision(GetDefaultContext(), planes, verts, aabb);
+  }
+
   static bool AABoxCollisionCheckBoolean_Cached(const COctreeLeafCache& leafCache, const zeus::CAABox& aabb,
-                                                const CMaterialFilter& filter);
+                                                const CMaterialFilter& filter) {
+    return AABoxCollisionCheckBoolean_Cached(GetDefaultContext(), leafCache, aabb, filter);
+  }
   static bool AABoxCollisionCheckBoolean(const CAreaOctTree& octTree, const zeus::CAABox& aabb,
-                                         const CMaterialFilter& filter);
+                                         const CMaterialFilter& filter) {
+    return AABoxCollisionCheckBoolean(GetDefaultContext(), octTree, aabb, filter);
+  }
 
   static bool SphereCollisionCheckBoolean_Cached(const COctreeLeafCache& leafCache, const zeus::CAABox& aabb,
-                                                 const zeus::CSphere& sphere, const CMaterialFilter& filter);
+                                                 const zeus::CSphere& sphere, const CMaterialFilter& filter) {
+    return SphereCollisionCheckBoolean_Cached(GetDefaultContext(), leafCache, aabb, sphere, filter);
+  }
   static bool SphereCollisionCheckBoolean(const CAreaOctTree& octTree, const zeus::CAABox& aabb,
-                                          const zeus::CSphere& sphere, const CMaterialFilter& filter);
+                                          const zeus::CSphere& sphere, const CMaterialFilter& filter) {
+    return SphereCollisionCheckBoolean(GetDefaultContext(), octTree, aabb, sphere, filter);
+  }
 
   static bool AABoxCollisionCheck_Cached(const COctreeLeafCache& leafCache, const zeus::CAABox& aabb,
                                          const CMaterialFilter& filter, const CMaterialList& matList,
-                                         CCollisionInfoList& list);
+                                         CCollisionInfoList& list) {
+    return AABoxCollisionCheck_Cached(GetDefaultContext(), leafCache, aabb, filter, matList, list);
+  }
   static bool AABoxCollisionCheck(const CAreaOctTree& octTree, const zeus::CAABox& aabb, const CMaterialFilter& filter,
-                                  const CMaterialList& matList, CCollisionInfoList& list);
+                                  const CMaterialList& matList, CCollisionInfoList& list) {
+    return AABoxCollisionCheck(GetDefaultContext(), octTree, aabb, filter, matList, list);
+  }
 
   static bool SphereCollisionCheck_Cached(const COctreeLeafCache& leafCache, const zeus::CAABox& aabb,
                                           const zeus::CSphere& sphere, const CMaterialList& matList,
-                                          const CMaterialFilter& filter, CCollisionInfoList& list);
+                                          const CMaterialFilter& filter, CCollisionInfoList& list) {
+    return SphereCollisionCheck_Cached(GetDefaultContext(), leafCache, aabb, sphere, matList, filter, list);
+  }
   static bool SphereCollisionCheck(const CAreaOctTree& octTree, const zeus::CAABox& aabb, const zeus::CSphere& sphere,
                                    const CMaterialList& matList, const CMaterialFilter& filter,
-                                   CCollisionInfoList& list);
+                                   CCollisionInfoList& list) {
+    return SphereCollisionCheck(GetDefaultContext(), octTree, aabb, sphere, matList, filter, list);
+  }
 
   static bool MovingAABoxCollisionCheck_Cached(const COctreeLeafCache& leafCache, const zeus::CAABox& aabb,
                                                const CMaterialFilter& filter, const CMaterialList& matList,
                                                const zeus::CVector3f& dir, float mag, CCollisionInfo& infoOut,
-                                               double& dOut);
+                                               double& dOut) {
+    return MovingAABoxCollisionCheck_Cached(GetDefaultContext(), leafCache, aabb, filter, matList, dir, mag, infoOut,
+                                            dOut);
+  }
   static bool MovingSphereCollisionCheck_Cached(const COctreeLeafCache& leafCache, const zeus::CAABox& aabb,
                                                 const zeus::CSphere& sphere, const CMaterialFilter& filter,
                                                 const CMaterialList& matList, const zeus::CVector3f& dir, float mag,
-                                                CCollisionInfo& infoOut, double& dOut);
-  static void ResetInternalCounters();
-  static std::array<u16, 0x4000>& GetTriangleList() { return g_DupTriangleList; }
-  static u16 GetPrimitiveCheckCount() { return g_DupPrimitiveCheckCount; }
+                                                CCollisionInfo& infoOut, double& dOut) {
+    return MovingSphereCollisionCheck_Cached(GetDefaultContext(), leafCache, aabb, sphere, filter, matList, dir, mag,
+                                             infoOut, dOut);
+  }
+  static void ResetInternalCounters() { GetDefaultContext().ResetCounters(); }
+  static std::array<u16, 0x4000>& GetTriangleList() { return GetDefaultContext().GetTriangleList(); }
+  static u16 GetPrimitiveCheckCount() { return GetDefaultContext().GetPrimitiveCheckCount(); }
 };
 
 class CAreaCollisionCache {
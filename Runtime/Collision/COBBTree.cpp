@@ -1,5 +1,6 @@
 #include "Runtime/Collision/COBBTree.hpp"
 
+#include <algorithm>
 #include <array>
 
 #include "Runtime/Collision/CCollidableOBBTreeGroup.hpp"
@@ -51,8 +52,33 @@ COBBTree::COBBTree(CInputStream& in)
 : x0_magic(verify_deaf_babe(in))
 , x4_version(verify_version(in))
 , x8_memsize(in.ReadLong())
-, x18_indexData(in)
-, x88_root(std::make_unique<CNode>(in)) {}
+, x18_indexData(in) {
+  ReadNode(in, 1);
+  x88_nodes.shrink_to_fit();
+  x98_leafSurfaces.shrink_to_fit();
+}
+
+u32 COBBTree::ReadNode(CInputStream& in, u32 depth) {
+  // Written back once the subtree is in, emplace_back may move the array meanwhile
+  const auto idx = u32(x88_nodes.size());
+  CNode node;
+  x88_nodes.emplace_back();
+  node.x0_obb = in.Get<zeus::COBBox>();
+  node.x3c_isLeaf = in.ReadBool();
+  if (node.x3c_isLeaf) {
+    node.x44_leafStart = u32(x98_leafSurfaces.size());
+    node.x48_leafCount = in.ReadLong();
+    for (u32 i = 0; i < node.x48_leafCount; ++i) {
+      x98_leafSurfaces.emplace_back(in.ReadShort());
+    }
+    xa8_depth = std::max(xa8_depth, depth);
+  } else {
+    ReadNode(in, depth + 1);
+    node.x40_rightOffset = ReadNode(in, depth + 1) - idx;
+  }
+  x88_nodes[idx] = node;
+  return idx;
+}
 
 std::unique_ptr<COBBTree> COBBTree::BuildOrientedBoundingBoxTree(const zeus::CVector3f& extent,
                                                                  const zeus::CVector3f& center) {
@@ -72,13 +98,12 @@ std::unique_ptr<COBBTree> COBBTree::BuildOrientedBoundingBoxTree(const zeus::CVe
   for (int i = 0; i < 8; ++i) {
     idxData.x60_vertices.push_back(aabb.getPoint(i));
   }
-  std::vector<u16> surface;
-  surface.reserve(12);
-  for (int i = 0; i < 12; ++i) {
-    surface.push_back(i);
+  ret->x98_leafSurfaces.reserve(12);
+  for (u16 i = 0; i < 12; ++i) {
+    ret->x98_leafSurfaces.push_back(i);
   }
-  ret->x88_root = std::make_unique<CNode>(zeus::CTransform::Translate(center), extent * 0.5f, nullptr, nullptr,
-                                          std::make_unique<CLeafData>(std::move(surface)));
+  ret->x88_nodes.emplace_back(zeus::CTransform::Translate(center), extent * 0.5f, 0, 12);
+  ret->xa8_depth = 1;
   return ret;
 }
 
@@ -151,8 +176,8 @@ CCollisionSurface COBBTree::GetTransformedSurface(u16 idx, const zeus::CTransfor
 zeus::CAABox COBBTree::CalculateLocalAABox() const { return CalculateAABox(zeus::CTransform()); }
 
 zeus::CAABox COBBTree::CalculateAABox(const zeus::CTransform& xf) const {
-  if (x88_root) {
-    return x88_root->GetOBB().calculateAABox(xf);
+  if (!x88_nodes.empty()) {
+    return x88_nodes.front().GetOBB().calculateAABox(xf);
   }
   return zeus::CAABox();
 }
@@ -193,53 +218,7 @@ COBBTree::SIndexData::SIndexData(CInputStream& in) {
   }
 }
 
-COBBTree::CNode::CNode(const zeus::CTransform& xf, const zeus::CVector3f& point, std::unique_ptr<CNode>&& left,
-                       std::unique_ptr<CNode>&& right, std::unique_ptr<CLeafData>&& leaf)
-: x0_obb(xf, point)
-, x3c_isLeaf(leaf != nullptr)
-, x40_left(std::move(left))
-, x44_right(std::move(right))
-, x48_leaf(std::move(leaf)) {}
-
-COBBTree::CNode::CNode(CInputStream& in) {
-  x0_obb = in.Get<zeus::COBBox>();
-  x3c_isLeaf = in.ReadBool();
-  if (x3c_isLeaf)
-    x48_leaf = std::make_unique<CLeafData>(in);
-  else {
-    x40_left = std::make_unique<CNode>(in);
-    x44_right = std::make_unique<CNode>(in);
-  }
-}
-
-size_t COBBTree::CNode::GetMemoryUsage() const {
-  size_t ret = 0;
-  if (x3c_isLeaf)
-    ret = x48_leaf->GetMemoryUsage() + /*sizeof(CNode)*/ 80;
-  else {
-    if (x40_left)
-      ret = x40_left->GetMemoryUsage() + /*sizeof(CNode)*/ 80;
-    if (x44_right)
-      ret += x44_right->GetMemoryUsage();
-  }
-
-  return (ret + 3) & ~3;
-}
-
-COBBTree::CLeafData::CLeafData(std::vector<u16>&& surface) : x0_surface(std::move(surface)) {}
-
-const std::vector<u16>& COBBTree::CLeafData::GetSurfaceVector() const { return x0_surface; }
-
-size_t COBBTree::CLeafData::GetMemoryUsage() const {
-  const size_t ret = (x0_surface.size() * 2) + /*sizeof(CLeafData)*/ 16;
-  return (ret + 3) & ~3;
-}
-
-COBBTree::CLeafData::CLeafData(CInputStream& in) {
-  const u32 edgeCount = in.ReadLong();
-  for (u32 i = 0; i < edgeCount; i++) {
-    x0_surface.emplace_back(in.ReadShort());
-  }
-}
+COBBTree::CNode::CNode(const zeus::CTransform& xf, const zeus::CVector3f& extents, u32 leafStart, u32 leafCount)
+: x0_obb(xf, extents), x3c_isLeaf(true), x44_leafStart(leafStart), x48_leafCount(leafCount) {}
 
 } // namespace metaforce
@@ -2,6 +2,7 @@
 
 #include <array>
 #include <memory>
+#include <span>
 #include <vector>
 
 #include "Runtime/RetroTypes.hpp"
@@ -28,39 +29,24 @@ public:
     explicit SIndexData(CInputStream&);
   };
 
-  class CLeafData {
-    std::vector<u16> x0_surface;
-
-  public:
-    CLeafData() = default;
-    explicit CLeafData(std::vector<u16>&& surface);
-    explicit CLeafData(CInputStream&);
-
-    const std::vector<u16>& GetSurfaceVector() const;
-    size_t GetMemoryUsage() const;
-  };
-
+  /* Metaforce addition: nodes live in one depth-first array owned by the COBBTree. A node's left child is the
+   * node right after it and its right child sits x40_rightOffset entries further on; leaves hold a range of the
+   * tree's shared surface index buffer, read through COBBTree::GetLeafSurfaces. */
   class CNode {
+    friend class COBBTree;
     zeus::COBBox x0_obb;
     bool x3c_isLeaf = false;
-    std::unique_ptr<CNode> x40_left;
-    std::unique_ptr<CNode> x44_right;
-    std::unique_ptr<CLeafData> x48_leaf;
-    bool x4c_hit = false;
+    u32 x40_rightOffset = 0;
+    u32 x44_leafStart = 0;
+    u32 x48_leafCount = 0;
 
   public:
     CNode() = default;
-    CNode(const zeus::CTransform&, const zeus::CVector3f&, std::unique_ptr<CNode>&&, std::unique_ptr<CNode>&&,
-          std::unique_ptr<CLeafData>&&);
-    explicit CNode(CInputStream&);
+    CNode(const zeus::CTransform& xf, const zeus::CVector3f& extents, u32 leafStart, u32 leafCount);
 
-    bool WasHit() const { return x4c_hit; }
-    void SetHit(bool h) { x4c_hit = h; }
-    const CNode& GetLeft() const { return *x40_left; }
-    const CNode& GetRight() const { return *x44_right; }
-    const CLeafData& GetLeafData() const { return *x48_leaf; }
+    const CNode& GetLeft() const { return this[1]; }
+    const CNode& GetRight() const { return this[x40_rightOffset]; }
     const zeus::COBBox& GetOBB() const { return x0_obb; }
-    size_t GetMemoryUsage() const;
     bool IsLeaf() const { return x3c_isLeaf; }
   };
 
@@ -70,7 +56,11 @@ private:
   u32 x8_memsize = 0;
   /* CSimpleAllocator xc_ We're not using this but lets keep track*/
   SIndexData x18_indexData;
-  std::unique_ptr<CNode> x88_root;
+  std::vector<CNode> x88_nodes;
+  std::vector<u16> x98_leafSurfaces;
+  u32 xa8_depth = 0;
+
+  u32 ReadNode(CInputStream& in, u32 depth);
 
 public:
   COBBTree() = default;
@@ -90,7 +80,13 @@ public:
   CCollisionSurface GetTransformedSurface(u16 idx, const zeus::CTransform& xf) const;
   zeus::CAABox CalculateLocalAABox() const;
   zeus::CAABox CalculateAABox(const zeus::CTransform&) const;
-  const CNode& GetRoot() const { return *x88_root; }
+  const CNode& GetRoot() const { return x88_nodes.front(); }
+  std::span<const u16> GetLeafSurfaces(const CNode& leaf) const {
+    return {x98_leafSurfaces.data() + leaf.x44_leafStart, leaf.x48_leafCount};
+  }
+  /* Nodes on the longest path from the root to a leaf */
+  u32 GetDepth() const { return xa8_depth; }
+  std::span<const CNode> GetNodes() const { return x88_nodes; }
   u32 NumSurfaceMaterials() const { return x18_indexData.x30_surfaceMaterials.size(); }
 };
 } // namespace metaforce
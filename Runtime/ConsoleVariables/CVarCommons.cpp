@@ -48,6 +48,9 @@ CVarCommons::CVarCommons(CVarManager& manager) : m_mgr(manager) {
   m_debugOverlayShowResourceStats = m_mgr.findOrMakeCVar(
       "debugOverlay.showResourceStats"sv, "Displays the current live resource object and token counts"sv, false,
       CVar::EFlags::Game | CVar::EFlags::Archive | CVar::EFlags::ReadOnly);
+  m_debugOverlayShowDvdStats = m_mgr.findOrMakeCVar(
+      "debugOverlay.showDvdStats"sv, "Displays DVD request queue depth and latency per priority class"sv, false,
+      CVar::EFlags::Game | CVar::EFlags::Archive | CVar::EFlags::ReadOnly);
   m_debugOverlayShowRandomStats =
       m_mgr.findOrMakeCVar("debugOverlay.showRandomStats", "Displays the current number of random calls per frame"sv,
                            false, CVar::EFlags::Game | CVar::EFlags::Archive | CVar::EFlags::ReadOnly);
@@ -76,6 +79,27 @@ CVarCommons::CVarCommons(CVarManager& manager) : m_mgr(manager) {
                                    CVar::EFlags::System | CVar::EFlags::Archive | CVar::EFlags::ModifyRestart);
   m_lastDiscPath = m_mgr.findOrMakeCVar("lastDiscPath"sv, "Most recently loaded disc image path"sv, ""sv,
                                         CVar::EFlags::System | CVar::EFlags::Archive | CVar::EFlags::Hidden);
+  m_dvdWorkerThreads =
+      m_mgr.findOrMakeCVar("dvdWorkerThreads"sv, "Number of threads servicing asynchronous disc reads"sv, 2,
+                           CVar::EFlags::System | CVar::EFlags::Archive | CVar::EFlags::ModifyRestart);
+  m_dvdMemoryMap =
+      m_mgr.findOrMakeCVar("dvdMemoryMap"sv, "Memory-map raw disc images and read PAK resources in place"sv, true,
+                           CVar::EFlags::System | CVar::EFlags::Archive | CVar::EFlags::ModifyRestart);
+  m_inflateCache = m_mgr.findOrMakeCVar(
+      "inflateCache"sv, "Keep inflated copies of compressed resources on disk to speed up later loads"sv, false,
+      CVar::EFlags::System | CVar::EFlags::Archive | CVar::EFlags::ModifyRestart);
+  m_inflateCacheSizeMB =
+      m_mgr.findOrMakeCVar("inflateCacheSizeMB"sv, "Disk space the inflate cache may use, in MiB"sv, 2048,
+                           CVar::EFlags::System | CVar::EFlags::Archive | CVar::EFlags::ModifyRestart);
+  m_resourceTrace = m_mgr.findOrMakeCVar(
+      "resourceTrace"sv, "Record per-resource load timings and write them to resource_trace.csv on exit"sv, false,
+      CVar::EFlags::System | CVar::EFlags::Archive | CVar::EFlags::ModifyRestart);
+  m_areaPrefetch = m_mgr.findOrMakeCVar(
+      "areaPrefetch"sv, "Stream likely next areas at low disc priority based on player position and heading"sv, true,
+      CVar::EFlags::Game | CVar::EFlags::Archive);
+  m_areaPrefetchBudgetMB =
+      m_mgr.findOrMakeCVar("areaPrefetchBudgetMB"sv, "Memory the area prefetcher may hold in flight, in MiB"sv, 32,
+                           CVar::EFlags::Game | CVar::EFlags::Archive);
   m_instance = this;
 }
 
@@ -36,6 +36,7 @@ struct CVarCommons {
   CVar* m_debugOverlayShowFramerate = nullptr;
   CVar* m_debugOverlayShowInGameTime = nullptr;
   CVar* m_debugOverlayShowResourceStats = nullptr;
+  CVar* m_debugOverlayShowDvdStats = nullptr;
   CVar* m_debugOverlayShowRandomStats = nullptr;
   CVar* m_debugOverlayShowRoomTimer = nullptr;
   CVar* m_debugOverlayShowInput = nullptr;
@@ -48,6 +49,13 @@ struct CVarCommons {
   CVar* m_debugToolDrawPlatformCollision = nullptr;
   CVar* m_logFile = nullptr;
   CVar* m_lastDiscPath = nullptr;
+  CVar* m_dvdWorkerThreads = nullptr;
+  CVar* m_dvdMemoryMap = nullptr;
+  CVar* m_inflateCache = nullptr;
+  CVar* m_inflateCacheSizeMB = nullptr;
+  CVar* m_resourceTrace = nullptr;
+  CVar* m_areaPrefetch = nullptr;
+  CVar* m_areaPrefetchBudgetMB = nullptr;
 
   CVarCommons(CVarManager& manager);
 
@@ -75,6 +83,20 @@ struct CVarCommons {
 
   void setVariableFrameTime(bool b) { m_variableDt->fromBoolean(b); }
 
+  uint32_t getDvdWorkerThreads() const { return std::max(1u, m_dvdWorkerThreads->toUnsigned()); }
+
+  bool getDvdMemoryMap() const { return m_dvdMemoryMap->toBoolean(); }
+
+  bool getInflateCache() const { return m_inflateCache->toBoolean(); }
+
+  uint64_t getInflateCacheSize() const { return uint64_t(m_inflateCacheSizeMB->toUnsigned()) << 20; }
+
+  bool getResourceTrace() const { return m_resourceTrace->toBoolean(); }
+
+  bool getAreaPrefetch() const { return m_areaPrefetch->toBoolean(); }
+
+  uint32_t getAreaPrefetchBudget() const { return std::min(m_areaPrefetchBudgetMB->toUnsigned(), 1024u) << 20; }
+
   std::string getLogFile() const { return m_logFile->toLiteral(); };
 
   void setLogFile(std::string_view log) { m_logFile->fromLiteral(log); }
@@ -12,7 +12,9 @@ class CFactoryMgr;
 class CObjectReference;
 class CResLoader;
 class CSimplePool;
+struct SMappedView;
 class CVParamTransfer;
+enum class EDvdPriority;
 class IDvdRequest;
 class IObj;
 
@@ -23,6 +25,11 @@ using FFactoryFunc =
 using FMemFactoryFunc =
     std::function<CFactoryFnReturn(const metaforce::SObjectTag& tag, std::unique_ptr<u8[]>&& in, u32 len,
                                    const metaforce::CVParamTransfer& vparms, CObjectReference* selfRef)>;
+/* Metaforce addition: builds in place from an uncompressed resource in a memory-mapped PAK. Objects that keep
+ * pointers into the bytes must also keep view.x0_mapping. */
+using FViewFactoryFunc =
+    std::function<CFactoryFnReturn(const metaforce::SObjectTag& tag, const metaforce::SMappedView& view,
+                                   const metaforce::CVParamTransfer& vparms, CObjectReference* selfRef)>;
 
 class IFactory {
 public:
@@ -39,6 +46,15 @@ public:
   virtual CResLoader* GetResLoader() { return nullptr; }
   virtual CFactoryMgr* GetFactoryMgr() { return nullptr; }
   virtual bool AsyncIdle(std::chrono::nanoseconds target) { return false; }
+  /* Disc priority for reads issued by subsequent BuildAsync calls */
+  virtual void SetBuildPriority(EDvdPriority priority) {}
+  /* Promotes an in-flight async build whose read has not been serviced yet */
+  virtual void RaiseBuildPriority(const SObjectTag& tag, EDvdPriority priority) {}
+  /* Sort key matching the order the disc services reads in, so batch loads can be issued front to back */
+  virtual u64 GetLoadOrder(const SObjectTag& tag) const { return 0; }
+  /* Brackets a run of BuildAsync calls whose reads should reach the disc scheduler together */
+  virtual void BeginBuildBatch() {}
+  virtual void EndBuildBatch() {}
 
   /* Non-factory versions, replaces CResLoader */
   virtual u32 ResourceSize(const metaforce::SObjectTag& tag) = 0;
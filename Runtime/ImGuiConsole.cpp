@@ -10,6 +10,7 @@
 #include "../version.h"
 #include "MP1/MP1.hpp"
 #include "Runtime/CStateManager.hpp"
+#include "Runtime/ConsoleVariables/FileStoreManager.hpp"
 #include "Runtime/GameGlobalObjects.hpp"
 #include "Runtime/ImGuiEntitySupport.hpp"
 #include "Runtime/World/CPlayer.hpp"
@@ -20,7 +21,10 @@
 #include <nfd.hpp>
 #endif
 
+#include <cfloat>
+#include <chrono>
 #include <cstdarg>
+#include <numeric>
 
 #include <zeus/CEulerAngles.hpp>
 
@@ -46,7 +50,7 @@ extern size_t g_lastStorageSize;
 namespace metaforce {
 static logvisor::Module Log{"Console"};
 
-std::array<ImGuiEntityEntry, kMaxEntities> ImGuiConsole::entities;
+std::vector<ImGuiEntityEntry> ImGuiConsole::entities;
 std::set<TUniqueId> ImGuiConsole::inspectingEntities;
 ImGuiPlayerLoadouts ImGuiConsole::loadouts;
 
@@ -200,12 +204,25 @@ void ImGuiConsole::LerpDebugColor(CActor* act) {
   act->m_debugAddColor = zeus::CColor::lerp(zeus::skClear, zeus::skBlue, lerp);
 }
 
+ImGuiEntityEntry* ImGuiConsole::FindEntityEntry(TUniqueId uid) {
+  if (uid == kInvalidUniqueId || uid.Value() >= entities.size()) {
+    return nullptr;
+  }
+  return &entities[uid.Value()];
+}
+
 void ImGuiConsole::UpdateEntityEntries() {
   CObjectList& list = g_StateManager->GetAllObjectList();
   s16 uid = list.GetFirstObjectIndex();
   while (uid != -1) {
+    if (size_t(uid) >= entities.size()) {
+      entities.resize(uid + 1);
+    }
     ImGuiEntityEntry& entry = ImGuiConsole::entities[uid];
     if (entry.uid == kInvalidUniqueId || entry.ent == nullptr) {
+      if (entry.uid == kInvalidUniqueId) {
+        m_entityEntryIds.push_back(uid);
+      }
       CEntity* ent = list.GetObjectByIndex(uid);
       entry.uid = ent->GetUniqueId();
       entry.ent = ent;
@@ -392,10 +409,11 @@ void ImGuiConsole::ShowInspectWindow(bool* isOpen) {
 
 bool ImGuiConsole::ShowEntityInfoWindow(TUniqueId uid) {
   bool open = true;
-  ImGuiEntityEntry& entry = ImGuiConsole::entities[uid.Value()];
-  if (entry.ent == nullptr) {
+  ImGuiEntityEntry* found = FindEntityEntry(uid);
+  if (found == nullptr || found->ent == nullptr) {
     return false;
   }
+  ImGuiEntityEntry& entry = *found;
   auto name = fmt::format(FMT_STRING("{}##0x{:04X}"), !entry.name.empty() ? entry.name : entry.type, uid.Value());
   if (ImGui::Begin(name.c_str(), &open, ImGuiWindowFlags_AlwaysAutoResize)) {
     ImGui::PushID(uid.Value());
@@ -814,7 +832,8 @@ static std::string BytesToString(size_t bytes) {
 
 void ImGuiConsole::ShowDebugOverlay() {
   if (!m_frameCounter && !m_frameRate && !m_inGameTime && !m_roomTimer && !m_playerInfo && !m_areaInfo &&
-      !m_worldInfo && !m_randomStats && !m_resourceStats && !m_pipelineInfo && !m_drawCallInfo && !m_bufferInfo) {
+      !m_worldInfo && !m_randomStats && !m_resourceStats && !m_dvdStats && !m_pipelineInfo && !m_drawCallInfo &&
+      !m_bufferInfo) {
     return;
   }
   ImGuiIO& io = ImGui::GetIO();
@@ -970,6 +989,45 @@ void ImGuiConsole::ShowDebugOverlay() {
       hasPrevious = true;
 
       ImGuiStringViewText(fmt::format(FMT_STRING("Resource Objects: {}\n"), g_SimplePool->GetLiveObjects()));
+      const auto inflateStats = CFactoryMgr::GetInflateStats();
+      ImGuiStringViewText(fmt::format(FMT_STRING("Inflated: {} ({} -> {}) in {:.2f}ms\n"), inflateStats.count,
+                                      BytesToString(inflateStats.compressedBytes),
+                                      BytesToString(inflateStats.inflatedBytes),
+                                      std::chrono::duration<double, std::milli>(inflateStats.time).count()));
+      const auto& areaStats = CGameArea::GetPostConstructStats();
+      if (areaStats.areaCount != 0) {
+        const auto toMs = [](std::chrono::nanoseconds time) {
+          return std::chrono::duration<double, std::milli>(time).count();
+        };
+        ImGuiStringViewText(fmt::format(FMT_STRING("Area post-construct: {} areas, last {:.2f}ms, avg {:.2f}ms\n"),
+                                        areaStats.areaCount, toMs(areaStats.lastWallTime),
+                                        toMs(areaStats.totalWallTime) / areaStats.areaCount));
+        constexpr std::array<std::string_view, size_t(CGameArea::EPostConstructSection::MAX)> SectionNames{
+            "Render octree", "Collision", "Lights", "PVS", "Path"};
+        for (size_t i = 0; i < SectionNames.size(); ++i) {
+          ImGuiStringViewText(fmt::format(FMT_STRING("  {:13}: last {:6.2f}ms avg {:6.2f}ms max {:6.2f}ms\n"),
+                                          SectionNames[i], toMs(areaStats.lastTimes[i]),
+                                          toMs(areaStats.totalTimes[i]) / areaStats.areaCount,
+                                          toMs(areaStats.maxTimes[i])));
+        }
+      }
+    }
+    if (m_dvdStats) {
+      if (hasPrevious) {
+        ImGui::Separator();
+      }
+      hasPrevious = true;
+
+      constexpr std::array<std::string_view, size_t(EDvdPriority::MAX)> ClassNames{"Audio", "Movie", "Area",
+                                                                                   "Prefetch"};
+      for (size_t i = 0; i < ClassNames.size(); ++i) {
+        const SDvdQueueStats stats = CDvdFile::GetQueueStats(EDvdPriority(i));
+        ImGuiStringViewText(fmt::format(FMT_STRING("DVD {:8}: depth {:3} (max {:3}), done {:3}, coalesced {:3}, "
+                                                   "latency avg {:6.2f}ms max {:6.2f}ms\n"),
+                                        ClassNames[i], stats.queueDepth, stats.maxQueueDepth, stats.completed,
+                                        stats.coalesced, stats.avgLatency.count() / 1000.0,
+                                        stats.maxLatency.count() / 1000.0));
+      }
     }
     if (m_pipelineInfo && m_developer) {
       if (hasPrevious) {
@@ -1257,7 +1315,10 @@ void ImGuiConsole::ShowAppMainMenuBar(bool canInspect, bool preLaunch) {
         ImGui::MenuItem("Console Variables", nullptr, &m_showConsoleVariablesWindow);
         ImGui::MenuItem("Inspect", nullptr, &m_showInspectWindow, canInspect);
         ImGui::MenuItem("Layers", nullptr, &m_showLayersWindow, canInspect);
+        ImGui::MenuItem("Script Messages", nullptr, &m_showScriptMessagesWindow, canInspect);
+        ImGui::MenuItem("Entity Profiler", nullptr, &m_showEntityProfilerWindow, canInspect);
         ImGui::MenuItem("Player Transform", nullptr, &m_showPlayerTransformEditor, canInspect && m_cheats);
+        ImGui::MenuItem("Pose Snapshots", nullptr, &m_showPoseSnapshotsWindow, canInspect && m_cheats);
       }
       ImGui::EndMenu();
     }
@@ -1272,6 +1333,7 @@ void ImGuiConsole::ShowAppMainMenuBar(bool canInspect, bool preLaunch) {
       ImGuiCVarMenuItem("Layer Info", m_cvarCommons.m_debugOverlayLayerInfo, m_layerInfo);
       ImGuiCVarMenuItem("Random Stats", m_cvarCommons.m_debugOverlayShowRandomStats, m_randomStats);
       ImGuiCVarMenuItem("Resource Stats", m_cvarCommons.m_debugOverlayShowResourceStats, m_resourceStats);
+      ImGuiCVarMenuItem("DVD Stats", m_cvarCommons.m_debugOverlayShowDvdStats, m_dvdStats);
       ImGuiCVarMenuItem("Show Input", m_cvarCommons.m_debugOverlayShowInput, m_showInput);
 #if 0 // Currently unimplemented
       ImGui::Separator();
@@ -1325,6 +1387,7 @@ void ImGuiConsole::PreUpdate() {
     m_cvarCommons.m_debugOverlayLayerInfo->addListener([this](CVar* c) { m_layerInfo = c->toBoolean(); });
     m_cvarCommons.m_debugOverlayShowRandomStats->addListener([this](CVar* c) { m_randomStats = c->toBoolean(); });
     m_cvarCommons.m_debugOverlayShowResourceStats->addListener([this](CVar* c) { m_resourceStats = c->toBoolean(); });
+    m_cvarCommons.m_debugOverlayShowDvdStats->addListener([this](CVar* c) { m_dvdStats = c->toBoolean(); });
     m_cvarCommons.m_debugOverlayShowInput->addListener([this](CVar* c) { m_showInput = c->toBoolean(); });
     m_cvarCommons.m_debugToolDrawAiPath->addListener([this](CVar* c) { m_drawAiPath = c->toBoolean(); });
     m_cvarCommons.m_debugToolDrawCollisionActors->addListener(
@@ -1389,6 +1452,19 @@ void ImGuiConsole::PreUpdate() {
   if (canInspect && m_showLayersWindow) {
     ShowLayersWindow();
   }
+  if (g_StateManager != nullptr) {
+    // Sender classes cost a lookup per message, so only count them while someone is looking
+    g_StateManager->SetScriptMsgSenderStats(canInspect && m_showScriptMessagesWindow);
+  }
+  if (canInspect && m_showScriptMessagesWindow) {
+    ShowScriptMessagesWindow();
+  }
+  if (canInspect && m_showEntityProfilerWindow) {
+    ShowEntityProfilerWindow();
+  }
+  if (canInspect && m_showPoseSnapshotsWindow) {
+    ShowPoseSnapshotsWindow();
+  }
   if (preLaunch || m_showAboutWindow) {
     ShowAboutWindow(preLaunch);
   }
@@ -1411,23 +1487,25 @@ void ImGuiConsole::PreUpdate() {
 void ImGuiConsole::PostUpdate() {
   OPTICK_EVENT();
   if (g_StateManager != nullptr && g_StateManager->GetObjectList()) {
-    // Clear deleted objects
+    // Clear deleted objects; only entries filled in by UpdateEntityEntries need checking
     CObjectList& list = g_StateManager->GetAllObjectList();
-    for (s16 uid = 0; uid < s16(entities.size()); uid++) {
+    std::erase_if(m_entityEntryIds, [&](s16 uid) {
       ImGuiEntityEntry& item = entities[uid];
-      if (item.uid == kInvalidUniqueId) {
-        continue; // already cleared
-      }
       CEntity* ent = list.GetObjectByIndex(uid);
-      if (ent == nullptr || ent != item.ent) {
-        // Remove inspect windows for deleted entities
-        inspectingEntities.erase(item.uid);
-        item.uid = kInvalidUniqueId;
-        item.ent = nullptr; // for safety
-      }
-    }
+      if (ent != nullptr && ent == item.ent) {
+        return false;
+      }
+      // Remove inspect windows for deleted entities
+      inspectingEntities.erase(item.uid);
+      item.uid = kInvalidUniqueId;
+      item.ent = nullptr; // for safety
+      return true;
+    });
   } else {
-    entities.fill(ImGuiEntityEntry{});
+    for (const s16 uid : m_entityEntryIds) {
+      entities[uid] = ImGuiEntityEntry{};
+    }
+    m_entityEntryIds.clear();
     inspectingEntities.clear();
   }
 
@@ -1727,6 +1805,211 @@ void ImGuiConsole::ShowLayersWindow() {
   ImGui::End();
 }
 
+void ImGuiConsole::ShowScriptMessagesWindow() {
+  float initialWindowSize = 350.f * GetScale();
+  ImGui::SetNextWindowSize(ImVec2{initialWindowSize, initialWindowSize}, ImGuiCond_FirstUseEver);
+
+  if (ImGui::Begin("Script Messages", &m_showScriptMessagesWindow)) {
+    const SScriptMsgStats& stats = g_StateManager->GetScriptMsgStats();
+    ImGuiStringViewText(fmt::format(FMT_STRING("Last frame: {} delivered, nested at most {} deep"), stats.x100_total,
+                                    stats.x104_deepestChain));
+
+    const auto showTable = [](const char* id, const char* label, std::vector<std::pair<std::string_view, u32>>& rows) {
+      std::sort(rows.begin(), rows.end(), [](const auto& a, const auto& b) {
+        return a.second != b.second ? a.second > b.second : a.first < b.first;
+      });
+      if (ImGui::BeginTable(id, 2, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV)) {
+        ImGui::TableSetupColumn(label, ImGuiTableColumnFlags_WidthStretch);
+        ImGui::TableSetupColumn("Count", ImGuiTableColumnFlags_WidthFixed);
+        ImGui::TableHeadersRow();
+        for (const auto& [name, count] : rows) {
+          ImGui::TableNextRow();
+          if (ImGui::TableNextColumn()) {
+            ImGuiStringViewText(name);
+          }
+          if (ImGui::TableNextColumn()) {
+            ImGuiStringViewText(fmt::format(FMT_STRING("{}"), count));
+          }
+        }
+        ImGui::EndTable();
+      }
+    };
+
+    std::vector<std::pair<std::string_view, u32>> rows;
+    if (ImGui::CollapsingHeader("By Message", ImGuiTreeNodeFlags_DefaultOpen)) {
+      for (size_t i = 0; i < stats.x0_perMessage.size(); ++i) {
+        if (stats.x0_perMessage[i] != 0) {
+          rows.emplace_back(ScriptObjectMessageToStr(EScriptObjectMessage(s32(i) - 1)), stats.x0_perMessage[i]);
+        }
+      }
+      showTable("By Message", "Message", rows);
+    }
+    if (ImGui::CollapsingHeader("By Sender", ImGuiTreeNodeFlags_DefaultOpen)) {
+      rows.assign(stats.xc8_perSender.cbegin(), stats.xc8_perSender.cend());
+      showTable("By Sender", "Sender", rows);
+    }
+  }
+  ImGui::End();
+}
+
+void ImGuiConsole::ShowEntityProfilerWindow() {
+  float initialWindowSize = 500.f * GetScale();
+  ImGui::SetNextWindowSize(ImVec2{initialWindowSize, initialWindowSize}, ImGuiCond_FirstUseEver);
+
+  if (ImGui::Begin("Entity Profiler", &m_showEntityProfilerWindow)) {
+    if (CVar* entityProfiler = m_cvarMgr.findCVar("stateManager.entityProfiler")) {
+      bool enabled = entityProfiler->toBoolean();
+      if (ImGui::Checkbox("Enabled", &enabled)) {
+        entityProfiler->fromBoolean(enabled);
+      }
+    }
+
+    const CEntityProfiler& profiler = g_StateManager->GetEntityProfiler();
+    const auto& classes = profiler.GetClasses();
+    ImGui::SameLine();
+    if (ImGui::Button("Save CSV")) {
+      const std::string path =
+          fmt::format(FMT_STRING("{}/entity_profile.csv"), FileStoreManager::instance()->getStoreRoot());
+      if (profiler.WriteCSV(path)) {
+        m_toasts.emplace_back(fmt::format(FMT_STRING("Saved {}"), path), 5.f);
+      }
+    }
+
+    const CEntityProfiler::SClassStats* selected = nullptr;
+    for (const auto& stats : classes) {
+      if (stats.x0_name == m_entityProfilerSelected) {
+        selected = &stats;
+      }
+    }
+    std::array<float, CEntityProfiler::kHistoryFrames> history;
+    profiler.GetHistoryMs(selected, history);
+    const std::string label = fmt::format(FMT_STRING("{} ms per frame over the last {} frames"),
+                                          selected != nullptr ? selected->x0_name : "All classes"sv,
+                                          profiler.GetFrameCount());
+    ImGui::PlotHistogram("##history", history.data(), int(history.size()), 0, label.c_str(), 0.f, FLT_MAX,
+                         ImVec2{-1.f, 80.f * GetScale()});
+
+    // Column 0 is the class, then the total, one column per event, and the call count
+    constexpr int columnCount = int(CEntityProfiler::kEventCount) + 3;
+    if (ImGui::BeginTable("Classes", columnCount,
+                          ImGuiTableFlags_Resizable | ImGuiTableFlags_Sortable | ImGuiTableFlags_RowBg |
+                              ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV | ImGuiTableFlags_ScrollX |
+                              ImGuiTableFlags_ScrollY)) {
+      ImGui::TableSetupColumn("Class", ImGuiTableColumnFlags_WidthFixed);
+      ImGui::TableSetupColumn("Total ms",
+                              ImGuiTableColumnFlags_DefaultSort | ImGuiTableColumnFlags_PreferSortDescending |
+                                  ImGuiTableColumnFlags_WidthFixed);
+      for (size_t i = 0; i < CEntityProfiler::kEventCount; ++i) {
+        const std::string name = std::string(CEntityProfiler::EventName(EEntityProfileEvent(i)));
+        ImGui::TableSetupColumn(name.c_str(),
+                                ImGuiTableColumnFlags_PreferSortDescending | ImGuiTableColumnFlags_WidthFixed);
+      }
+      ImGui::TableSetupColumn("Calls", ImGuiTableColumnFlags_PreferSortDescending | ImGuiTableColumnFlags_WidthFixed);
+      ImGui::TableSetupScrollFreeze(1, 1);
+      ImGui::TableHeadersRow();
+
+      const auto calls = [](const CEntityProfiler::SClassStats& stats) {
+        return std::accumulate(stats.x58_windowCalls.cbegin(), stats.x58_windowCalls.cend(), u64(0));
+      };
+      std::vector<const CEntityProfiler::SClassStats*> rows;
+      rows.reserve(classes.size());
+      for (const auto& stats : classes) {
+        rows.push_back(&stats);
+      }
+      const ImGuiTableSortSpecs* sortSpecs = ImGui::TableGetSortSpecs();
+      if (sortSpecs != nullptr && sortSpecs->SpecsCount == 1) {
+        const ImGuiTableColumnSortSpecs& spec = sortSpecs->Specs[0];
+        const bool ascending = spec.SortDirection == ImGuiSortDirection_Ascending;
+        std::stable_sort(rows.begin(), rows.end(), [&](const auto* a, const auto* b) {
+          if (spec.ColumnIndex == 0) {
+            return ascending ? a->x0_name < b->x0_name : a->x0_name > b->x0_name;
+          }
+          u64 valueA = 0;
+          u64 valueB = 0;
+          if (spec.ColumnIndex == 1) {
+            valueA = a->GetWindowNanos();
+            valueB = b->GetWindowNanos();
+          } else if (spec.ColumnIndex == columnCount - 1) {
+            valueA = calls(*a);
+            valueB = calls(*b);
+          } else {
+            valueA = a->x20_windowNanos[spec.ColumnIndex - 2];
+            valueB = b->x20_windowNanos[spec.ColumnIndex - 2];
+          }
+          return ascending ? valueA < valueB : valueA > valueB;
+        });
+      }
+
+      // Per-frame averages over the history
+      const double frames = double(std::max<size_t>(profiler.GetFrameCount(), 1));
+      const auto msText = [&](u64 nanos) {
+        ImGuiStringViewText(fmt::format(FMT_STRING("{:.3f}"), double(nanos) / 1000000.0 / frames));
+      };
+      for (const auto* stats : rows) {
+        ImGui::TableNextRow();
+        if (ImGui::TableNextColumn()) {
+          if (ImGui::Selectable(stats->x0_name.c_str(), stats->x0_name == m_entityProfilerSelected,
+                                ImGuiSelectableFlags_SpanAllColumns)) {
+            m_entityProfilerSelected = stats->x0_name == m_entityProfilerSelected ? std::string() : stats->x0_name;
+          }
+        }
+        if (ImGui::TableNextColumn()) {
+          msText(stats->GetWindowNanos());
+        }
+        for (size_t i = 0; i < CEntityProfiler::kEventCount; ++i) {
+          if (ImGui::TableNextColumn()) {
+            msText(stats->x20_windowNanos[i]);
+          }
+        }
+        if (ImGui::TableNextColumn()) {
+          ImGuiStringViewText(fmt::format(FMT_STRING("{:.1f}"), double(calls(*stats)) / frames));
+        }
+      }
+      ImGui::EndTable();
+    }
+  }
+  ImGui::End();
+}
+
+void ImGuiConsole::ShowPoseSnapshotsWindow() {
+  if (ImGui::Begin("Pose Snapshots", &m_showPoseSnapshotsWindow, ImGuiWindowFlags_AlwaysAutoResize)) {
+    using Clock = std::chrono::steady_clock;
+    const auto toMs = [](Clock::duration time) { return std::chrono::duration<double, std::milli>(time).count(); };
+    if (ImGui::Button("Capture")) {
+      const auto start = Clock::now();
+      if (m_snapshot.Capture(*g_StateManager)) {
+        const double time = toMs(Clock::now() - start);
+        m_snapshotStatus = fmt::format(FMT_STRING("Captured {} actor poses ({} bytes) in {:.3f} ms"),
+                                       m_snapshot.GetActorCount(), m_snapshot.GetSizeBytes(), time);
+      } else {
+        m_snapshotStatus = "No world loaded";
+      }
+    }
+    if (m_snapshot.IsValid()) {
+      ImGui::SameLine();
+      if (ImGui::Button("Restore")) {
+        const auto start = Clock::now();
+        CPoseSnapshot::SRestoreStats stats;
+        if (m_snapshot.Restore(*g_StateManager, &stats)) {
+          const double time = toMs(Clock::now() - start);
+          m_snapshotStatus = fmt::format(FMT_STRING("Restored {} poses in {:.3f} ms, {} actors since freed"),
+                                         stats.x0_restored, time, stats.x4_missing);
+        } else {
+          m_snapshotStatus = "Snapshot is from another world";
+        }
+      }
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Benchmark")) {
+      m_snapshotStatus = CPoseSnapshot::Benchmark(*g_StateManager, 100);
+    }
+    if (!m_snapshotStatus.empty()) {
+      ImGuiStringViewText(m_snapshotStatus);
+    }
+  }
+  ImGui::End();
+}
+
 void ImGuiConsole::ShowToasts() {
   if (m_toasts.empty()) {
     return;
@@ -3,6 +3,7 @@
 #include <set>
 #include <string_view>
 
+#include "Runtime/CPoseSnapshot.hpp"
 #include "Runtime/RetroTypes.hpp"
 #include "Runtime/World/CActor.hpp"
 #include "Runtime/World/CEntity.hpp"
@@ -48,7 +49,10 @@ struct Toast {
 class ImGuiConsole {
 public:
   static std::set<TUniqueId> inspectingEntities;
-  static std::array<ImGuiEntityEntry, kMaxEntities> entities;
+  // Metaforce addition: grows to the highest unique id value listed rather than holding kMaxEntities entries
+  static std::vector<ImGuiEntityEntry> entities;
+  // The entry for uid's value, or nullptr if no entity with that value has been listed yet
+  static ImGuiEntityEntry* FindEntityEntry(TUniqueId uid);
   static ImGuiPlayerLoadouts loadouts;
 
   ImGuiConsole(CVarManager& cvarMgr, CVarCommons& cvarCommons);
@@ -76,11 +80,16 @@ private:
   bool m_showAboutWindow = false;
   bool m_showItemsWindow = false;
   bool m_showLayersWindow = false;
+  bool m_showScriptMessagesWindow = false;
+  bool m_showEntityProfilerWindow = false;
   bool m_showConsoleVariablesWindow = false;
   bool m_showPlayerTransformEditor = false;
+  bool m_showPoseSnapshotsWindow = false;
   bool m_showPreLaunchSettingsWindow = false;
   std::optional<zeus::CVector3f> m_savedLocation;
   std::optional<zeus::CEulerAngles> m_savedRotation;
+  CPoseSnapshot m_snapshot;
+  std::string m_snapshotStatus;
 
   bool m_paused = false;
   bool m_stepFrame = false;
@@ -92,6 +101,7 @@ private:
   std::string m_inspectFilterText;
   std::string m_layersFilterText;
   std::string m_cvarFiltersText;
+  std::string m_entityProfilerSelected;
   std::string m_lastDiscPath = m_cvarCommons.m_lastDiscPath->toLiteral();
 
   // Debug overlays
@@ -109,6 +119,7 @@ private:
   bool m_layerInfo = m_cvarCommons.m_debugOverlayLayerInfo->toBoolean();
   bool m_randomStats = m_cvarCommons.m_debugOverlayShowRandomStats->toBoolean();
   bool m_resourceStats = m_cvarCommons.m_debugOverlayShowResourceStats->toBoolean();
+  bool m_dvdStats = m_cvarCommons.m_debugOverlayShowDvdStats->toBoolean();
   bool m_showInput = m_cvarCommons.m_debugOverlayShowInput->toBoolean();
   bool m_drawAiPath = m_cvarCommons.m_debugToolDrawAiPath->toBoolean();
   bool m_drawCollisionActors = m_cvarCommons.m_debugToolDrawCollisionActors->toBoolean();
@@ -140,6 +151,8 @@ private:
 
   bool m_controllerConfigVisible = false;
   ImGuiControllerConfig m_controllerConfig;
+  // Indices of the populated entries in entities, so per-frame cleanup scales with live entities, not kMaxEntities
+  std::vector<s16> m_entityEntryIds;
 
   void ShowAboutWindow(bool preLaunch);
   void ShowAppMainMenuBar(bool canInspect, bool preLaunch);
@@ -151,12 +164,15 @@ private:
   void ShowDebugOverlay();
   void ShowItemsWindow();
   void ShowLayersWindow();
+  void ShowScriptMessagesWindow();
+  void ShowEntityProfilerWindow();
   void ShowConsoleVariablesWindow();
   void ShowToasts();
   void ShowInputViewer();
   void SetOverlayWindowLocation(int corner) const;
   bool ShowCornerContextMenu(int& corner, int avoidCorner) const;
   void ShowPlayerTransformEditor();
+  void ShowPoseSnapshotsWindow();
   void ShowPipelineProgress();
   void ShowPreLaunchSettingsWindow();
 };
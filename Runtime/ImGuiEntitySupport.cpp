@@ -260,7 +260,8 @@ void CDamageVulnerability::ImGuiEditWindow(const char* title, bool& open) {
 
 void ImGuiUniqueId(const char* label, TUniqueId uid) {
   ImGui::PushID(uid.Value());
-  if (uid != kInvalidUniqueId && ImGuiConsole::entities[uid.Value()].ent != nullptr) {
+  const ImGuiEntityEntry* listed = ImGuiConsole::FindEntityEntry(uid);
+  if (listed != nullptr && listed->ent != nullptr) {
     ImGui::Text("%s: 0x%04" PRIX16, label, uid.Value());
     ImGui::SameLine();
     if (ImGui::SmallButton("View")) {
@@ -294,10 +295,11 @@ void CEntity::ImGuiInspect() {
           if (uid == kInvalidUniqueId) {
             continue;
           }
-          ImGuiEntityEntry& entry = ImGuiConsole::entities[uid.Value()];
-          if (entry.uid == kInvalidUniqueId) {
+          ImGuiEntityEntry* found = ImGuiConsole::FindEntityEntry(uid);
+          if (found == nullptr || found->uid == kInvalidUniqueId) {
             continue;
           }
+          ImGuiEntityEntry& entry = *found;
           ImGuiConsole::BeginEntityRow(entry);
           if (ImGui::TableNextColumn()) {
             ImGuiStringViewText(entry.type);
@@ -317,7 +319,7 @@ void CEntity::ImGuiInspect() {
       ImGui::EndTable();
     }
   }
-  if (m_incomingConnections != nullptr && ImGui::CollapsingHeader("Incoming Connections")) {
+  if (!m_incomingConnections.empty() && ImGui::CollapsingHeader("Incoming Connections")) {
     if (ImGui::BeginTable("Incoming Connections", 6,
                           ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV)) {
       ImGui::TableSetupColumn("ID", ImGuiTableColumnFlags_WidthFixed, 0, 'id');
@@ -329,17 +331,18 @@ void CEntity::ImGuiInspect() {
                                       ImGuiTableColumnFlags_NoResize);
       ImGui::TableSetupScrollFreeze(0, 1);
       ImGui::TableHeadersRow();
-      for (const auto& item : *m_incomingConnections) {
+      for (const auto& item : m_incomingConnections) {
         const auto search = g_StateManager->GetIdListForScript(item.x8_objId);
         for (auto it = search.first; it != search.second; ++it) {
           auto uid = it->second;
           if (uid == kInvalidUniqueId) {
             continue;
           }
-          ImGuiEntityEntry& entry = ImGuiConsole::entities[uid.Value()];
-          if (entry.uid == kInvalidUniqueId) {
+          ImGuiEntityEntry* found = ImGuiConsole::FindEntityEntry(uid);
+          if (found == nullptr || found->uid == kInvalidUniqueId) {
             continue;
           }
+          ImGuiEntityEntry& entry = *found;
           ImGuiConsole::BeginEntityRow(entry);
           if (ImGui::TableNextColumn()) {
             ImGuiStringViewText(entry.type);
@@ -526,10 +529,11 @@ IMGUI_ENTITY_INSPECT(CTeamAiMgr, CEntity, TeamAiMgr, {
         if (uid == kInvalidUniqueId) {
           continue;
         }
-        ImGuiEntityEntry& entry = ImGuiConsole::entities[uid.Value()];
-        if (entry.uid == kInvalidUniqueId) {
+        ImGuiEntityEntry* found = ImGuiConsole::FindEntityEntry(uid);
+        if (found == nullptr || found->uid == kInvalidUniqueId) {
           continue;
         }
+        ImGuiEntityEntry& entry = *found;
         ImGuiConsole::BeginEntityRow(entry);
         if (ImGui::TableNextColumn()) {
           ImGuiStringViewText(entry.type);
@@ -556,10 +560,11 @@ IMGUI_ENTITY_INSPECT(CTeamAiMgr, CEntity, TeamAiMgr, {
         if (uid == kInvalidUniqueId) {
           continue;
         }
-        ImGuiEntityEntry& entry = ImGuiConsole::entities[uid.Value()];
-        if (entry.uid == kInvalidUniqueId) {
+        ImGuiEntityEntry* found = ImGuiConsole::FindEntityEntry(uid);
+        if (found == nullptr || found->uid == kInvalidUniqueId) {
           continue;
         }
+        ImGuiEntityEntry& entry = *found;
         ImGuiConsole::BeginEntityRow(entry);
         if (ImGui::TableNextColumn()) {
           ImGuiStringViewText(entry.type);
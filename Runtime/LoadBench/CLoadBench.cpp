@@ -0,0 +1,240 @@
+#include "Runtime/LoadBench/CLoadBench.hpp"
+
+#include <algorithm>
+
+#include "Runtime/CDvdFile.hpp"
+#include "Runtime/CFactoryMgr.hpp"
+#include "Runtime/GameGlobalObjects.hpp"
+#include "Runtime/IMain.hpp"
+#include "Runtime/Streams/CMemoryInStream.hpp"
+#include "Runtime/Streams/IOStreams.hpp"
+
+#include <logvisor/logvisor.hpp>
+
+namespace metaforce {
+namespace {
+logvisor::Module Log("metaforce::CLoadBench");
+
+constexpr u32 MlvlMagic = 0xDEAFBABE;
+/* Upper bound on one AsyncIdle call; the loop spins on it, so this only bounds how often completions dispatch */
+constexpr std::chrono::milliseconds PumpSlice{2};
+
+/* Only what CAssetId's stream constructor and the resource pipeline ask g_Main for; the bench reads MP1 data */
+class CLoadBenchMain final : public IMain {
+public:
+  std::string Init(int, char**, const FileStoreManager&, CVarManager*, boo::IAudioVoiceEngine*,
+                   amuse::IBackendVoiceAllocator&) override {
+    return {};
+  }
+  void Draw() override {}
+  bool Proc(float) override { return true; }
+  void Shutdown() override {}
+  EClientFlowStates GetFlowState() const override { return EClientFlowStates::None; }
+  void SetFlowState(EClientFlowStates) override {}
+  size_t GetExpectedIdSize() const override { return sizeof(u32); }
+  EGame GetGame() const override { return EGame::MetroidPrime1; }
+  ERegion GetRegion() const override { return ERegion::USA; }
+  bool IsPAL() const override { return false; }
+  bool IsJapanese() const override { return false; }
+  bool IsUSA() const override { return true; }
+  bool IsKorean() const override { return false; }
+  bool IsTrilogy() const override { return false; }
+  std::string GetGameTitle() const override { return "metaforce-loadbench"; }
+  std::string_view GetVersionString() const override { return {}; }
+  void Quit() override {}
+  bool IsPaused() const override { return false; }
+  void SetPaused(bool) override {}
+};
+
+/* Keeps the resource bytes and nothing else */
+struct SRawResource {
+  std::unique_ptr<u8[]> x0_data;
+  u32 x8_size;
+};
+
+CFactoryFnReturn FRawFactory(const SObjectTag&, std::unique_ptr<u8[]>&& in, u32 len, const CVParamTransfer&,
+                             CObjectReference*) {
+  return TToken<SRawResource>::GetIObjObjectFor(std::make_unique<SRawResource>(SRawResource{std::move(in), len}));
+}
+
+std::chrono::nanoseconds Percentile(const std::vector<std::chrono::nanoseconds>& sorted, u32 pct) {
+  const size_t rank = (sorted.size() * pct + 99) / 100;
+  return sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1];
+}
+
+double ToMs(std::chrono::nanoseconds time) { return std::chrono::duration<double, std::milli>(time).count(); }
+} // namespace
+
+CLoadBench::CLoadBench() : m_main(std::make_unique<CLoadBenchMain>()) {
+  g_Main = m_main.get();
+  g_ResFactory = &m_factory;
+  g_SimplePool = &m_pool;
+  CFactoryMgr& factoryMgr = *m_factory.GetFactoryMgr();
+  for (u32 i = 0; i <= u32(CFactoryMgr::ETypeTable::OIDS); ++i) {
+    factoryMgr.AddFactory(CFactoryMgr::TypeIdxToFourCC(CFactoryMgr::ETypeTable(i)), FMemFactoryFunc(FRawFactory));
+  }
+}
+
+CLoadBench::~CLoadBench() {
+  g_SimplePool = nullptr;
+  g_ResFactory = nullptr;
+  g_Main = nullptr;
+}
+
+u32 CLoadBench::AddWorldPaks(std::string_view prefix) {
+  CResLoader& loader = m_factory.GetLoader();
+  u32 count = 0;
+  for (int i = 0; i < 10; ++i) {
+    std::string path(prefix);
+    if (i != 0) {
+      path += '0' + char(i);
+    }
+    if (CDvdFile::FileExists(path + ".pak")) {
+      loader.AddPakFileAsync(path, false, true);
+      ++count;
+    }
+  }
+  loader.WaitForPakFileLoadingComplete();
+  return count;
+}
+
+bool CLoadBench::ReadWorld(CAssetId mlvlId, SWorld& worldOut) {
+  const SObjectTag tag{FOURCC('MLVL'), mlvlId};
+  u32 size = m_factory.ResourceSize(tag);
+  std::unique_ptr<u8[]> data = m_factory.LoadResourceSync(tag);
+  if (!data) {
+    return false;
+  }
+  if (m_factory.GetLoader().GetResourceCompression(tag)) {
+    u32 inflatedSize = 0;
+    data = CFactoryMgr::InflateResource(data.get(), size, inflatedSize);
+    size = inflatedSize;
+  }
+
+  // Same walk as CDummyWorld and CGameArea, keeping only the MREA and its dependency list
+  CMemoryInStream r(data.get(), size, CMemoryInStream::EOwnerShip::NotOwned);
+  if (u32(r.ReadLong()) != MlvlMagic) {
+    Log.report(logvisor::Error, FMT_STRING("{}: not an MLVL"), mlvlId);
+    return false;
+  }
+  const int version = r.ReadLong();
+  r.Get<CAssetId>();
+  if (version >= 15) {
+    r.Get<CAssetId>();
+  }
+  if (version >= 12) {
+    r.ReadLong();
+  }
+  if (version >= 17) {
+    const u32 relayCount = r.ReadLong();
+    for (u32 i = 0; i < relayCount; ++i) {
+      r.ReadLong();
+      r.ReadLong();
+      r.ReadShort();
+      r.ReadBool();
+    }
+  }
+
+  const u32 areaCount = r.ReadLong();
+  r.ReadLong();
+  worldOut.x0_mlvl = mlvlId;
+  worldOut.x8_areas.resize(areaCount);
+  for (SArea& area : worldOut.x8_areas) {
+    r.Get<CAssetId>();
+    r.Get<zeus::CTransform>();
+    r.Get<zeus::CAABox>();
+    area.x0_mrea = r.Get<CAssetId>();
+    if (version > 15) {
+      r.ReadLong();
+    }
+    const u32 attachedCount = r.ReadLong();
+    for (u32 i = 0; i < attachedCount; ++i) {
+      r.ReadShort();
+    }
+    const u32 deps1Count = r.ReadLong();
+    for (u32 i = 0; i < deps1Count; ++i) {
+      SObjectTag().ReadMLVL(r);
+    }
+    const u32 deps2Count = r.ReadLong();
+    area.x8_deps.resize(deps2Count);
+    for (SObjectTag& dep : area.x8_deps) {
+      dep.ReadMLVL(r);
+    }
+    if (version > 13) {
+      const u32 layerDepCount = r.ReadLong();
+      for (u32 i = 0; i < layerDepCount; ++i) {
+        r.ReadLong();
+      }
+    }
+    const u32 dockCount = r.ReadLong();
+    for (u32 i = 0; i < dockCount; ++i) {
+      const u32 refCount = r.ReadLong();
+      for (u32 j = 0; j < refCount; ++j) {
+        r.ReadLong();
+        r.ReadLong();
+      }
+      const u32 vertCount = r.ReadLong();
+      for (u32 j = 0; j < vertCount; ++j) {
+        r.Get<zeus::CVector3f>();
+      }
+    }
+  }
+  return true;
+}
+
+std::vector<CLoadBench::SWorld> CLoadBench::FindWorlds(CAssetId onlyMlvl) {
+  std::vector<SWorld> ret;
+  for (const auto& pak : m_factory.GetLoader().GetPaks()) {
+    const CAssetId mlvlId = pak->GetMLVLId();
+    if (!pak->IsWorldPak() || !mlvlId.IsValid() || (onlyMlvl.IsValid() && mlvlId != onlyMlvl)) {
+      continue;
+    }
+    SWorld world;
+    if (ReadWorld(mlvlId, world)) {
+      ret.push_back(std::move(world));
+    }
+  }
+  return ret;
+}
+
+void CLoadBench::LoadAreas(const SWorld& world) {
+  CTokenGroup prevArea;
+  std::vector<SObjectTag> tags;
+  for (const SArea& area : world.x8_areas) {
+    tags.assign(area.x8_deps.cbegin(), area.x8_deps.cend());
+    tags.emplace_back(FOURCC('MREA'), area.x0_mrea);
+
+    const auto start = std::chrono::steady_clock::now();
+    CTokenGroup group = m_pool.GetObjs(tags);
+    while (!group.IsLoaded()) {
+      CDvdFile::DispatchCompletions();
+      if (!m_factory.AsyncIdle(PumpSlice)) {
+        break;
+      }
+    }
+    m_results.push_back({area.x0_mrea, u32(group.GetTokens().size()), std::chrono::steady_clock::now() - start});
+    // Releasing the previous area now frees whatever the two do not share, as walking through a door would
+    prevArea = std::move(group);
+  }
+}
+
+std::string CLoadBench::SummarizeAreas() const {
+  if (m_results.empty()) {
+    return "No areas loaded\n";
+  }
+  std::vector<std::chrono::nanoseconds> times;
+  std::chrono::nanoseconds total{};
+  u32 resourceCount = 0;
+  for (const SAreaResult& result : m_results) {
+    times.push_back(result.x10_time);
+    total += result.x10_time;
+    resourceCount += result.x8_resourceCount;
+  }
+  std::sort(times.begin(), times.end());
+  return fmt::format(FMT_STRING("{} areas, {} resource requests, {:.2f} ms total; per area p50/p90/p99/max "
+                                "{:.2f}/{:.2f}/{:.2f}/{:.2f} ms\n"),
+                     m_results.size(), resourceCount, ToMs(total), ToMs(Percentile(times, 50)),
+                     ToMs(Percentile(times, 90)), ToMs(Percentile(times, 99)), ToMs(times.back()));
+}
+
+} // namespace metaforce
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Runtime/CResFactory.hpp"
+#include "Runtime/CSimplePool.hpp"
+#include "Runtime/RetroTypes.hpp"
+
+namespace metaforce {
+class IMain;
+
+/* Headless driver for metaforce-loadbench. Streams every area of a world through CSimplePool/CResFactory the way
+ * CGameArea requests them (one dependency group per area, pumped with AsyncIdle) but hands each resource to a
+ * factory that only keeps its bytes, so no renderer or audio backend is needed.
+ * Timings come from CResLoadTrace; the caller owns enabling it and reading the records back. */
+class CLoadBench {
+public:
+  struct SArea {
+    CAssetId x0_mrea;
+    std::vector<SObjectTag> x8_deps;
+  };
+  struct SWorld {
+    CAssetId x0_mlvl;
+    std::vector<SArea> x8_areas;
+  };
+  struct SAreaResult {
+    CAssetId x0_mrea;
+    u32 x8_resourceCount = 0;
+    std::chrono::nanoseconds x10_time{};
+  };
+
+private:
+  std::unique_ptr<IMain> m_main;
+  CResFactory m_factory;
+  CSimplePool m_pool{m_factory};
+  std::vector<SAreaResult> m_results;
+
+  bool ReadWorld(CAssetId mlvlId, SWorld& worldOut);
+
+public:
+  CLoadBench();
+  ~CLoadBench();
+  CLoadBench(const CLoadBench&) = delete;
+  CLoadBench& operator=(const CLoadBench&) = delete;
+
+  /* Adds <prefix>.pak and <prefix>1.pak through <prefix>9.pak, the same set CMain::AddWorldPaks loads */
+  u32 AddWorldPaks(std::string_view prefix);
+  /* Reads the area table of every loaded world PAK, or only of the given MLVL when it is valid */
+  std::vector<SWorld> FindWorlds(CAssetId onlyMlvl);
+  /* Loads the areas one after another, holding the previous area until the next one is resident */
+  void LoadAreas(const SWorld& world);
+
+  const std::vector<SAreaResult>& GetAreaResults() const { return m_results; }
+  std::string SummarizeAreas() const;
+};
+
+} // namespace metaforce
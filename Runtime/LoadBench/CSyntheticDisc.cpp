@@ -0,0 +1,388 @@
+#include "Runtime/LoadBench/CSyntheticDisc.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <logvisor/logvisor.hpp>
+#include <zlib.h>
+
+namespace metaforce {
+namespace {
+logvisor::Module Log("metaforce::CSyntheticDisc");
+
+#ifdef _MSC_VER
+constexpr const char* WriteMode = "wb";
+#else
+constexpr const char* WriteMode = "wbe";
+#endif
+
+constexpr u32 GCNMagic = 0xC2339F3D;
+constexpr u32 BootSize = 0x440;
+constexpr u32 ApploaderOffset = 0x2440;
+constexpr u32 ApploaderHeaderSize = 0x20;
+constexpr u32 DolOffset = 0x2480;
+constexpr u32 DolHeaderSize = 0x100;
+constexpr u32 DolTextSize = 0x20;
+constexpr u32 FstOffset = DolOffset + DolHeaderSize + DolTextSize;
+constexpr u32 FileAlign = 0x8000;
+constexpr u32 PakVersion = 0x00030005;
+constexpr u32 MlvlMagic = 0xDEAFBABE;
+constexpr u32 MlvlVersion = 0x11;
+constexpr u32 InvalidId = UINT32_MAX;
+/* Door-sized quad on the shared face, as (y, z) pairs */
+constexpr std::array<std::pair<float, float>, 4> DockVerts{{{-8.f, 0.f}, {8.f, 0.f}, {8.f, 16.f}, {-8.f, 16.f}}};
+
+struct SResourceKind {
+  FourCC x0_type;
+  u32 x4_minSize;
+  u32 x8_maxSize;
+  bool xc_compressed;
+  u32 x10_weight;
+};
+
+/* Rough MP1 mix: textures and models dominate both count and bytes */
+constexpr std::array<SResourceKind, 10> ResourceKinds{{
+    {FOURCC('TXTR'), 2048, 131072, true, 40},
+    {FOURCC('CMDL'), 4096, 262144, true, 15},
+    {FOURCC('ANIM'), 4096, 65536, true, 8},
+    {FOURCC('ANCS'), 1024, 16384, true, 5},
+    {FOURCC('DCLN'), 2048, 65536, true, 3},
+    {FOURCC('PART'), 512, 8192, false, 12},
+    {FOURCC('STRG'), 256, 4096, false, 5},
+    {FOURCC('SCAN'), 64, 512, false, 5},
+    {FOURCC('EVNT'), 64, 2048, false, 5},
+    {FOURCC('AGSC'), 16384, 262144, false, 2},
+}};
+
+class CBigWriter {
+  std::vector<u8> m_data;
+
+public:
+  void WriteU8(u8 val) { m_data.push_back(val); }
+  void WriteU16(u16 val) {
+    WriteU8(u8(val >> 8));
+    WriteU8(u8(val));
+  }
+  void WriteU32(u32 val) {
+    WriteU16(u16(val >> 16));
+    WriteU16(u16(val));
+  }
+  void WriteU64(u64 val) {
+    WriteU32(u32(val >> 32));
+    WriteU32(u32(val));
+  }
+  void WriteFloat(float val) {
+    u32 bits = 0;
+    std::memcpy(&bits, &val, sizeof(bits));
+    WriteU32(bits);
+  }
+  void WriteFourCC(FourCC fcc) { WriteBytes(fcc.getChars(), 4); }
+  void WriteBytes(const void* data, size_t len) {
+    const auto* bytes = static_cast<const u8*>(data);
+    m_data.insert(m_data.end(), bytes, bytes + len);
+  }
+  void Align(u32 align) { m_data.resize((m_data.size() + align - 1) / align * align); }
+  void PatchU32(size_t offset, u32 val) {
+    for (u32 i = 0; i < 4; ++i) {
+      m_data[offset + i] = u8(val >> (24 - i * 8));
+    }
+  }
+  size_t Size() const { return m_data.size(); }
+  std::vector<u8>& Data() { return m_data; }
+};
+
+struct SPakEntry {
+  FourCC x0_type;
+  u32 x4_id;
+  std::vector<u8> x8_data;
+  bool x20_compressed;
+};
+
+struct SWorld {
+  std::string x0_pakName;
+  std::vector<u8> x10_pak;
+};
+
+/* Short runs over a small alphabet; zlib gets roughly 3:1 out of it, in line with MP1 texture and model data */
+std::vector<u8> MakePayload(std::mt19937& rng, u32 size) {
+  std::vector<u8> ret(size);
+  for (u32 i = 0; i < size;) {
+    const u8 val = u8(rng() & 0x3F);
+    const u32 run = std::min(size - i, 1 + u32(rng() & 7));
+    std::fill_n(ret.begin() + i, run, val);
+    i += run;
+  }
+  return ret;
+}
+
+/* Compressed PAK entries are the inflated length followed by a zlib stream */
+std::vector<u8> Compress(const std::vector<u8>& data) {
+  uLongf compLen = compressBound(uLong(data.size()));
+  std::vector<u8> ret(4 + compLen);
+  const u32 size = u32(data.size());
+  for (u32 i = 0; i < 4; ++i) {
+    ret[i] = u8(size >> (24 - i * 8));
+  }
+  compress2(ret.data() + 4, &compLen, data.data(), uLong(data.size()), Z_DEFAULT_COMPRESSION);
+  ret.resize(4 + compLen);
+  return ret;
+}
+
+const SResourceKind& PickKind(std::mt19937& rng) {
+  u32 totalWeight = 0;
+  for (const SResourceKind& kind : ResourceKinds) {
+    totalWeight += kind.x10_weight;
+  }
+  u32 pick = rng() % totalWeight;
+  for (const SResourceKind& kind : ResourceKinds) {
+    if (pick < kind.x10_weight) {
+      return kind;
+    }
+    pick -= kind.x10_weight;
+  }
+  return ResourceKinds.front();
+}
+
+u32 PickSize(std::mt19937& rng, u32 minSize, u32 maxSize) {
+  // Log-uniform, so small resources are common and large ones rare
+  std::uniform_real_distribution<float> dist(std::log(float(minSize)), std::log(float(maxSize)));
+  return u32(std::exp(dist(rng)));
+}
+
+std::vector<u8> BuildPak(const std::vector<SPakEntry>& entries) {
+  CBigWriter w;
+  w.WriteU32(PakVersion);
+  w.WriteU32(0);
+  w.WriteU32(0); // Named resources
+  w.WriteU32(u32(entries.size()));
+  const size_t tableOffset = w.Size();
+  for (size_t i = 0; i < entries.size() * 5; ++i) {
+    w.WriteU32(0);
+  }
+  w.Align(32);
+
+  for (size_t i = 0; i < entries.size(); ++i) {
+    const SPakEntry& entry = entries[i];
+    const u32 offset = u32(w.Size());
+    w.WriteBytes(entry.x8_data.data(), entry.x8_data.size());
+    w.Align(32);
+    const size_t rec = tableOffset + i * 20;
+    w.PatchU32(rec, entry.x20_compressed ? 1 : 0);
+    std::memcpy(w.Data().data() + rec + 4, entry.x0_type.getChars(), 4);
+    w.PatchU32(rec + 8, entry.x4_id);
+    w.PatchU32(rec + 12, u32(w.Size()) - offset);
+    w.PatchU32(rec + 16, offset);
+  }
+  return std::move(w.Data());
+}
+
+std::vector<u8> BuildMlvl(u32 mreaBase, u32 resBase, const std::vector<std::vector<u32>>& areaDeps,
+                          const std::vector<FourCC>& resTypes) {
+  const u32 areaCount = u32(areaDeps.size());
+  CBigWriter w;
+  w.WriteU32(MlvlMagic);
+  w.WriteU32(MlvlVersion);
+  w.WriteU32(InvalidId); // STRG
+  w.WriteU32(InvalidId); // SAVW
+  w.WriteU32(InvalidId); // Skybox
+  w.WriteU32(0);         // Memory relays
+  w.WriteU32(areaCount);
+  w.WriteU32(1);
+
+  for (u32 a = 0; a < areaCount; ++a) {
+    w.WriteU32(InvalidId); // STRG
+    // Areas sit in a row along X, each one a 64 unit cube
+    const std::array<float, 12> xf{1.f, 0.f, 0.f, float(a) * 64.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f, 0.f};
+    for (float val : xf) {
+      w.WriteFloat(val);
+    }
+    for (float val : {-32.f, -32.f, -32.f, 32.f, 32.f, 32.f}) {
+      w.WriteFloat(val);
+    }
+    w.WriteU32(mreaBase + a);
+    w.WriteU32(a); // Area save id
+
+    std::vector<u32> attached;
+    if (a > 0) {
+      attached.push_back(a - 1);
+    }
+    if (a + 1 < areaCount) {
+      attached.push_back(a + 1);
+    }
+    w.WriteU32(u32(attached.size()));
+    for (u32 other : attached) {
+      w.WriteU16(u16(other));
+    }
+
+    w.WriteU32(0); // Unused dependency list
+    w.WriteU32(u32(areaDeps[a].size()));
+    for (u32 dep : areaDeps[a]) {
+      w.WriteU32(resBase + dep);
+      w.WriteFourCC(resTypes[dep]);
+    }
+    w.WriteU32(1); // Layer dependency offsets
+    w.WriteU32(0);
+
+    // Dock 0 faces the previous area where there is one; the neighbour's matching dock follows the same rule
+    w.WriteU32(u32(attached.size()));
+    for (u32 other : attached) {
+      w.WriteU32(1);
+      w.WriteU32(other);
+      w.WriteU32(other < a && other > 0 ? 1 : 0);
+      w.WriteU32(4);
+      const float x = other < a ? -32.f : 32.f;
+      for (const auto& [y, z] : DockVerts) {
+        w.WriteFloat(x);
+        w.WriteFloat(y);
+        w.WriteFloat(z);
+      }
+    }
+  }
+
+  w.WriteU32(InvalidId); // MAPW
+  w.WriteU8(0);
+  w.WriteU32(0);
+  w.WriteU32(0); // Audio groups
+  w.WriteU8(0);  // Empty name
+  w.WriteU32(areaCount);
+  for (u32 a = 0; a < areaCount; ++a) {
+    w.WriteU32(1);
+    w.WriteU64(1);
+  }
+  w.WriteU32(1);
+  w.WriteBytes("Default", 8);
+  w.WriteU32(areaCount);
+  for (u32 a = 0; a < areaCount; ++a) {
+    w.WriteU32(0);
+  }
+  return std::move(w.Data());
+}
+
+SWorld BuildWorld(std::mt19937& rng, u32 worldIdx, const CSyntheticDisc::SDesc& desc) {
+  // Ids are unique across the disc; the top byte names the world
+  const u32 idBase = (worldIdx + 1) << 24;
+  const u32 mlvlId = idBase | 0xFFFFF0;
+  const u32 mreaBase = idBase | 0xF00000;
+  const u32 resBase = idBase | 0x000001;
+  const u32 resCount = std::max(desc.xc_resourcesPerWorld, 1u);
+  const u32 areaCount = std::max(desc.x8_areasPerWorld, 1u);
+  const u32 depCount = std::min(desc.x10_depsPerArea, resCount);
+
+  std::vector<SPakEntry> entries;
+  std::vector<FourCC> resTypes;
+  entries.reserve(resCount + areaCount + 1);
+  resTypes.reserve(resCount);
+  for (u32 i = 0; i < resCount; ++i) {
+    const SResourceKind& kind = PickKind(rng);
+    std::vector<u8> payload = MakePayload(rng, PickSize(rng, kind.x4_minSize, kind.x8_maxSize));
+    entries.push_back({kind.x0_type, resBase + i, kind.xc_compressed ? Compress(payload) : std::move(payload),
+                       kind.xc_compressed});
+    resTypes.push_back(kind.x0_type);
+  }
+
+  // Each area takes a sliding window over the pool plus a few stragglers from anywhere in the world
+  std::vector<std::vector<u32>> areaDeps(areaCount);
+  const u32 stride = std::max(resCount / areaCount, 1u);
+  const u32 randomCount = depCount / 8;
+  for (u32 a = 0; a < areaCount; ++a) {
+    for (u32 i = 0; i < depCount - randomCount; ++i) {
+      areaDeps[a].push_back((a * stride + i) % resCount);
+    }
+    for (u32 i = 0; i < randomCount; ++i) {
+      areaDeps[a].push_back(rng() % resCount);
+    }
+    std::sort(areaDeps[a].begin(), areaDeps[a].end());
+    areaDeps[a].erase(std::unique(areaDeps[a].begin(), areaDeps[a].end()), areaDeps[a].end());
+  }
+
+  for (u32 a = 0; a < areaCount; ++a) {
+    entries.push_back({FOURCC('MREA'), mreaBase + a, MakePayload(rng, PickSize(rng, 262144, 2097152)), false});
+  }
+  entries.push_back({FOURCC('MLVL'), mlvlId, BuildMlvl(mreaBase, resBase, areaDeps, resTypes), false});
+
+  // Real PAKs are not sorted by id; shuffle so disc order and id order disagree
+  std::shuffle(entries.begin(), entries.end(), rng);
+  return {fmt::format(FMT_STRING("Metroid{}.pak"), worldIdx + 1), BuildPak(entries)};
+}
+} // namespace
+
+bool CSyntheticDisc::Write(const std::string& path, const SDesc& desc) {
+  std::mt19937 rng(desc.x0_seed);
+  std::vector<SWorld> worlds;
+  worlds.reserve(desc.x4_worldCount);
+  for (u32 w = 0; w < desc.x4_worldCount; ++w) {
+    worlds.push_back(BuildWorld(rng, w, desc));
+  }
+
+  // FST: root directory followed by one file per world, then the name table
+  CBigWriter fst;
+  const u32 nodeCount = u32(worlds.size()) + 1;
+  std::vector<u32> fileOffsets;
+  u32 nameTableSize = 0;
+  for (const SWorld& world : worlds) {
+    nameTableSize += u32(world.x0_pakName.size()) + 1;
+  }
+  u32 fileOffset = (FstOffset + nodeCount * 12 + nameTableSize + FileAlign - 1) / FileAlign * FileAlign;
+  fst.WriteU32(0x01000000);
+  fst.WriteU32(0);
+  fst.WriteU32(nodeCount);
+  u32 nameOffset = 0;
+  for (const SWorld& world : worlds) {
+    fileOffsets.push_back(fileOffset);
+    fst.WriteU32(nameOffset);
+    fst.WriteU32(fileOffset);
+    fst.WriteU32(u32(world.x10_pak.size()));
+    nameOffset += u32(world.x0_pakName.size()) + 1;
+    fileOffset = (fileOffset + u32(world.x10_pak.size()) + FileAlign - 1) / FileAlign * FileAlign;
+  }
+  for (const SWorld& world : worlds) {
+    fst.WriteBytes(world.x0_pakName.c_str(), world.x0_pakName.size() + 1);
+  }
+
+  CBigWriter header;
+  header.WriteBytes("MFLB01", 6);
+  header.Align(0x1C);
+  header.WriteU32(GCNMagic);
+  header.WriteBytes("Metaforce synthetic load benchmark", 35);
+  header.Data().resize(0x420);
+  header.WriteU32(DolOffset);
+  header.WriteU32(FstOffset);
+  header.WriteU32(u32(fst.Size()));
+  header.WriteU32(u32(fst.Size()));
+  header.Data().resize(ApploaderOffset);
+  header.Data().resize(ApploaderOffset + ApploaderHeaderSize); // Empty apploader
+  header.Data().resize(DolOffset);
+  // DOL with a single empty text section so it has a non-zero size
+  header.WriteU32(DolHeaderSize);
+  header.Data().resize(DolOffset + 0x90);
+  header.WriteU32(DolTextSize);
+  header.Data().resize(FstOffset);
+  static_assert(FstOffset >= BootSize);
+
+  FILE* file = fopen(path.c_str(), WriteMode);
+  if (file == nullptr) {
+    Log.report(logvisor::Error, FMT_STRING("unable to open '{}' for writing"), path);
+    return false;
+  }
+  bool ok = fwrite(header.Data().data(), 1, header.Size(), file) == header.Size() &&
+            fwrite(fst.Data().data(), 1, fst.Size(), file) == fst.Size();
+  for (size_t w = 0; ok && w < worlds.size(); ++w) {
+    ok = fseek(file, long(fileOffsets[w]), SEEK_SET) == 0 &&
+         fwrite(worlds[w].x10_pak.data(), 1, worlds[w].x10_pak.size(), file) == worlds[w].x10_pak.size();
+  }
+  // Pad the image out to the end of the last file's alignment block
+  ok = ok && fseek(file, long(fileOffset) - 1, SEEK_SET) == 0 && fputc(0, file) != EOF;
+  ok = fclose(file) == 0 && ok;
+  if (!ok) {
+    Log.report(logvisor::Error, FMT_STRING("failed writing '{}'"), path);
+  }
+  return ok;
+}
+
+} // namespace metaforce
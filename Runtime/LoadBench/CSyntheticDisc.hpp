@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+
+#include "Runtime/RetroTypes.hpp"
+
+namespace metaforce {
+
+/* Writes a raw GameCube disc image holding MP1-style world PAKs filled with random, compressible resources, so
+ * metaforce-loadbench can run without game data (e.g. in CI).
+ * Each world has one MLVL whose area table lists an MREA and a dependency window per area; neighbouring areas share
+ * part of their window the way real adjacent rooms share textures and models. Nothing but the MLVL area table is a
+ * valid asset, so the image is only useful with factories that keep the raw bytes. */
+class CSyntheticDisc {
+public:
+  struct SDesc {
+    u32 x0_seed = 1;
+    u32 x4_worldCount = 2;
+    u32 x8_areasPerWorld = 16;
+    u32 xc_resourcesPerWorld = 400;
+    u32 x10_depsPerArea = 60;
+  };
+
+  static bool Write(const std::string& path, const SDesc& desc);
+};
+
+} // namespace metaforce
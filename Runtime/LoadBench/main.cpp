@@ -0,0 +1,139 @@
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+
+#include "Runtime/CDvdFile.hpp"
+#include "Runtime/CResLoadTrace.hpp"
+#include "Runtime/LoadBench/CLoadBench.hpp"
+#include "Runtime/LoadBench/CSyntheticDisc.hpp"
+
+#include <logvisor/logvisor.hpp>
+
+using namespace std::literals;
+
+namespace {
+constexpr std::string_view Usage =
+    "Usage: metaforce-loadbench [options] <disc image>\n"
+    "Loads every area of each world back to back without a renderer and prints load-time percentiles.\n"
+    "\n"
+    "  --synthetic         Write a synthetic disc image to <disc image> first, then benchmark it\n"
+    "  --seed N            Synthetic: random seed (default 1)\n"
+    "  --worlds N          Synthetic: world PAK count, at most 9 (default 2)\n"
+    "  --areas N           Synthetic: areas per world (default 16)\n"
+    "  --resources N       Synthetic: resources per world (default 400)\n"
+    "  --deps N            Synthetic: dependencies per area (default 60)\n"
+    "  --prefix NAME       World PAK prefix (default Metroid)\n"
+    "  --world ID          Only load the world with this MLVL id (hex)\n"
+    "  --passes N          Load each world N times (default 1)\n"
+    "  --dvd-threads N     Disc read worker threads (default 2)\n"
+    "  --no-mmap           Read PAKs through the DVD queue instead of memory-mapping the image\n"
+    "  --csv PATH          Also write every resource record to PATH\n"
+    "  -v                  Enable runtime logging, including a line per built resource\n"sv;
+
+u32 ParseU32(const char* str) { return u32(std::strtoul(str, nullptr, 10)); }
+} // namespace
+
+int main(int argc, char** argv) {
+  using namespace metaforce;
+
+  std::string discPath;
+  std::string pakPrefix = "Metroid";
+  std::string csvPath;
+  CSyntheticDisc::SDesc synthDesc;
+  bool synthetic = false;
+  CAssetId onlyWorld;
+  u32 passes = 1;
+  u32 dvdThreads = 2;
+  bool memoryMap = true;
+  bool verbose = false;
+
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view arg = argv[i];
+    const bool hasValue = i + 1 < argc;
+    if (arg == "--synthetic"sv) {
+      synthetic = true;
+    } else if (arg == "--seed"sv && hasValue) {
+      synthDesc.x0_seed = ParseU32(argv[++i]);
+    } else if (arg == "--worlds"sv && hasValue) {
+      synthDesc.x4_worldCount = std::clamp(ParseU32(argv[++i]), 1u, 9u);
+    } else if (arg == "--areas"sv && hasValue) {
+      synthDesc.x8_areasPerWorld = ParseU32(argv[++i]);
+    } else if (arg == "--resources"sv && hasValue) {
+      synthDesc.xc_resourcesPerWorld = ParseU32(argv[++i]);
+    } else if (arg == "--deps"sv && hasValue) {
+      synthDesc.x10_depsPerArea = ParseU32(argv[++i]);
+    } else if (arg == "--prefix"sv && hasValue) {
+      pakPrefix = argv[++i];
+    } else if (arg == "--world"sv && hasValue) {
+      onlyWorld = CAssetId(u64(std::strtoull(argv[++i], nullptr, 16)));
+    } else if (arg == "--passes"sv && hasValue) {
+      passes = std::max(ParseU32(argv[++i]), 1u);
+    } else if (arg == "--dvd-threads"sv && hasValue) {
+      dvdThreads = ParseU32(argv[++i]);
+    } else if (arg == "--no-mmap"sv) {
+      memoryMap = false;
+    } else if (arg == "--csv"sv && hasValue) {
+      csvPath = argv[++i];
+    } else if (arg == "-v"sv) {
+      verbose = true;
+    } else if (arg.starts_with('-') || !discPath.empty()) {
+      fmt::print(stderr, FMT_STRING("{}"), Usage);
+      return 1;
+    } else {
+      discPath = arg;
+    }
+  }
+  if (discPath.empty()) {
+    fmt::print(stderr, FMT_STRING("{}"), Usage);
+    return 1;
+  }
+
+  // Runtime logging includes a line per built resource, which would swamp the summary
+  if (verbose) {
+    logvisor::RegisterConsoleLogger();
+  }
+
+  if (synthetic && !CSyntheticDisc::Write(discPath, synthDesc)) {
+    return 1;
+  }
+
+  CDvdFile::SetWorkerCount(dvdThreads);
+  CDvdFile::SetMemoryMapEnabled(memoryMap);
+  if (!CDvdFile::Initialize(discPath)) {
+    fmt::print(stderr, FMT_STRING("Failed to open disc image '{}'\n"), discPath);
+    return 1;
+  }
+
+  int ret = 0;
+  {
+    CLoadBench bench;
+    if (bench.AddWorldPaks(pakPrefix) == 0) {
+      fmt::print(stderr, FMT_STRING("No {}*.pak world PAKs on '{}'\n"), pakPrefix, discPath);
+      ret = 1;
+    }
+    const std::vector<CLoadBench::SWorld> worlds = bench.FindWorlds(onlyWorld);
+    if (ret == 0 && worlds.empty()) {
+      fmt::print(stderr, FMT_STRING("No matching worlds on '{}'\n"), discPath);
+      ret = 1;
+    }
+
+    CResLoadTrace::SetEnabled(true);
+    for (u32 pass = 0; pass < passes; ++pass) {
+      for (const CLoadBench::SWorld& world : worlds) {
+        bench.LoadAreas(world);
+      }
+    }
+    CResLoadTrace::SetEnabled(false);
+
+    if (ret == 0) {
+      const std::vector<SResLoadRecord> records = CResLoadTrace::TakeRecords();
+      fmt::print(FMT_STRING("{}{}"), bench.SummarizeAreas(), CResLoadTrace::Summarize(records));
+      if (!csvPath.empty() && !CResLoadTrace::WriteCSV(csvPath, records)) {
+        ret = 1;
+      }
+    }
+  }
+  CDvdFile::Shutdown();
+  return ret;
+}
@@ -1890,11 +1890,7 @@ void CFrontEndUI::UpdateMovies(float dt) {
 void CFrontEndUI::FinishedLoadingDepsGroup() {
   /* Transfer DGRP tokens into FrontEnd and lock */
   const CDependencyGroup* dgrp = x20_depsGroup.GetObj();
-  x2c_deps.reserve(dgrp->GetObjectTagVector().size());
-  for (const SObjectTag& tag : dgrp->GetObjectTagVector()) {
-    x2c_deps.push_back(g_SimplePool->GetObj(tag));
-    x2c_deps.back().Lock();
-  }
+  x2c_deps = g_SimplePool->GetObjs(dgrp->GetObjectTagVector()).ReleaseTokens();
   x44_frontendAudioGrp.Lock();
 }
 
@@ -201,12 +201,7 @@ bool CInGameGuiManager::CheckLoadComplete(CStateManager& stateMgr) {
   case ELoadPhase::LoadDepsGroup: {
     if (!x0_iggmPreLoad.IsLoaded())
       return false;
-    const auto& tags = x0_iggmPreLoad->GetObjectTagVector();
-    x8_preLoadDeps.reserve(tags.size());
-    for (const SObjectTag& tag : tags) {
-      x8_preLoadDeps.push_back(g_SimplePool->GetObj(tag));
-      x8_preLoadDeps.back().Lock();
-    }
+    x8_preLoadDeps = g_SimplePool->GetObjs(x0_iggmPreLoad->GetObjectTagVector()).ReleaseTokens();
     x0_iggmPreLoad.Unlock();
     x18_loadPhase = ELoadPhase::PreLoadDeps;
     [[fallthrough]];
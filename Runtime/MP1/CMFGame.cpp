@@ -3,6 +3,7 @@
 #include <array>
 
 #include "Runtime/CArchitectureQueue.hpp"
+#include "Runtime/CGameplayReplay.hpp"
 #include "Runtime/MP1/CSamusHud.hpp"
 #include "Runtime/MP1/MP1.hpp"
 #include "Runtime/Audio/CMidiManager.hpp"
@@ -16,7 +17,10 @@ namespace metaforce::MP1 {
 
 CMFGame::CMFGame(const std::weak_ptr<CStateManager>& stateMgr, const std::weak_ptr<CInGameGuiManager>& guiMgr,
                  const CArchitectureQueue&)
-: CMFGameBase("CMFGame"), x14_stateManager(stateMgr.lock()), x18_guiManager(guiMgr.lock()) {
+: CMFGameBase("CMFGame")
+, x14_stateManager(stateMgr.lock())
+, x18_guiManager(guiMgr.lock())
+, m_replay(CGameplayReplay::Create()) {
   static_cast<CMain&>(*g_Main).SetMFGameBuilt(true);
 }
 
@@ -25,6 +29,9 @@ CMFGame::~CMFGame() {
   main.SetMFGameBuilt(false);
   main.SetScreenFading(false);
   CDecalManager::Reinitialize();
+  if (m_replay) {
+    m_replay->Finish();
+  }
 }
 
 CIOWin::EMessageReturn CMFGame::OnMessage(const CArchitectureMessage& msg, CArchitectureQueue& queue) {
@@ -59,7 +66,13 @@ CIOWin::EMessageReturn CMFGame::OnMessage(const CArchitectureMessage& msg, CArch
       x14_stateManager->SetActiveRandomToDefault();
       switch (x14_stateManager->GetDeferredStateTransition()) {
       case EStateManagerTransition::InGame:
+        if (m_replay) {
+          dt = m_replay->BeginFrame(*x14_stateManager, dt);
+        }
         x14_stateManager->Update(dt);
+        if (m_replay) {
+          m_replay->EndFrame(*x14_stateManager);
+        }
         if (!x14_stateManager->ShouldQuitGame())
           break;
         // CGraphics::SetIsBeginSceneClearFb();
@@ -121,7 +134,8 @@ CIOWin::EMessageReturn CMFGame::OnMessage(const CArchitectureMessage& msg, CArch
     if (!x2a_24_initialized)
       break;
     const CFinalInput& input = MakeMsg::GetParmUserInput(msg).x4_parm;
-    if (x1c_flowState == EGameFlowState::InGame) {
+    /* Metaforce addition: a replay feeds the recorded input from BeginFrame instead */
+    if (x1c_flowState == EGameFlowState::InGame && !(m_replay && m_replay->IsPlaying())) {
       if (input.ControllerIdx() == 0) {
         const CEntity* cam = x14_stateManager->GetCameraManager()->GetCurrentCamera(*x14_stateManager);
         TCastToConstPtr<CCinematicCamera> cineCam = cam;
@@ -140,6 +154,9 @@ CIOWin::EMessageReturn CMFGame::OnMessage(const CArchitectureMessage& msg, CArch
         }
       }
 
+      if (m_replay) {
+        m_replay->RecordInput(input);
+      }
       x14_stateManager->SetActiveRandomToDefault();
       x14_stateManager->ProcessInput(input);
       x14_stateManager->ClearActiveRandom();
@@ -293,10 +310,7 @@ void CMFGameLoader::MakeLoadDependencyList() {
     g_ResFactory->GetTagListForFile(pak, tags);
   }
 
-  x1c_loadList.reserve(tags.size());
-  for (const SObjectTag& tag : tags) {
-    x1c_loadList.push_back(g_SimplePool->GetObj(tag));
-  }
+  x1c_loadList = g_SimplePool->GetObjs(tags).ReleaseTokens();
 }
 
 CIOWin::EMessageReturn CMFGameLoader::OnMessage(const CArchitectureMessage& msg, CArchitectureQueue& queue) {
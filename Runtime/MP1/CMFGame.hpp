@@ -8,6 +8,7 @@
 #include "Runtime/MP1/CInGameGuiManager.hpp"
 
 namespace metaforce {
+class CGameplayReplay;
 class CStateManager;
 class CToken;
 
@@ -24,6 +25,8 @@ class CMFGame : public CMFGameBase {
   TUniqueId x28_skippedCineCam = kInvalidUniqueId;
   bool x2a_24_initialized : 1 = false;
   bool x2a_25_samusAlive : 1 = true;
+  /* Metaforce addition: set by replay.record or replay.play */
+  std::unique_ptr<CGameplayReplay> m_replay;
 
   bool IsCameraActiveFlow() const {
     return (x1c_flowState == EGameFlowState::InGame || x1c_flowState == EGameFlowState::SamusDied);
@@ -117,15 +117,9 @@ CSamusDoll::CSamusDoll(const CDependencyGroup& suitDgrp, const CDependencyGroup&
   x23c_lights.push_back(CLight::BuildDirectional(zeus::skForward, zeus::skWhite));
   x24c_actorLights = std::make_unique<CActorLights>(8, zeus::skZero3f, 4, 4, false, false, false, 0.1f);
   x22c_ballInnerGlowGen->SetGlobalScale(zeus::CVector3f(0.625f));
-  x0_depToks.reserve(suitDgrp.GetObjectTagVector().size() + ballDgrp.GetObjectTagVector().size());
-  for (const SObjectTag& tag : suitDgrp.GetObjectTagVector()) {
-    x0_depToks.push_back(g_SimplePool->GetObj(tag));
-    x0_depToks.back().Lock();
-  }
-  for (const SObjectTag& tag : ballDgrp.GetObjectTagVector()) {
-    x0_depToks.push_back(g_SimplePool->GetObj(tag));
-    x0_depToks.back().Lock();
-  }
+  std::vector<SObjectTag> depTags = suitDgrp.GetObjectTagVector();
+  depTags.insert(depTags.end(), ballDgrp.GetObjectTagVector().cbegin(), ballDgrp.GetObjectTagVector().cend());
+  x0_depToks = g_SimplePool->GetObjs(depTags).ReleaseTokens();
 }
 
 bool CSamusDoll::IsLoaded() const {
@@ -5,6 +5,7 @@
 #include "Runtime/CDependencyGroup.hpp"
 #include "Runtime/CGameHintInfo.hpp"
 #include "Runtime/CWorldSaveGameInfo.hpp"
+#include "Runtime/CResLoadTrace.hpp"
 #include "Runtime/CScannableObjectInfo.hpp"
 #include "Runtime/CStateManager.hpp"
 #include "Runtime/CStopwatch.hpp"
@@ -262,6 +263,7 @@ void CGameGlobalObjects::AddPaksAndFactories() {
     fmgr->AddFactory(FOURCC('DCLN'), FFactoryFunc(FCollidableOBBTreeGroupFactory));
     fmgr->AddFactory(FOURCC('DGRP'), FFactoryFunc(FDependencyGroupFactory));
     fmgr->AddFactory(FOURCC('AGSC'), FMemFactoryFunc(FAudioGroupSetDataFactory));
+    fmgr->AddFactory(FOURCC('AGSC'), FViewFactoryFunc(FAudioGroupSetDataViewFactory));
     fmgr->AddFactory(FOURCC('CSNG'), FFactoryFunc(FMidiDataFactory));
     fmgr->AddFactory(FOURCC('ATBL'), FFactoryFunc(FAudioTranslationTableFactory));
     fmgr->AddFactory(FOURCC('STRG'), FFactoryFunc(FStringTableFactory));
@@ -278,6 +280,7 @@ void CGameGlobalObjects::AddPaksAndFactories() {
     fmgr->AddFactory(FOURCC('MAPU'), FFactoryFunc(FMapUniverseFactory));
     fmgr->AddFactory(FOURCC('AFSM'), FFactoryFunc(FAiFiniteStateMachineFactory));
     fmgr->AddFactory(FOURCC('PATH'), FMemFactoryFunc(FPathFindAreaFactory));
+    fmgr->AddFactory(FOURCC('PATH'), FViewFactoryFunc(FPathFindAreaViewFactory));
     fmgr->AddFactory(FOURCC('TMET'), FFactoryFunc(FTextureCacheFactory));
   }
 }
@@ -510,6 +513,7 @@ std::string CMain::Init(int argc, char** argv, const FileStoreManager& storeMgr,
                         boo::IAudioVoiceEngine* voiceEngine, amuse::IBackendVoiceAllocator& backend) {
   m_cvarMgr = cvarMgr;
 
+  std::string discTag;
   {
     auto discInfo = CDvdFile::DiscInfo();
     if (discInfo.gameId[4] != '0' || discInfo.gameId[5] != '1') {
@@ -554,6 +558,7 @@ std::string CMain::Init(int argc, char** argv, const FileStoreManager& storeMgr,
       return fmt::format(FMT_STRING("Unknown region {}"), discInfo.gameId[3]);
     }
     m_version.gameTitle = std::move(discInfo.gameTitle);
+    discTag = fmt::format(FMT_STRING("{}{:02X}"), std::string_view{discInfo.gameId.data(), 6}, discInfo.version);
   }
 
   if (m_version.game != EGame::MetroidPrime1 && m_version.game != EGame::MetroidPrimeTrilogy) {
@@ -588,6 +593,17 @@ std::string CMain::Init(int argc, char** argv, const FileStoreManager& storeMgr,
   } else if (m_version.platform == EPlatform::Wii) {
     CDvdFile::SetRootDirectory("MP1JPN");
   }
+  if (CVarCommons* cvarCmns = CVarCommons::instance(); cvarCmns != nullptr && cvarCmns->getInflateCache()) {
+    if (CResLoader* loader = g_ResFactory->GetResLoader()) {
+      // One cache per disc revision; PAK contents differ between regions and revisions
+      loader->EnableInflateCache(fmt::format(FMT_STRING("{}/inflatecache/{}"), storeMgr.getStoreRoot(), discTag),
+                                 cvarCmns->getInflateCacheSize());
+    }
+  }
+  if (CVarCommons* cvarCmns = CVarCommons::instance(); cvarCmns != nullptr && cvarCmns->getResourceTrace()) {
+    m_resourceTracePath = fmt::format(FMT_STRING("{}/resource_trace.csv"), storeMgr.getStoreRoot());
+    CResLoadTrace::SetEnabled(true);
+  }
   InitializeSubsystems();
   AddOverridePaks();
   x128_globalObjects->PostInitialize();
@@ -652,6 +668,8 @@ std::string CMain::Init(int argc, char** argv, const FileStoreManager& storeMgr,
 
 bool CMain::Proc(float dt) {
   CRandom16::ResetNumNextCalls();
+  CFactoryMgr::ResetInflateStats();
+  CDvdFile::ResetQueueStats();
   if (!m_loadedPersistentResources) {
     x128_globalObjects->m_gameResFactory->LoadPersistentResources(*g_SimplePool);
     m_loadedPersistentResources = true;
@@ -703,6 +721,14 @@ void CMain::Shutdown() {
   //  CBooModel::Shutdown();
   //  CGraphics::ShutdownBoo();
   ShutdownDiscord();
+  if (!m_resourceTracePath.empty()) {
+    CResLoadTrace::SetEnabled(false);
+    const std::vector<SResLoadRecord> records = CResLoadTrace::TakeRecords();
+    if (CResLoadTrace::WriteCSV(m_resourceTracePath, records)) {
+      MainLog.report(logvisor::Info, FMT_STRING("Wrote resource trace to {}\n{}"), m_resourceTracePath,
+                     CResLoadTrace::Summarize(records));
+    }
+  }
 }
 
 #if 0
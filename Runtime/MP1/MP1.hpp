@@ -187,6 +187,7 @@ private:
   bool m_doQuit = false;
   bool m_paused = false;
   MetaforceVersionInfo m_version;
+  std::string m_resourceTracePath; /* Metaforce addition: CResLoadTrace output, empty when tracing is off */
 
   void InitializeSubsystems();
   static void InitializeDiscord();
@@ -52,6 +52,7 @@ public:
               float, float, const CDamageVulnerability&, float, float, float, s16, s16, s16, float);
 
   void AcceptScriptMsg(EScriptObjectMessage, TUniqueId, CStateManager&) override;
+  bool IsCollisionLocal() const override { return true; }
 
   void Think(float, CStateManager&) override;
   const CDamageVulnerability* GetDamageVulnerability() const override;
@@ -31,6 +31,7 @@ public:
 
   void Think(float, CStateManager&) override;
   void AcceptScriptMsg(EScriptObjectMessage, TUniqueId, CStateManager&) override;
+  bool IsCollisionLocal() const override { return true; }
   void AddToRenderer(const zeus::CFrustum&, CStateManager&) override;
   void Render(CStateManager& mgr) override;
   const CDamageVulnerability* GetDamageVulnerability() const override;
@@ -39,6 +39,7 @@ public:
 
   void Think(float dt, CStateManager& mgr) override;
   void AcceptScriptMsg(EScriptObjectMessage msg, TUniqueId uid, CStateManager& mgr) override;
+  bool IsCollisionLocal() const override { return true; }
   void Death(CStateManager& mgr, const zeus::CVector3f& direction, EScriptObjectState state) override;
   void Generate(CStateManager& mgr, EStateMsg msg, float arg) override;
   void Attack(CStateManager& mgr, EStateMsg msg, float arg) override;
@@ -45,6 +45,7 @@ public:
 
   void Accept(IVisitor&) override;
   void AcceptScriptMsg(EScriptObjectMessage msg, TUniqueId uid, CStateManager& mgr) override;
+  bool IsCollisionLocal() const override { return true; }
   void Dead(CStateManager&, EStateMsg msg, float dt) override;
   bool Delay(CStateManager&, float arg) override;
   bool InPosition(CStateManager& mgr, float dt) override;
@@ -30,6 +30,7 @@ public:
 
   void Accept(IVisitor&) override;
   void AcceptScriptMsg(EScriptObjectMessage, TUniqueId, CStateManager&) override;
+  bool IsCollisionLocal() const override { return true; }
   void Think(float, CStateManager&) override;
   void Render(CStateManager&) override;
   void Touch(CActor&, CStateManager&) override;
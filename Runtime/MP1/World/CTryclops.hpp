@@ -42,6 +42,7 @@ public:
             float f3, float launchSpeed);
 
   void AcceptScriptMsg(EScriptObjectMessage, TUniqueId, CStateManager&) override;
+  bool IsCollisionLocal() const override { return true; }
   void Think(float, CStateManager&) override;
   const CDamageVulnerability* GetDamageVulnerability() const override {
     if (x698_26_)
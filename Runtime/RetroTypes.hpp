@@ -1,8 +1,11 @@
 #pragma once
 
+#include <bit>
 #include <functional>
+#include <limits>
 #include <optional>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -24,15 +27,27 @@ using namespace std::literals;
 namespace metaforce {
 class CInputStream;
 class COutputStream;
-using kUniqueIdType = u16;
-static constexpr int kMaxEntities = 1024;
-constexpr kUniqueIdType kUniqueIdSize = sizeof(u16);
+
+/* Metaforce addition: entity capacity is a build option (METAFORCE_MAX_ENTITIES in CMake). The retail layout of 10
+ * value bits and 6 version bits in a u16 is kept at 1024; larger capacities widen TUniqueId to a u32 with more value
+ * bits and the same version bits. Entity indices are s16 throughout, hence the upper bound. The capacity bounds the
+ * unique id space: AllocateUniqueId reuses the retail 1024 indices until they are all live, and tables indexed by id
+ * value (object lists, the broadphase, touch bounds, the allocator's versions) grow up to the highest id in use.
+ * Running out of ids is fatal in AllocateUniqueId, as in the original. */
+#ifndef METAFORCE_MAX_ENTITIES
+#define METAFORCE_MAX_ENTITIES 1024
+#endif
+static constexpr int kMaxEntities = METAFORCE_MAX_ENTITIES;
+static_assert(kMaxEntities >= 1024 && kMaxEntities <= 16384 && std::has_single_bit(unsigned(kMaxEntities)),
+              "METAFORCE_MAX_ENTITIES must be a power of two from 1024 to 16384");
+using kUniqueIdType = std::conditional_t<kMaxEntities <= 1024, u16, u32>;
+constexpr kUniqueIdType kUniqueIdSize = sizeof(kUniqueIdType);
 constexpr kUniqueIdType kUniqueIdBits = kUniqueIdSize * 8;
-constexpr kUniqueIdType kUniqueIdMax = UINT16_MAX;
+constexpr kUniqueIdType kUniqueIdMax = std::numeric_limits<kUniqueIdType>::max();
 constexpr kUniqueIdType kUniqueIdVersionMax = 64;
 constexpr kUniqueIdType kUniqueIdVersionMask = kUniqueIdVersionMax - 1;
 constexpr kUniqueIdType kUniqueIdValueMask = kMaxEntities - 1;
-constexpr kUniqueIdType kUniqueIdValueBits = 10;
+constexpr kUniqueIdType kUniqueIdValueBits = std::countr_zero(unsigned(kMaxEntities));
 constexpr kUniqueIdType kUniqueIdVersionBits = 6;
 
 #undef bswap16
@@ -250,7 +265,7 @@ struct TUniqueId {
 
   constexpr TUniqueId() noexcept = default;
   constexpr TUniqueId(kUniqueIdType value, kUniqueIdType version) noexcept
-  : id(value | (version << kUniqueIdValueBits)) {}
+  : id(kUniqueIdType(value | (version << kUniqueIdValueBits))) {}
   [[nodiscard]] constexpr kUniqueIdType Version() const noexcept {
     return kUniqueIdType((id >> kUniqueIdValueBits) & kUniqueIdVersionMask);
   }
@@ -261,7 +276,8 @@ struct TUniqueId {
 };
 
 #define kInvalidUniqueId TUniqueId()
-using EntityList = rstl::reserved_vector<TUniqueId, kMaxEntities>;
+// Metaforce addition: growable, since a list reserving the whole id space costs up to 64 KiB of stack per query
+using EntityList = std::vector<TUniqueId>;
 
 using TAreaId = s32;
 
@@ -354,8 +370,7 @@ struct hash<metaforce::CAssetId> {
 
 FMT_CUSTOM_FORMATTER(metaforce::CAssetId, "{:08X}", obj.Value())
 FMT_CUSTOM_FORMATTER(metaforce::TEditorId, "{:08X}", obj.id)
-static_assert(sizeof(metaforce::kUniqueIdType) == sizeof(u16),
-              "TUniqueId size does not match expected size! Update TUniqueId format string!");
+// Four digits for the retail u16 layout; wider ids from a raised METAFORCE_MAX_ENTITIES print in full
 FMT_CUSTOM_FORMATTER(metaforce::TUniqueId, "{:04X}", obj.id)
 FMT_CUSTOM_FORMATTER(metaforce::FourCC, "{:c}{:c}{:c}{:c}", obj.getChars()[0], obj.getChars()[1], obj.getChars()[2],
                      obj.getChars()[3])
@@ -1,8 +1,12 @@
 #pragma once
+#include <memory>
+
 #include "Runtime/Streams/CInputStream.hpp"
 
 namespace metaforce {
 class CMemoryInStream final : public CInputStream {
+  std::shared_ptr<const void> m_owner;
+
 public:
   enum class EOwnerShip {
     Owned,
@@ -12,6 +16,9 @@ public:
   CMemoryInStream(const void* ptr, u32 len) : CInputStream(ptr, len, false) {}
   CMemoryInStream(const void* ptr, u32 len, EOwnerShip ownership)
   : CInputStream(ptr, len, ownership == EOwnerShip::Owned) {}
+  /* Metaforce addition: reads memory that owner keeps alive, such as a view into a memory-mapped file */
+  CMemoryInStream(const void* ptr, u32 len, std::shared_ptr<const void> owner)
+  : CInputStream(ptr, len, false), m_owner(std::move(owner)) {}
   u32 Read(void* dest, u32 len) override { return 0; }
 };
 } // namespace metaforce
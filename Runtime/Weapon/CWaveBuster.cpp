@@ -418,7 +418,7 @@ void CWaveBuster::RayCastTarget(CStateManager& mgr, TUniqueId& physId, TUniqueId
                                 const zeus::CVector3f& end, float length, CRayCastResult& physRes,
                                 CRayCastResult& actorRes) {
   const zeus::CAABox box = zeus::CAABox(-0.5f, 0.f, -0.5f, 0.5f, 25.f, 0.5f).getTransformedAABox(x2e8_originalXf);
-  rstl::reserved_vector<TUniqueId, 1024> nearList;
+  EntityList nearList;
   mgr.BuildNearList(nearList, box,
                     CMaterialFilter::MakeExclude({EMaterialTypes::ProjectilePassthrough, EMaterialTypes::Player}),
                     this);
@@ -454,7 +454,7 @@ void CWaveBuster::RayCastTarget(CStateManager& mgr, TUniqueId& physId, TUniqueId
 }
 
 CRayCastResult CWaveBuster::SeekTarget(float dt, TUniqueId& uid, CStateManager& mgr) {
-  rstl::reserved_vector<TUniqueId, 1024> nearList;
+  EntityList nearList;
   mgr.BuildNearList(nearList, GetProjectileBounds(),
                     CMaterialFilter::MakeIncludeExclude(
                         {EMaterialTypes::Solid}, {EMaterialTypes::ProjectilePassthrough, EMaterialTypes::Player}),
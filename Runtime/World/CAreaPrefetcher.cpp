@@ -0,0 +1,159 @@
+#include "Runtime/World/CAreaPrefetcher.hpp"
+
+#include <algorithm>
+#include <cfloat>
+
+#include "Runtime/CStateManager.hpp"
+#include "Runtime/ConsoleVariables/CVarCommons.hpp"
+#include "Runtime/World/CPlayer.hpp"
+#include "Runtime/World/CWorld.hpp"
+
+#include <optick.h>
+
+namespace metaforce {
+namespace {
+constexpr u32 MaxPrefetchAreas = 3;
+constexpr u32 MaxDepth = 2;
+/* Second-ring areas inherit a fraction of the score of the area that leads to them */
+constexpr float RingFalloff = 0.25f;
+/* Distance at which proximity alone halves the score */
+constexpr float DistanceScale = 20.f;
+/* Below this the player is treated as standing still and direction is ignored */
+constexpr float MinSpeed = 0.5f;
+constexpr float StartThreshold = 0.1f;
+/* Areas already in flight are kept until they fall well below the start threshold, so jitter does not thrash reads */
+constexpr float KeepThreshold = 0.05f;
+
+zeus::CVector3f GetDockCenter(const IGameArea::Dock& dock) {
+  const auto& verts = dock.GetPlaneVertices();
+  zeus::CVector3f center;
+  for (const zeus::CVector3f& vert : verts) {
+    center += vert;
+  }
+  return verts.empty() ? center : center / float(verts.size());
+}
+} // namespace
+
+void CAreaPrefetcher::GatherCandidates(const CWorld& world, const CStateManager& mgr, TAreaId curAreaId) {
+  m_candidates.clear();
+  const CPlayer& player = mgr.GetPlayer();
+  const zeus::CVector3f playerPos = player.GetTranslation();
+  const zeus::CVector3f velocity = player.GetVelocity();
+  const bool moving = velocity.magSquared() > MinSpeed * MinSpeed;
+  const zeus::CVector3f moveDir = moving ? velocity.normalized() : zeus::CVector3f{};
+
+  const auto addCandidate = [this](TAreaId areaId, float score) {
+    const auto search = std::find_if(m_candidates.begin(), m_candidates.end(),
+                                     [areaId](const SCandidate& cand) { return cand.x0_areaId == areaId; });
+    if (search == m_candidates.end()) {
+      m_candidates.push_back({areaId, score});
+    } else {
+      search->x4_score = std::max(search->x4_score, score);
+    }
+  };
+
+  std::vector<SCandidate> frontier{{curAreaId, 1.f}};
+  std::vector<SCandidate> next;
+  for (u32 depth = 0; depth < MaxDepth && !frontier.empty(); ++depth) {
+    next.clear();
+    for (const SCandidate& from : frontier) {
+      const CGameArea* area = world.GetAreaAlways(from.x0_areaId);
+      for (const CGameArea::Dock& dock : area->GetDocks()) {
+        const TAreaId connId = dock.GetConnectedAreaId(dock.GetReferenceCount());
+        if (connId == kInvalidAreaId || connId == curAreaId || connId >= world.GetNumAreas() ||
+            !world.GetAreaAlways(connId)->GetActive()) {
+          continue;
+        }
+
+        float score = from.x4_score * RingFalloff;
+        if (depth == 0) {
+          const zeus::CVector3f toDock = GetDockCenter(dock) - playerPos;
+          const float dist = toDock.magnitude();
+          const float proximity = 1.f / (1.f + dist / DistanceScale);
+          float facing = 0.5f;
+          if (moving && dist > FLT_EPSILON) {
+            facing = 0.5f + 0.5f * moveDir.dot(toDock / dist);
+          }
+          score = proximity * facing;
+        }
+        addCandidate(connId, score);
+        next.push_back({connId, score});
+      }
+    }
+    std::swap(frontier, next);
+  }
+
+  std::sort(m_candidates.begin(), m_candidates.end(),
+            [](const SCandidate& a, const SCandidate& b) { return a.x4_score > b.x4_score; });
+}
+
+float CAreaPrefetcher::GetScore(TAreaId areaId) const {
+  const auto search = std::find_if(m_candidates.cbegin(), m_candidates.cend(),
+                                   [areaId](const SCandidate& cand) { return cand.x0_areaId == areaId; });
+  return search == m_candidates.cend() ? 0.f : search->x4_score;
+}
+
+void CAreaPrefetcher::Update(CWorld& world, CStateManager& mgr, TAreaId curAreaId) {
+  OPTICK_EVENT();
+  const CVarCommons* cvars = CVarCommons::instance();
+  if (cvars == nullptr || !cvars->getAreaPrefetch() || curAreaId == kInvalidAreaId) {
+    CancelAll(world);
+    return;
+  }
+
+  GatherCandidates(world, mgr, curAreaId);
+
+  // Drop areas the world has taken over (they are streaming for real now) and cancel the ones that fell out of favour
+  u32 usedBytes = 0;
+  std::erase_if(m_prefetched, [&](TAreaId areaId) {
+    CGameArea* area = world.GetArea(areaId);
+    if (!area->IsPrefetching() || area->GetCurChain() != EChain::Deallocated) {
+      return true;
+    }
+    if (GetScore(areaId) < KeepThreshold) {
+      area->CancelPrefetch();
+      return true;
+    }
+    usedBytes += area->GetPrefetchBytes();
+    return false;
+  });
+
+  // Start at most one new area per frame; building the token list is not free
+  const u32 budget = cvars->getAreaPrefetchBudget();
+  for (const SCandidate& cand : m_candidates) {
+    if (m_prefetched.size() >= MaxPrefetchAreas || cand.x4_score < StartThreshold) {
+      break;
+    }
+    if (std::find(m_prefetched.cbegin(), m_prefetched.cend(), cand.x0_areaId) != m_prefetched.cend()) {
+      continue;
+    }
+    CGameArea* area = world.GetArea(cand.x0_areaId);
+    if (area->GetCurChain() != EChain::Deallocated || area->IsPostConstructed() || budget <= usedBytes) {
+      continue;
+    }
+    if (area->StartPrefetch(mgr, budget - usedBytes) != 0) {
+      m_prefetched.push_back(cand.x0_areaId);
+      break;
+    }
+  }
+}
+
+void CAreaPrefetcher::CancelAll(CWorld& world) {
+  for (TAreaId areaId : m_prefetched) {
+    CGameArea* area = world.GetArea(areaId);
+    if (area->GetCurChain() == EChain::Deallocated) {
+      area->CancelPrefetch();
+    }
+  }
+  m_prefetched.clear();
+}
+
+u32 CAreaPrefetcher::GetPrefetchedBytes(const CWorld& world) const {
+  u32 ret = 0;
+  for (TAreaId areaId : m_prefetched) {
+    ret += world.GetAreaAlways(areaId)->GetPrefetchBytes();
+  }
+  return ret;
+}
+
+} // namespace metaforce
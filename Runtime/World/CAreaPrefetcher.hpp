@@ -0,0 +1,36 @@
+#pragma once
+
+#include <vector>
+
+#include "Runtime/RetroTypes.hpp"
+
+namespace metaforce {
+class CStateManager;
+class CWorld;
+
+/* Speculatively streams areas the player is likely to enter next.
+ * Neighbours are found by walking the dock graph out from the current area and scored by the player's distance to
+ * the connecting dock and whether they are moving towards it. The best candidates have their dependency tokens and
+ * MREA data requested at EDvdPriority::Prefetch within a fixed memory budget; candidates that drop out of favour
+ * (e.g. the player turns back) are cancelled on the next update. */
+class CAreaPrefetcher {
+  struct SCandidate {
+    TAreaId x0_areaId;
+    float x4_score;
+  };
+
+  std::vector<TAreaId> m_prefetched;
+  std::vector<SCandidate> m_candidates;
+
+  void GatherCandidates(const CWorld& world, const CStateManager& mgr, TAreaId curAreaId);
+  float GetScore(TAreaId areaId) const;
+
+public:
+  void Update(CWorld& world, CStateManager& mgr, TAreaId curAreaId);
+  void CancelAll(CWorld& world);
+
+  u32 GetPrefetchedAreaCount() const { return u32(m_prefetched.size()); }
+  u32 GetPrefetchedBytes(const CWorld& world) const;
+};
+
+} // namespace metaforce
@@ -3,6 +3,7 @@
 #include <string>
 #include <vector>
 #include <set>
+#include <span>
 
 #include "Runtime/RetroTypes.hpp"
 #include "Runtime/World/CEntityInfo.hpp"
@@ -25,6 +26,7 @@
 namespace metaforce {
 class CStateManager;
 class IVisitor;
+enum class EGameObjectList;
 
 class CEntity {
   friend class CStateManager;
@@ -41,11 +43,13 @@ protected:
   bool x30_25_inGraveyard : 1 = false;
   bool x30_26_scriptingBlocked : 1 = false;
   bool x30_27_inUse : 1;
+  // Metaforce addition: one bit per EGameObjectList the entity is in, kept by CObjectList
+  u8 m_objectListMask = 0;
 
   // Used in ImGuiConsole
   bool m_debugSelected = false;
   bool m_debugHovered = false;
-  const std::set<SConnection>* m_incomingConnections = nullptr;
+  std::span<const SConnection> m_incomingConnections;
 
 public:
   static const std::vector<SConnection> NullConnectionList;
@@ -54,6 +58,8 @@ public:
   virtual void Accept(IVisitor& visitor) = 0;
   virtual void PreThink(float dt, CStateManager& mgr) {}
   virtual void Think(float dt, CStateManager& mgr) {}
+  /* Metaforce addition: PreThink/Think change only this entity, draw no CRandom16 and defer every other effect */
+  virtual bool IsAreaLocal() const { return false; }
   virtual void AcceptScriptMsg(EScriptObjectMessage msg, TUniqueId objId, CStateManager& stateMgr);
   virtual void SetActive(bool active) { x30_24_active = active; }
 
@@ -69,6 +75,7 @@ public:
   bool IsScriptingBlocked() const { return x30_26_scriptingBlocked; }
   void SetIsScriptingBlocked(bool blocked) { x30_26_scriptingBlocked = blocked; }
   bool IsInUse() const { return x30_27_inUse; }
+  bool IsInObjectList(EGameObjectList list) const { return (m_objectListMask >> int(list)) & 1; }
 
   TAreaId GetAreaId() const {
     if (x30_27_inUse)
@@ -84,7 +91,7 @@ public:
   const std::vector<SConnection>& GetConnectionList() const { return x20_conns; }
 
   std::string_view GetName() const { return x10_name; }
-  void SetIncomingConnectionList(const std::set<SConnection>* conns) { m_incomingConnections = conns; }
+  void SetIncomingConnectionList(std::span<const SConnection> conns) { m_incomingConnections = conns; }
 };
 
 } // namespace metaforce
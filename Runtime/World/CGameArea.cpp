@@ -1,12 +1,17 @@
 #include "Runtime/World/CGameArea.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cstring>
 
+#include "Runtime/CDvdFile.hpp"
 #include "Runtime/CGameState.hpp"
+#include "Runtime/CResLoader.hpp"
 #include "Runtime/CSimplePool.hpp"
 #include "Runtime/CStateManager.hpp"
+#include "Runtime/CWorkerPool.hpp"
 #include "Runtime/GameGlobalObjects.hpp"
+#include "Runtime/ConsoleVariables/CVarManager.hpp"
 #include "Runtime/Graphics/CCubeRenderer.hpp"
 #include "Runtime/Graphics/CCubeSurface.hpp"
 #include "Runtime/World/CScriptAreaAttributes.hpp"
@@ -16,6 +21,9 @@
 namespace metaforce {
 
 static logvisor::Module Log("CGameArea");
+// Only touched by PostConstructArea on the game thread
+static CGameArea::SPostConstructStats s_postConstructStats;
+static CVar* ga_collisionTriangleCache = nullptr;
 
 CAreaRenderOctTree::CAreaRenderOctTree(const u8* buf) : x0_buf(buf) {
   CMemoryInStream r(x0_buf + 8, INT32_MAX);
@@ -394,6 +402,7 @@ CGameArea::CGameArea(CInputStream& in, int idx, int mlvlVersion) : x4_selfIdx(id
 }
 
 CGameArea::~CGameArea() {
+  CancelPrefetch();
   for (auto& lt : xf8_loadTransactions)
     lt->PostCancelRequest();
 
@@ -655,6 +664,14 @@ bool CGameArea::StartStreamingMainArea() {
 
   switch (xf4_phase) {
   case EPhase::LoadHeader: {
+    if (m_prefetchReq) {
+      if (!m_prefetchReq->IsComplete()) {
+        // The player got here before the prefetch finished; finish it at demand priority rather than reading twice
+        CDvdFile::RaisePriority(m_prefetchReq, EDvdPriority::AreaData);
+        break;
+      }
+      m_prefetchReq.reset();
+    }
     x110_mreaSecBufs.reserve(3);
     AllocNewAreaData(0, 96);
     x12c_postConstructed = std::make_unique<CPostConstructed>();
@@ -701,6 +718,10 @@ bool CGameArea::StartStreamingMainArea() {
       curOff += size;
     }
 
+    // Every section has been copied out of the prefetched image by now
+    m_prefetchBuf.reset();
+    m_prefetchSize = 0;
+    m_prefetchBytes = 0;
     xf4_phase = EPhase::WaitForFinish;
     break;
   }
@@ -727,11 +748,23 @@ u32 CGameArea::GetNumPartSizes() const {
 
 void CGameArea::AllocNewAreaData(int offset, int size) {
   x110_mreaSecBufs.emplace_back(std::unique_ptr<u8[]>(new u8[size]), size);
+  if (m_prefetchBuf && u32(offset + size) <= m_prefetchSize) {
+    std::memcpy(x110_mreaSecBufs.back().first.get(), m_prefetchBuf.get() + offset, size);
+    return;
+  }
   xf8_loadTransactions.push_back(g_ResFactory->LoadResourcePartAsync(SObjectTag{FOURCC('MREA'), x84_mrea}, offset, size,
                                                                      x110_mreaSecBufs.back().first.get()));
+  // Move on to the next phase as soon as this one's reads land rather than on the next StartStreamIn. The area holds
+  // its requests until they are culled or cancelled, so the callback never outlives it.
+  xf8_loadTransactions.back()->PostCompletion([this] {
+    if (xf0_26_tokensReady && !xf0_27_loadPaused) {
+      while (StartStreamingMainArea() && xf8_loadTransactions.empty()) {}
+    }
+  });
 }
 
 bool CGameArea::Invalidate(CStateManager* mgr) {
+  CancelPrefetch();
   if (!xf0_24_postConstructed) {
     ClearTokenList();
 
@@ -795,6 +828,16 @@ void CGameArea::StartStreamIn(CStateManager& mgr) {
   OPTICK_EVENT();
   VerifyTokenList(mgr);
 
+  if (m_prefetchedTokens) {
+    // Dependencies requested speculatively are needed now; the area owns them from here on
+    for (CToken& tok : xdc_tokens) {
+      if (!tok.IsLoaded()) {
+        g_ResFactory->RaiseBuildPriority(*tok.GetObjectTag(), EDvdPriority::AreaData);
+      }
+    }
+    m_prefetchedTokens = false;
+  }
+
   if (!xf0_26_tokensReady) {
     u32 notLoaded = 0;
     for (CToken& tok : xdc_tokens) {
@@ -820,6 +863,11 @@ void CGameArea::Validate(CStateManager& mgr) {
   if (xf0_24_postConstructed)
     return;
 
+  if (m_prefetchReq) {
+    CDvdFile::RaisePriority(m_prefetchReq, EDvdPriority::AreaData);
+    m_prefetchReq->WaitUntilComplete();
+  }
+  m_prefetchedTokens = false;
   while (StartStreamingMainArea()) {}
 
   for (auto& req : xf8_loadTransactions)
@@ -852,9 +900,14 @@ void CGameArea::Validate(CStateManager& mgr) {
         continue;
       }
 
-      CPostConstructed::MapEntry& ent = x12c_postConstructed->xa8_pvsEntityMap[id.Value()];
-      ent.x0_id = static_cast<s16>(i + (pvs->GetNumFeatures() - pvs->GetNumActors()));
-      ent.x4_uid = id;
+      auto& map = x12c_postConstructed->xa8_pvsEntityMap;
+      auto it = std::lower_bound(map.begin(), map.end(), id.Value(),
+                                 [](const CPostConstructed::MapEntry& e, u32 v) { return e.x4_uid.Value() < v; });
+      if (it == map.end() || it->x4_uid.Value() != id.Value()) {
+        it = map.emplace(it);
+      }
+      it->x0_id = static_cast<s16>(i + (pvs->GetNumFeatures() - pvs->GetNumActors()));
+      it->x4_uid = id;
     }
   }
 
@@ -883,6 +936,9 @@ std::pair<const u8*, u32> CGameArea::GetLayerScriptBuffer(int layer) const {
 }
 
 void CGameArea::PostConstructArea() {
+  OPTICK_EVENT();
+  using Clock = std::chrono::steady_clock;
+  const auto wallStart = Clock::now();
   SMREAHeader header = VerifyHeader();
 
   /* Materials */
@@ -896,9 +952,23 @@ void CGameArea::PostConstructArea() {
     secIt += 7 + surfCount;
   }
 
+  /* Metaforce addition: the remaining sections are independent byte ranges, so parse them as parallel jobs.
+   * Each job only writes its own members of x12c_postConstructed; everything is joined before returning. */
+  SPostConstructStats::Times times{};
+  CJobGroup jobs{CWorkerPool::GetShared()};
+  const auto submitTimed = [&jobs, &times](EPostConstructSection section, auto&& job) {
+    jobs.Submit([&times, section, job = std::move(job)]() {
+      const auto start = Clock::now();
+      job();
+      times[size_t(section)] = Clock::now() - start;
+    });
+  };
+  CPostConstructed* postConstructed = x12c_postConstructed.get();
+
   /* Render octree */
   if (header.version > 14 && header.arotSecIdx != -1) {
-    x12c_postConstructed->xc_octTree.emplace(secIt->first);
+    submitTimed(EPostConstructSection::RenderOctree,
+                [postConstructed, buf = secIt->first]() { postConstructed->xc_octTree.emplace(buf); });
     ++secIt;
   }
 
@@ -908,7 +978,19 @@ void CGameArea::PostConstructArea() {
   ++secIt;
 
   /* Collision section */
-  x12c_postConstructed->x0_collision = CAreaOctTree::MakeFromMemory(secIt->first, secIt->second);
+  if (ga_collisionTriangleCache == nullptr) {
+    ga_collisionTriangleCache = CVarManager::instance()->findOrMakeCVar(
+        "area.collisionTriangleCache"sv,
+        "Decodes collision triangles when an area loads, trading 128 bytes per triangle for faster collision queries",
+        true, CVar::EFlags::Archive | CVar::EFlags::Game);
+  }
+  const bool buildTriangleCache = ga_collisionTriangleCache->toBoolean();
+  submitTimed(EPostConstructSection::Collision, [postConstructed, sec = *secIt, buildTriangleCache]() {
+    postConstructed->x0_collision = CAreaOctTree::MakeFromMemory(sec.first, sec.second);
+    if (buildTriangleCache) {
+      postConstructed->x0_collision->BuildTriangleCache();
+    }
+  });
   ++secIt;
 
   /* Unknown section */
@@ -916,66 +998,80 @@ void CGameArea::PostConstructArea() {
 
   /* Lights section */
   if (header.version > 6) {
-    CMemoryInStream r(secIt->first, secIt->second, CMemoryInStream::EOwnerShip::NotOwned);
-    u32 magic = r.ReadLong();
-    u32 aCount = magic;
-    if (magic == 0xBABEDEAD) {
-      aCount = r.ReadLong();
-    }
-    x12c_postConstructed->x60_lightsA.reserve(aCount);
-    x12c_postConstructed->x70_gfxLightsA.reserve(aCount);
-    for (u32 i = 0; i < aCount; ++i) {
-      x12c_postConstructed->x60_lightsA.emplace_back(r);
-      x12c_postConstructed->x70_gfxLightsA.push_back(x12c_postConstructed->x60_lightsA.back().GetAsCGraphicsLight());
-    }
+    submitTimed(EPostConstructSection::Lights, [postConstructed, sec = *secIt]() {
+      CMemoryInStream r(sec.first, sec.second, CMemoryInStream::EOwnerShip::NotOwned);
+      u32 magic = r.ReadLong();
+      u32 aCount = magic;
+      if (magic == 0xBABEDEAD) {
+        aCount = r.ReadLong();
+      }
+      postConstructed->x60_lightsA.reserve(aCount);
+      postConstructed->x70_gfxLightsA.reserve(aCount);
+      for (u32 i = 0; i < aCount; ++i) {
+        postConstructed->x60_lightsA.emplace_back(r);
+        postConstructed->x70_gfxLightsA.push_back(postConstructed->x60_lightsA.back().GetAsCGraphicsLight());
+      }
 
-    if (magic == 0xBABEDEAD) {
-      u32 bCount = r.ReadLong();
-      x12c_postConstructed->x80_lightsB.reserve(bCount);
-      x12c_postConstructed->x90_gfxLightsB.reserve(bCount);
-      for (u32 i = 0; i < bCount; ++i) {
-        x12c_postConstructed->x80_lightsB.emplace_back(r);
-        x12c_postConstructed->x90_gfxLightsB.push_back(x12c_postConstructed->x80_lightsB.back().GetAsCGraphicsLight());
+      if (magic == 0xBABEDEAD) {
+        u32 bCount = r.ReadLong();
+        postConstructed->x80_lightsB.reserve(bCount);
+        postConstructed->x90_gfxLightsB.reserve(bCount);
+        for (u32 i = 0; i < bCount; ++i) {
+          postConstructed->x80_lightsB.emplace_back(r);
+          postConstructed->x90_gfxLightsB.push_back(postConstructed->x80_lightsB.back().GetAsCGraphicsLight());
+        }
       }
-    }
 
-    if (x12c_postConstructed->x80_lightsB.empty()) {
-      x12c_postConstructed->x80_lightsB = x12c_postConstructed->x60_lightsA;
-      x12c_postConstructed->x90_gfxLightsB = x12c_postConstructed->x70_gfxLightsA;
-    }
+      if (postConstructed->x80_lightsB.empty()) {
+        postConstructed->x80_lightsB = postConstructed->x60_lightsA;
+        postConstructed->x90_gfxLightsB = postConstructed->x70_gfxLightsA;
+      }
+    });
 
     ++secIt;
   }
 
   /* PVS section */
+  // The flags share a byte with other bitfields, so the job hands them back instead of writing them itself
+  bool pvsHasActors = false;
+  bool pvsUnk = false;
   if (header.version > 7) {
-    CMemoryInStream r(secIt->first, secIt->second, CMemoryInStream::EOwnerShip::NotOwned);
-    if (secIt->second > 0) { // TODO this works around CMemoryInStream inf loop on 0 len
-      u32 magic = r.ReadLong();
-      if (magic == 'VISI') {
-        x12c_postConstructed->x10a8_pvsVersion = r.ReadLong();
-        if (x12c_postConstructed->x10a8_pvsVersion == 2) {
-          x12c_postConstructed->x1108_29_pvsHasActors = r.ReadBool();
-          x12c_postConstructed->x1108_30_ = r.ReadBool();
-          x12c_postConstructed->xa0_pvs =
-              std::make_unique<CPVSAreaSet>(secIt->first + r.GetReadPosition(), secIt->second - r.GetReadPosition());
+    submitTimed(EPostConstructSection::PVS, [postConstructed, sec = *secIt, &pvsHasActors, &pvsUnk]() {
+      CMemoryInStream r(sec.first, sec.second, CMemoryInStream::EOwnerShip::NotOwned);
+      if (sec.second > 0) { // TODO this works around CMemoryInStream inf loop on 0 len
+        u32 magic = r.ReadLong();
+        if (magic == 'VISI') {
+          postConstructed->x10a8_pvsVersion = r.ReadLong();
+          if (postConstructed->x10a8_pvsVersion == 2) {
+            pvsHasActors = r.ReadBool();
+            pvsUnk = r.ReadBool();
+            postConstructed->xa0_pvs =
+                std::make_unique<CPVSAreaSet>(sec.first + r.GetReadPosition(), sec.second - r.GetReadPosition());
+          }
         }
       }
-    }
+    });
 
     ++secIt;
   }
 
   /* Pathfinding section */
+  // Stays on this thread since it goes through g_SimplePool; overlaps with the jobs above
   if (header.version > 9) {
+    const auto start = Clock::now();
     CMemoryInStream r(secIt->first, secIt->second, CMemoryInStream::EOwnerShip::NotOwned);
     CAssetId pathId = r.Get<CAssetId>();
     x12c_postConstructed->x10ac_pathToken = g_SimplePool->GetObj(SObjectTag{FOURCC('PATH'), pathId});
     x12c_postConstructed->x10bc_pathArea = x12c_postConstructed->x10ac_pathToken.GetObj();
     x12c_postConstructed->x10bc_pathArea->SetTransform(xc_transform);
+    times[size_t(EPostConstructSection::Path)] = Clock::now() - start;
     ++secIt;
   }
 
+  jobs.Wait();
+  x12c_postConstructed->x1108_29_pvsHasActors = pvsHasActors;
+  x12c_postConstructed->x1108_30_ = pvsUnk;
+
   x12c_postConstructed->x10c0_areaObjs = std::make_unique<CAreaObjectList>(x4_selfIdx);
   x12c_postConstructed->x10c4_areaFog = std::make_unique<CAreaFog>();
 
@@ -1004,8 +1100,21 @@ void CGameArea::PostConstructArea() {
       }
     }
   }
+
+  ++s_postConstructStats.areaCount;
+  for (size_t i = 0; i < times.size(); ++i) {
+    s_postConstructStats.lastTimes[i] = times[i];
+    s_postConstructStats.maxTimes[i] = std::max(s_postConstructStats.maxTimes[i], times[i]);
+    s_postConstructStats.totalTimes[i] += times[i];
+  }
+  s_postConstructStats.lastWallTime = Clock::now() - wallStart;
+  s_postConstructStats.totalWallTime += s_postConstructStats.lastWallTime;
 }
 
+const CGameArea::SPostConstructStats& CGameArea::GetPostConstructStats() { return s_postConstructStats; }
+
+void CGameArea::ResetPostConstructStats() { s_postConstructStats = {}; }
+
 void CGameArea::FillInStaticGeometry() {
   u32 start = x12c_postConstructed->x10ec_firstMatSection;
   x12c_postConstructed->x10d4_firstMatPtr = x110_mreaSecBufs[start].first.get();
@@ -1053,17 +1162,74 @@ void CGameArea::VerifyTokenList(CStateManager& stateMgr) {
   if (xac_deps2.empty())
     return;
 
+  std::vector<SObjectTag> tags;
   auto end = xac_deps2.end();
   for (int lidx = int(xbc_layerDepOffsets.size() - 1); lidx >= 0; --lidx) {
     auto begin = xac_deps2.begin() + xbc_layerDepOffsets[lidx];
     if (stateMgr.WorldLayerState()->IsLayerActive(x4_selfIdx, lidx)) {
+      tags.insert(tags.end(), begin, end);
+    }
+    end = begin;
+  }
+  // Metaforce addition: request the whole set at once so the reads go out as one sweep
+  std::vector<CToken> tokens = g_SimplePool->GetObjs(tags).ReleaseTokens();
+  xdc_tokens.insert(xdc_tokens.end(), std::make_move_iterator(tokens.begin()), std::make_move_iterator(tokens.end()));
+}
+
+u32 CGameArea::StartPrefetch(CStateManager& mgr, u32 budget) {
+  if (IsPrefetching() || xf0_24_postConstructed || xf4_phase != EPhase::LoadHeader || !xdc_tokens.empty()) {
+    return 0;
+  }
+  CResLoader* loader = g_ResFactory->GetResLoader();
+  if (loader == nullptr) {
+    return 0;
+  }
+
+  u32 depBytes = 0;
+  auto end = xac_deps2.end();
+  for (int lidx = int(xbc_layerDepOffsets.size() - 1); lidx >= 0; --lidx) {
+    auto begin = xac_deps2.begin() + xbc_layerDepOffsets[lidx];
+    if (mgr.WorldLayerState()->IsLayerActive(x4_selfIdx, lidx)) {
       for (auto it = begin; it != end; ++it) {
-        xdc_tokens.push_back(g_SimplePool->GetObj(*it));
-        xdc_tokens.back().Lock();
+        depBytes += g_ResFactory->ResourceSize(*it);
       }
     }
     end = begin;
   }
+
+  // A memory-mapped MREA costs nothing to read later
+  const SObjectTag mreaTag{FOURCC('MREA'), x84_mrea};
+  const u32 mreaBytes = loader->GetMappedResource(mreaTag) ? 0 : g_ResFactory->ResourceSize(mreaTag);
+  if (depBytes + mreaBytes == 0 || depBytes + mreaBytes > budget) {
+    return 0;
+  }
+
+  g_ResFactory->SetBuildPriority(EDvdPriority::Prefetch);
+  VerifyTokenList(mgr);
+  g_ResFactory->SetBuildPriority(EDvdPriority::AreaData);
+  m_prefetchedTokens = !xdc_tokens.empty();
+
+  if (mreaBytes != 0) {
+    m_prefetchBuf.reset(new u8[mreaBytes]);
+    m_prefetchSize = mreaBytes;
+    m_prefetchReq = loader->LoadResourceAsync(mreaTag, m_prefetchBuf.get(), EDvdPriority::Prefetch);
+  }
+  m_prefetchBytes = depBytes + mreaBytes;
+  return m_prefetchBytes;
+}
+
+void CGameArea::CancelPrefetch() {
+  if (m_prefetchReq) {
+    m_prefetchReq->PostCancelRequest();
+    m_prefetchReq.reset();
+  }
+  m_prefetchBuf.reset();
+  m_prefetchSize = 0;
+  m_prefetchBytes = 0;
+  if (m_prefetchedTokens) {
+    m_prefetchedTokens = false;
+    ClearTokenList();
+  }
 }
 
 void CGameArea::ClearTokenList() {
@@ -1115,11 +1281,22 @@ SMREAHeader CGameArea::VerifyHeader() const {
   return header;
 }
 
+const CGameArea::CPostConstructed::MapEntry* CGameArea::FindPVSEntry(TUniqueId id) const {
+  const auto& map = x12c_postConstructed->xa8_pvsEntityMap;
+  const auto it = std::lower_bound(map.cbegin(), map.cend(), id.Value(),
+                                   [](const CPostConstructed::MapEntry& e, u32 v) { return e.x4_uid.Value() < v; });
+  return it != map.cend() && it->x4_uid.Value() == id.Value() ? &*it : nullptr;
+}
+
 TUniqueId CGameArea::LookupPVSUniqueID(TUniqueId id) const {
-  return x12c_postConstructed->xa8_pvsEntityMap[id.Value()].x4_uid;
+  const CPostConstructed::MapEntry* ent = FindPVSEntry(id);
+  return ent != nullptr ? ent->x4_uid : kInvalidUniqueId;
 }
 
-s16 CGameArea::LookupPVSID(TUniqueId id) const { return x12c_postConstructed->xa8_pvsEntityMap[id.Value()].x0_id; }
+s16 CGameArea::LookupPVSID(TUniqueId id) const {
+  const CPostConstructed::MapEntry* ent = FindPVSEntry(id);
+  return ent != nullptr ? ent->x0_id : s16(-1);
+}
 
 void CGameArea::SetAreaAttributes(const CScriptAreaAttributes* areaAttributes) {
   x12c_postConstructed->x10d8_areaAttributes = areaAttributes;
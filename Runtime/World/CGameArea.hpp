@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <chrono>
 
 #include "Runtime/CObjectList.hpp"
 #include "Runtime/CToken.hpp"
@@ -169,7 +170,8 @@ public:
     TAreaId x200c_areaIdx = 0;
 
   public:
-    explicit CAreaObjectList(TAreaId areaIdx) : CObjectList(EGameObjectList::Invalid), x200c_areaIdx(areaIdx) {}
+    explicit CAreaObjectList(TAreaId areaIdx)
+    : CObjectList(EGameObjectList::Invalid, EObjectListOrder::Unordered), x200c_areaIdx(areaIdx) {}
 
     bool IsQualified(const CEntity& ent) const override;
   };
@@ -211,7 +213,9 @@ public:
       s16 x0_id = -1;
       TUniqueId x4_uid = kInvalidUniqueId;
     };
-    std::array<MapEntry, kMaxEntities> xa8_pvsEntityMap;
+    // Metaforce addition: was a kMaxEntities array indexed by id value; only the area's PVS actors are stored, sorted
+    // by id value
+    std::vector<MapEntry> xa8_pvsEntityMap;
     u32 x10a8_pvsVersion = 0;
     TLockedToken<CPFArea> x10ac_pathToken;
     // bool x10b8_ = 0; optional flag for CToken
@@ -251,6 +255,18 @@ public:
     CPostConstructed() = default;
   };
 
+  // Metaforce addition: where PostConstructArea spends its time, per MREA section type
+  enum class EPostConstructSection { RenderOctree, Collision, Lights, PVS, Path, MAX };
+  struct SPostConstructStats {
+    using Times = std::array<std::chrono::nanoseconds, size_t(EPostConstructSection::MAX)>;
+    u32 areaCount = 0;
+    Times lastTimes{};
+    Times maxTimes{};
+    Times totalTimes{};
+    std::chrono::nanoseconds lastWallTime{};
+    std::chrono::nanoseconds totalWallTime{};
+  };
+
 private:
   std::vector<std::pair<std::unique_ptr<u8[]>, int>> x110_mreaSecBufs;
   std::vector<std::pair<const u8*, u32>> m_resolvedBufs;
@@ -271,6 +287,13 @@ private:
   std::optional<CStaticRes> m_debugConeRes;
   std::unique_ptr<CModelData> m_debugConeModel;
 
+  // Metaforce addition: speculative loads issued by CAreaPrefetcher
+  std::unique_ptr<u8[]> m_prefetchBuf;
+  u32 m_prefetchSize = 0;
+  u32 m_prefetchBytes = 0;
+  std::shared_ptr<IDvdRequest> m_prefetchReq;
+  bool m_prefetchedTokens = false;
+
 public:
   explicit CGameArea(CInputStream& in, int idx, int mlvlVersion);
   ~CGameArea();
@@ -310,6 +333,13 @@ public:
   // void TransferTokensToARAM();
   // void TransferARAMTokensOver();
   EChain SetChain(CGameArea* prev, EChain chain);
+  EChain GetCurChain() const { return x138_curChain; }
+  /* Requests the dependency tokens and MREA data at prefetch priority if they fit in `budget` bytes.
+   * Returns the bytes committed, or 0 if nothing was started. */
+  u32 StartPrefetch(CStateManager& mgr, u32 budget);
+  void CancelPrefetch();
+  bool IsPrefetching() const { return m_prefetchBytes != 0; }
+  u32 GetPrefetchBytes() const { return m_prefetchBytes; }
   bool StartStreamingMainArea();
   // void UnloadAllLoadedTextures();
   // void ReloadAllLoadedTextures();
@@ -324,11 +354,14 @@ public:
   void LoadScriptObjects(CStateManager& mgr);
   std::pair<const u8*, u32> GetLayerScriptBuffer(int layer) const;
   void PostConstructArea();
+  static const SPostConstructStats& GetPostConstructStats();
+  static void ResetPostConstructStats();
   void FillInStaticGeometry();
   void VerifyTokenList(CStateManager& stateMgr);
   void ClearTokenList();
   u32 GetPreConstructedSize() const;
   SMREAHeader VerifyHeader() const;
+  const CPostConstructed::MapEntry* FindPVSEntry(TUniqueId id) const;
   TUniqueId LookupPVSUniqueID(TUniqueId id) const;
   s16 LookupPVSID(TUniqueId id) const;
   const CPVSAreaSet* GetAreaVisSet() const { return GetPostConstructed()->xa0_pvs.get(); }
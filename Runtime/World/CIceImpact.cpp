@@ -261,7 +261,7 @@ void CIceImpact::GenerateParticlesAgainstActors(CStateManager& mgr, const zeus::
   CMaterialFilter filter =
       CMaterialFilter::MakeExclude({EMaterialTypes::Character, EMaterialTypes::Player, EMaterialTypes::Projectile,
                                     EMaterialTypes::ProjectilePassthrough, EMaterialTypes::AIJoint});
-  rstl::reserved_vector<TUniqueId, 1024> near_list;
+  EntityList near_list;
   mgr.BuildNearList(near_list, box, filter, this);
   for (TUniqueId uid : near_list) {
     CEntity* ent = mgr.ObjectById(uid);
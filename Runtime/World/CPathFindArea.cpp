@@ -2,6 +2,7 @@
 
 #include <logvisor/logvisor.hpp>
 
+#include "Runtime/CMappedFile.hpp"
 #include "Runtime/CToken.hpp"
 #include "Runtime/IVParamObj.hpp"
 
@@ -122,8 +123,10 @@ void CPFOpenList::Pop(CPFRegion* reg) {
 
 bool CPFOpenList::Test(const CPFRegion* reg) const { return x0_bitSet.Test(reg->GetIndex()); }
 
-CPFArea::CPFArea(std::unique_ptr<u8[]>&& buf, u32 len) {
-  CMemoryInStream r(buf.get(), len);
+CPFArea::CPFArea(std::unique_ptr<u8[]>&& buf, u32 len) : CPFArea(buf.get(), len) {}
+
+CPFArea::CPFArea(const u8* buf, u32 len) {
+  CMemoryInStream r(buf, len);
 
   u32 version = r.ReadLong();
   if (version != 4)
@@ -275,4 +278,10 @@ CFactoryFnReturn FPathFindAreaFactory(const metaforce::SObjectTag& tag, std::uni
                                       const metaforce::CVParamTransfer& vparms, CObjectReference*) {
   return TToken<CPFArea>::GetIObjObjectFor(std::make_unique<CPFArea>(std::move(in), len));
 }
+
+CFactoryFnReturn FPathFindAreaViewFactory(const metaforce::SObjectTag& tag, const metaforce::SMappedView& view,
+                                          const metaforce::CVParamTransfer& vparms, CObjectReference*) {
+  // Everything is parsed out of the bytes up front, so they need not outlive the constructor
+  return TToken<CPFArea>::GetIObjObjectFor(std::make_unique<CPFArea>(view.x8_data, view.xc_size));
+}
 } // namespace metaforce
@@ -91,6 +91,7 @@ class CPFArea {
 
 public:
   CPFArea(std::unique_ptr<u8[]>&& buf, u32 len);
+  CPFArea(const u8* buf, u32 len);
 
   void SetTransform(const zeus::CTransform& xf) { x188_transform = xf; }
   const zeus::CTransform& GetTransform() const { return x188_transform; }
@@ -114,4 +115,6 @@ public:
 
 CFactoryFnReturn FPathFindAreaFactory(const metaforce::SObjectTag& tag, std::unique_ptr<u8[]>&& in, u32 len,
                                       const metaforce::CVParamTransfer& vparms, CObjectReference* selfRef);
+CFactoryFnReturn FPathFindAreaViewFactory(const metaforce::SObjectTag& tag, const metaforce::SMappedView& view,
+                                          const metaforce::CVParamTransfer& vparms, CObjectReference* selfRef);
 } // namespace metaforce
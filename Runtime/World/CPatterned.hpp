@@ -265,6 +265,9 @@ public:
   void Render(CStateManager& mgr) override;
 
   void CollidedWith(TUniqueId, const CCollisionInfoList&, CStateManager& mgr) override;
+  /* IsCollisionLocal is left to subclasses. CollidedWith here only damages the player, who never joins a parallel
+   * island, and OnFloor/Falling only change this actor and its list membership, which a parallel phase defers; a
+   * subclass opts in once its own AcceptScriptMsg and overrides on the move path add nothing else. */
   void Touch(CActor& act, CStateManager& mgr) override;
   std::optional<zeus::CAABox> GetTouchBounds() const override;
   bool CanRenderUnsorted(const CStateManager& mgr) const override;
@@ -123,6 +123,8 @@ public:
   virtual const CCollisionPrimitive* GetCollisionPrimitive() const;
   virtual zeus::CTransform GetPrimitiveTransform() const;
   virtual void CollidedWith(TUniqueId id, const CCollisionInfoList& list, CStateManager& mgr);
+  /* Metaforce addition: CollidedWith and the messages a move sends this actor change only it and defer the rest */
+  virtual bool IsCollisionLocal() const { return false; }
   virtual float GetStepUpHeight() const;
   virtual float GetStepDownHeight() const;
   virtual float GetWeight() const;
@@ -84,5 +84,6 @@ public:
   void Render(CStateManager& mgr) override;
 
   void CollidedWith(TUniqueId uid, const CCollisionInfoList&, CStateManager&) override;
+  bool IsCollisionLocal() const override { return true; }
 };
 } // namespace metaforce
@@ -100,6 +100,7 @@ void CScriptMazeNode::AcceptScriptMsg(EScriptObjectMessage msg, TUniqueId uid, C
             }
           }
         }
+        m_gateTargetsInArea = CheckGateTargets(mgr);
       }
     } else if (msg == EScriptObjectMessage::SetToZero) {
       auto* maze = mgr.GetCurrentMaze();
@@ -248,6 +249,16 @@ void CScriptMazeNode::Reset(CStateManager& mgr) {
   x11c_effectId = kInvalidUniqueId;
 }
 
+bool CScriptMazeNode::CheckGateTargets(const CStateManager& mgr) const {
+  for (const TUniqueId id : {x11c_effectId, xfc_actorId, x10c_triggerId, xf4_gateEffectId}) {
+    const CEntity* ent = mgr.GetObjectById(id);
+    if (ent != nullptr && ent->GetAreaIdAlways() != GetAreaIdAlways()) {
+      return false;
+    }
+  }
+  return true;
+}
+
 void CScriptMazeNode::SendScriptMsgs(CStateManager& mgr, EScriptObjectMessage msg) {
   mgr.SendScriptMsg(x11c_effectId, GetUniqueId(), msg);
   mgr.SendScriptMsg(xfc_actorId, GetUniqueId(), msg);
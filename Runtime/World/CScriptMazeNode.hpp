@@ -97,6 +97,8 @@ class CScriptMazeNode : public CActor {
   bool x13c_24_hasPuddle : 1 = false;
   bool x13c_25_hasGate : 1 = false;
   bool x13c_26_gateActive : 1 = true;
+  // Metaforce addition: every object Think messages lives in this node's area
+  bool m_gateTargetsInArea = true;
 
 public:
   DEFINE_ENTITY
@@ -107,6 +109,9 @@ public:
   void Accept(IVisitor& visitor) override;
   void AcceptScriptMsg(EScriptObjectMessage msg, TUniqueId uid, CStateManager& mgr) override;
   void Think(float dt, CStateManager& mgr) override;
+  // Think steps this node's own timer and gate flag and messages the objects it generated, by stored id; it only
+  // counts as area-local while those share its area
+  bool IsAreaLocal() const override { return m_gateTargetsInArea; }
 
   static void LoadMazeSeeds();
 
@@ -114,5 +119,6 @@ private:
   void GenerateObjects(CStateManager& mgr);
   void Reset(CStateManager& mgr);
   void SendScriptMsgs(CStateManager& mgr, EScriptObjectMessage msg);
+  bool CheckGateTargets(const CStateManager& mgr) const;
 };
 } // namespace metaforce
@@ -55,7 +55,7 @@ CScriptPlatform::CScriptPlatform(TUniqueId uid, std::string_view name, const CEn
 
 void CScriptPlatform::Accept(IVisitor& visitor) { visitor.Visit(this); }
 
-void CScriptPlatform::DragSlave(CStateManager& mgr, rstl::reserved_vector<u16, kMaxEntities>& draggedSet, CActor* actor,
+void CScriptPlatform::DragSlave(CStateManager& mgr, std::vector<u16>& draggedSet, CActor* actor,
                                 const zeus::CVector3f& delta) {
   if (std::find(draggedSet.begin(), draggedSet.end(), actor->GetUniqueId().Value()) != draggedSet.end()) {
     return;
@@ -70,8 +70,7 @@ void CScriptPlatform::DragSlave(CStateManager& mgr, rstl::reserved_vector<u16, k
   }
 }
 
-void CScriptPlatform::DragSlaves(CStateManager& mgr, rstl::reserved_vector<u16, kMaxEntities>& draggedSet,
-                                 const zeus::CVector3f& delta) {
+void CScriptPlatform::DragSlaves(CStateManager& mgr, std::vector<u16>& draggedSet, const zeus::CVector3f& delta) {
   for (SRiders& rider : x328_slavesStatic) {
     if (const TCastToPtr<CActor> act = mgr.ObjectById(rider.x0_uid)) {
       DragSlave(mgr, draggedSet, act.GetPtr(), delta);
@@ -114,7 +113,7 @@ void CScriptPlatform::AcceptScriptMsg(EScriptObjectMessage msg, TUniqueId uid, C
       x25a_targetWaypoint = GetNext(x258_currentWaypoint, mgr);
       mgr.SendScriptMsg(wp, GetUniqueId(), EScriptObjectMessage::Arrived);
       if (!x328_slavesStatic.empty() || !x338_slavesDynamic.empty()) {
-        rstl::reserved_vector<u16, kMaxEntities> draggedSet;
+        std::vector<u16> draggedSet;
         DragSlaves(mgr, draggedSet, x270_dragDelta);
       }
       x270_dragDelta = zeus::skZero3f;
@@ -272,7 +271,7 @@ void CScriptPlatform::Think(float dt, CStateManager& mgr) {
   }
 
   if (!x328_slavesStatic.empty() || !x338_slavesDynamic.empty()) {
-    rstl::reserved_vector<u16, kMaxEntities> draggedSet;
+    std::vector<u16> draggedSet;
     DragSlaves(mgr, draggedSet, x270_dragDelta);
   }
 
@@ -62,10 +62,8 @@ class CScriptPlatform : public CPhysicsActor {
   bool x356_30_disableXrayAlpha : 1 = false;
   bool x356_31_xrayFog : 1 = true;
 
-  void DragSlave(CStateManager& mgr, rstl::reserved_vector<u16, kMaxEntities>& draggedSet, CActor* actor,
-                 const zeus::CVector3f& delta);
-  void DragSlaves(CStateManager& mgr, rstl::reserved_vector<u16, kMaxEntities>& draggedSet,
-                  const zeus::CVector3f& delta);
+  void DragSlave(CStateManager& mgr, std::vector<u16>& draggedSet, CActor* actor, const zeus::CVector3f& delta);
+  void DragSlaves(CStateManager& mgr, std::vector<u16>& draggedSet, const zeus::CVector3f& delta);
   static void DecayRiders(std::vector<SRiders>& riders, float dt, CStateManager& mgr);
   static void MoveRiders(CStateManager& mgr, float dt, bool active, std::vector<SRiders>& riders,
                          std::vector<SRiders>& collidedRiders, const zeus::CTransform& oldXf,
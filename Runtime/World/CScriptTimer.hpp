@@ -19,6 +19,8 @@ public:
 
   void Accept(IVisitor& visitor) override;
   void Think(float, CStateManager&) override;
+  // Only a looping timer re-rolls its random delay from Think
+  bool IsAreaLocal() const override { return !x40_loop; }
   void AcceptScriptMsg(EScriptObjectMessage msg, TUniqueId objId, CStateManager& stateMgr) override;
   bool IsTiming() const;
   void StartTiming(bool isTiming);
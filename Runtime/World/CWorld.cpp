@@ -527,6 +527,9 @@ void CWorld::TravelToArea(TAreaId aid, CStateManager& mgr, bool skipLoadOther) {
   if (!toStreamCount && otherLoadArea && !x70_25_loadPaused)
     otherLoadArea->StartStreamIn(mgr);
 
+  if (!skipLoadOther && !x70_25_loadPaused)
+    m_prefetcher.Update(*this, mgr, aid);
+
   x28_mapWorld->SetWhichMapAreasLoaded(*this, aid, 3);
 }
 
@@ -11,6 +11,7 @@
 #include "Runtime/Audio/CSfxManager.hpp"
 #include "Runtime/AutoMapper/CMapWorld.hpp"
 #include "Runtime/Graphics/CModel.hpp"
+#include "Runtime/World/CAreaPrefetcher.hpp"
 #include "Runtime/World/CEnvFxManager.hpp"
 #include "Runtime/World/CGameArea.hpp"
 #include "Runtime/World/ScriptObjectSupport.hpp"
@@ -167,6 +168,7 @@ private:
 
   // Metaforce addition
   std::optional<CWorldLayers> m_worldLayers;
+  CAreaPrefetcher m_prefetcher;
 
   void LoadSoundGroup(int groupId, CAssetId agscId, CSoundGroupData& data);
   void LoadSoundGroups();
@@ -219,6 +221,7 @@ public:
   std::string IGetDefaultAudioTrack() const override;
   int IGetAreaCount() const override;
   const std::optional<CWorldLayers>& GetWorldLayers() const override;
+  const CAreaPrefetcher& GetAreaPrefetcher() const { return m_prefetcher; }
 
   static void PropogateAreaChain(CGameArea::EOcclusionState occlusionState, CGameArea* area, CWorld* world);
   static constexpr CGameArea::CConstChainIterator GetAliveAreasEnd() { return CGameArea::CConstChainIterator{}; }